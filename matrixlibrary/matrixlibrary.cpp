@@ -19,19 +19,140 @@
  *
  * Note:
  *
+ * Version:     1.0.14
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Moving a matrix whose memory comes from a "matrixAllocatorScope" into a matrix
+ *                 whose memory comes from an enclosing scope, or from no scope at all, now copies
+ *                 the elements, so that a result computed within a scope can be assigned to a
+ *                 matrix outside of it, even when both scopes share an arena.
+ *
+ * Version:     1.0.13
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added "matrixSolve()" and "matrixSolveRight()", which solve A * X = B and
+ *                 X * A = B from the LU factorization of A, for all the right-hand sides together.
+ *              2. The division between two matrices now solves through "matrixSolveRight()"
+ *                 instead of multiplying by the inverse.
+ *
+ * Version:     1.0.12
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. "matrixInverse()" now solves for the inverse from a blocked LU factorization with
+ *                 partial pivoting of matrixlibrarylapack, instead of the unpivoted Gauss-Jordan
+ *                 elimination that allocated a temporary for every row operation.
+ *              2. Added "matrixStatus", through which "matrixInverse()" reports a singular matrix
+ *                 and the reciprocal condition number of the matrix.
+ *
+ * Version:     1.0.11
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. "matrixTranspose()" now transposes tile by tile through the SIMD transpose kernel
+ *                 of matrixlibrarykernels, in parallel for large matrices.
+ *              2. Added "transpose()", which transposes a matrix in place. Square matrices are
+ *                 transposed without any allocation and vectors only swap their dimensions.
+ *
+ * Version:     1.0.10
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. "matrixLeadingDimension()" is now external and takes the element size, so that
+ *                 single precision matrices share the same leading dimension padding.
+ *
+ * Version:     1.0.9
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Pushing values with "operator<<()" now returns a "matrixInitializer" cursor,
+ *                 which writes every value once instead of shifting the whole matrix on every push.
+ *                 Values can also be separated by commas, e.g. X << 1, 2, 3.
+ *              2. Added "assign()" to copy values from a pointer, an iterator range or an
+ *                 initializer list, and a constructor taking an initializer list.
+ *
+ * Version:     1.0.8
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the "matrixUninitialized" construction tag, which allocates a matrix
+ *                 without clearing its memory.
+ *              2. Matrices now keep track of their capacity. Resizing to a size that fits within
+ *                 the capacity reuses the existing memory, and "resizeRetain()" moves the retained
+ *                 elements in place.
+ *              3. Added "getCapacity()", "reserve()", "resizeUninitialized()" and "shrinkToFit()".
+ *              4. Cleared matrices are allocated through "matrixAllocatorCalloc()" so that large
+ *                 matrices are zeroed lazily by the operating system.
+ *
+ * Version:     1.0.7
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The memory of the matrices is now allocated through matrixlibraryallocator, from
+ *                 the per-thread size class pools or the active arena scope.
+ *
+ * Version:     1.0.6
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The memory of every matrix is now aligned to MATRIXLIBRARY_ALIGNMENT (64) bytes.
+ *              2. Added the leading dimension (row stride) of the matrix, returned by "getLd()".
+ *                 Matrices with at least MATRIXLIBRARY_PADDING_MIN_COL columns have their rows
+ *                 padded to a multiple of the alignment, avoiding row strides that are multiples of
+ *                 4096 bytes. The padding can be disabled with "matrixSetPadding()".
+ *              3. Copy, element wise and submatrix operations are now performed row by row through
+ *                 the strided kernels of matrixlibrarykernels.
+ *
+ * Version:     1.0.5
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added "view()" to obtain non-owning views (matrixlibraryview) of the whole matrix
+ *                 or of a submatrix, without any copy.
+ *              2. The submatrix extraction operator, "resizeRetain()", "matrixInverse()" and the
+ *                 matrix multiplication operator now work on views instead of copied submatrices.
+ *
+ * Version:     1.0.4
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The element wise operators "+" and "-" between matrices, and "+", "-", "*" and
+ *                 "/" with a value, now build lazy expression templates of matrixlibraryexpression.
+ *                 An expression is evaluated only when it is assigned into a matrix, in a single
+ *                 fused loop without temporary matrices.
+ *              2. Added the "+=" and "-=" operators with a matrix expression, and the "+" and "-"
+ *                 operators between a temporary matrix and a matrix expression, all evaluated in
+ *                 place.
+ *
+ * Version:     1.0.3
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added move constructor and move assignment operator so that temporary matrices
+ *                 hand over their memory instead of being copied.
+ *              2. Assignment operators now return the matrix reference to allow chained assignment,
+ *                 and guard against self assignment.
+ *              3. Addition, subtraction, multiplication and division of a temporary matrix with a
+ *                 scalar or matrix reuse the memory of the temporary matrix.
+ *              4. The copy constructor no longer clears the memory that is overwritten right after.
+ *
+ * Version:     1.0.2
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The element wise operators "+", "-", "*" and "/" with a value or a matrix, and
+ *                 their compound assignment forms, now run on the runtime dispatched SIMD kernels
+ *                 of matrixlibrarysimd.
+ *
+ * Version:     1.0.1
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The matrix multiplication operator now runs on the cache blocked, register tiled
+ *                 "matrixKernelsGemm()" of matrixlibrarykernels instead of the naive triple loop.
+ *              2. The submatrix extraction operator "operator()(startRow, endRow, startCol,
+ *                 endCol)" is now const so that it can be used on const matrices.
+ *
  * Version:     1.0.0
  * Date:        2021/07/28 (YYYY/MM/DD)
  * Change Log:  1. Implemented first release version of matrixlibrary.
  */
 
 #include "matrixlibrary.h"
+#include "matrixlibraryallocator.h"
+#include "matrixlibrarykernels.h"
+#include "matrixlibrarylapack.h"
+#include "matrixlibrarysimd.h"
+#include <algorithm>
+#include <limits>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <utility>
 
 #define MATRIXLIBRARY_MAJOR 1
 #define MATRIXLIBRARY_MINOR 0
-#define MATRIXLIBRARY_PATCH 0
+#define MATRIXLIBRARY_PATCH 14
+
+/**
+ * @brief matrixPaddingEnabled - Padding of the leading dimension of newly created matrices, see
+ *                               "matrixSetPadding()".
+ */
+static unsigned char matrixPaddingEnabled = 1;
 
 /// ================================================================================================
 /// STATIC FUNCTIONS
@@ -45,13 +166,48 @@ void matrixExit(const char * msg) {
   exit(0);
 } // void matrixExit(const char * msg) -------------------------------------------------------------
 
+/**
+ * @brief matrixSolveLU - Solves A * X = Z, or A^T * X = Z, in place in Z from the LU factorization
+ *                        with partial pivoting of a copy of A. If A is singular, every element of Z
+ *                        is set to NaN.
+ * @param A             - Square matrix of the system.
+ * @param trans         - Solves with A^T when true.
+ * @param Z             - Right-hand sides on input, one per column, and the solution on output.
+ * @param rcond         - Optional estimate of the reciprocal condition number of A.
+ * @return              - Zero if A is not singular, otherwise the one based index of the first
+ *                        zero pivot.
+ */
+static unsigned long matrixSolveLU(const matrix & A, bool trans, matrix & Z, double * rcond) {
+  unsigned long size = A.getRowSize();
+  matrix LU = A;
+  unsigned long * ipiv = (unsigned long *)matrixAllocatorMalloc(sizeof(unsigned long) * size);
+
+  unsigned long pivot = matrixLapackGetrf(size, size, LU.mMat, LU.getLd(), ipiv);
+  if (pivot == 0)
+    matrixLapackGetrs(trans, size, Z.getColSize(), LU.mMat, LU.getLd(), ipiv, Z.mMat, Z.getLd());
+  else {
+    for (unsigned long i = 0; i < Z.getRowSize(); i++)
+      std::fill(&Z.mMat[i * Z.getLd()], &Z.mMat[i * Z.getLd() + Z.getColSize()],
+                std::numeric_limits<double>::quiet_NaN());
+  }
+
+  if (rcond != NULL) {
+    * rcond = 0.0;
+    if (pivot == 0)
+      * rcond = matrixLapackGecon(size, LU.mMat, LU.getLd(), ipiv,
+                                  matrixLapackNorm1(size, size, A.mMat, A.getLd()));
+  }
+  matrixAllocatorFree((double *)ipiv);
+  return pivot;
+} // unsigned long matrixSolveLU(const matrix & A, bool trans, matrix & Z, double * rcond) ---------
+
 /// ================================================================================================
 /// PUBLIC FUNCTIONS
 /// ================================================================================================
 /**
  * @brief matrix - Default constructor.
  */
-matrix::matrix() : mRow(0), mCol(0), mSize(0) {
+matrix::matrix() : mRow(0), mCol(0), mSize(0), mLd(0), mCapacity(0) {
   mMat = NULL;
 } // matrix::matrix() ------------------------------------------------------------------------------
 
@@ -61,6 +217,7 @@ matrix::matrix() : mRow(0), mCol(0), mSize(0) {
  */
 matrix::matrix(unsigned long size) {
   mMat = NULL;
+  mCapacity = 0;
   this->create(size, size);
 } // matrix::matrix(unsigned long size) ------------------------------------------------------------
 
@@ -71,20 +228,79 @@ matrix::matrix(unsigned long size) {
  */
 matrix::matrix(unsigned long row, unsigned long col) {
   mMat = NULL;
+  mCapacity = 0;
   this->create(row, col);
 } // matrix::matrix(unsigned long row, unsigned long col) ------------------------------------------
 
+/**
+ * @brief matrix  - Overloaded constructor to instantiate a mxn matrix without initialising the
+ *                  elements. To be used when every element is to be overwritten right after.
+ * @param rowSize - Row size of the matrix.
+ * @param colSize - Column size of the matrix.
+ */
+matrix::matrix(unsigned long row, unsigned long col, matrixUninitializedTag) {
+  mMat = NULL;
+  mCapacity = 0;
+  this->allocate(row, col);
+} // matrix::matrix(unsigned long row, unsigned long col, matrixUninitializedTag) ------------------
+
+/**
+ * @brief matrix  - Overloaded constructor to instantiate a mxn matrix from a list of values in
+ *                  row-major order.
+ * @param rowSize - Row size of the matrix.
+ * @param colSize - Column size of the matrix.
+ * @param X       - The values, no more than the size of the matrix. Elements without a value are
+ *                  cleared to zero.
+ */
+matrix::matrix(unsigned long row, unsigned long col, std::initializer_list<double> X) {
+  mMat = NULL;
+  mCapacity = 0;
+  this->create(row, col);
+  this->assign(X);
+} // matrix::matrix(unsigned long row, unsigned long col, std::initializer_list<double> X) ---------
+
 /**
  * @brief matrix - Overloaded copy constructor.
  * @param X      - Matrix to be copied
  */
 matrix::matrix(const matrix & X) {
   mMat = NULL;
-  if ((mRow != X.getRowSize()) || (mCol != X.getColSize()))
-    this->resizeClear(X.getRowSize(), X.getColSize());
-  memcpy(this->mMat, X.mMat, sizeof(double) * mSize);
+  mCapacity = 0;
+  this->allocate(X.getRowSize(), X.getColSize());
+  matrixKernelsCopy(mRow, mCol, X.mMat, X.mLd, mMat, mLd);
 } // matrix::matrix(const matrix & X) --------------------------------------------------------------
 
+/**
+ * @brief matrix - Overloaded move constructor. Takes over the memory of the input matrix without
+ *                 copying, leaving the input matrix empty. Memory from a scope deeper than the
+ *                 active one, as when the input matrix comes from another thread, would be
+ *                 recycled while the new matrix is still alive, so it is copied instead. Memory of
+ *                 the active scope is taken over, as the new matrix is most likely a temporary of
+ *                 the scope, and the scope fails if it escapes.
+ * @param X      - Matrix to be moved.
+ */
+matrix::matrix(matrix && X) noexcept {
+  if (matrixAllocatorGetDepth(X.mMat) > matrixAllocatorGetActiveDepth()) {
+    mMat = NULL;
+    mCapacity = 0;
+    this->copyOutside(X);
+    return;
+  }
+
+  mMat = X.mMat;
+  mRow = X.mRow;
+  mCol = X.mCol;
+  mSize = X.mSize;
+  mLd = X.mLd;
+  mCapacity = X.mCapacity;
+  X.mMat = NULL;
+  X.mRow = 0;
+  X.mCol = 0;
+  X.mSize = 0;
+  X.mLd = 0;
+  X.mCapacity = 0;
+} // matrix::matrix(matrix && X) noexcept ----------------------------------------------------------
+
 /**
  * @brief ~matrix - Default destructor
  */
@@ -95,137 +311,171 @@ matrix::~matrix() {
 /**
  * @brief operator = - Resize itself to be a 1x1 matrix and stores the input value.
  * @param X          - The value to be stored.
+ * @return           - Returns the matrix reference of itself.
  */
-void matrix::operator=(double X) {
+matrix& matrix::operator=(double X) {
   this->resizeClear(1, 1);
   mMat[0] = X;
+  return * this;
 } // matrix::operator=(double X) -------------------------------------------------------------------
 
 /**
  * @brief operator = - Resize itself to be a 1x1 matrix and stores the input value.
  * @param X          - The value to be stored.
+ * @return           - Returns the matrix reference of itself.
  */
-void matrix::operator=(float X) {
+matrix& matrix::operator=(float X) {
   this->resizeClear(1, 1);
   mMat[0] = (double)X;
+  return * this;
 } // matrix::operator=(float X) --------------------------------------------------------------------
 
 /**
  * @brief operator = - Resize itself to be a 1x1 matrix and stores the input value.
  * @param X          - The value to be stored.
+ * @return           - Returns the matrix reference of itself.
  */
-void matrix::operator=(int X) {
+matrix& matrix::operator=(int X) {
   this->resizeClear(1, 1);
   mMat[0] = (double)X;
+  return * this;
 } // matrix::operator=(int X) ----------------------------------------------------------------------
 
 /**
  * @brief operator = - Resize itself to be a 1x1 matrix and stores the input value.
  * @param X          - The value to be stored.
+ * @return           - Returns the matrix reference of itself.
  */
-void matrix::operator=(long X) {
+matrix& matrix::operator=(long X) {
   this->resizeClear(1, 1);
   mMat[0] = (double)X;
+  return * this;
 } // matrix::operator=(long X) ---------------------------------------------------------------------
 
 /**
  * @brief operator = - Resize itself to be a 1x1 matrix and stores the input value.
  * @param X          - The value to be stored.
+ * @return           - Returns the matrix reference of itself.
  */
-void matrix::operator=(long long X) {
+matrix& matrix::operator=(long long X) {
   this->resizeClear(1, 1);
   mMat[0] = (double)X;
+  return * this;
 } // matrix::operator=(long long X) ----------------------------------------------------------------
 
 /**
  * @brief operator = - Overloaded operator to assign a matrix to itself.
  * @param X          - The matrix to copy from.
+ * @return           - Returns the matrix reference of itself.
  */
-void matrix::operator=(const matrix & X) {
+matrix& matrix::operator=(const matrix & X) {
+  if (this == &X)
+    return * this;
   if ((mRow != X.getRowSize()) || (mCol != X.getColSize()))
-    this->resizeClear(X.getRowSize(), X.getColSize());
-  memcpy(this->mMat, X.mMat, sizeof(double) * mSize);
+    this->resizeUninitialized(X.getRowSize(), X.getColSize());
+  matrixKernelsCopy(mRow, mCol, X.mMat, X.mLd, mMat, mLd);
+  return * this;
 } // matrix::operator=(const matrix & X) -----------------------------------------------------------
 
 /**
- * @brief operator << - Assigning of values into the matrix via pushing method.
- *                      Note that the first element value of the matrix will be pushed out.
- * @param X           - The value to be pushed into the last element of the matrix.
- * @return            - Returns the matrix pointer of itself.
+ * @brief operator = - Overloaded operator to move a matrix into itself. The memory of the input
+ *                     matrix is taken over without copying, leaving the input matrix empty.
+ *                     Memory from an arena scope is copied instead, unless the memory of the
+ *                     matrix comes from the same scope or a deeper one, which the memory of the
+ *                     input matrix outlives.
+ * @param X          - The matrix to move from.
+ * @return           - Returns the matrix reference of itself.
  */
-matrix& matrix::operator<<(double X) {
-  if (mSize > 0) {
-    memcpy(mMat, &mMat[1], sizeof(double) * (mSize - 1));
-    mMat[mSize - 1] = X;
+matrix& matrix::operator=(matrix && X) noexcept {
+  if (this == &X)
+    return * this;
+
+  // the memory of a scope is recycled when the scope ends, while this matrix may outlive it
+  if (matrixAllocatorGetDepth(X.mMat) > matrixAllocatorGetDepth(mMat)) {
+    this->copyOutside(X);
+    return * this;
   }
-  else
-    matrixExit("Matrix size not yet defined.");
+
+  this->release();
+  mMat = X.mMat;
+  mRow = X.mRow;
+  mCol = X.mCol;
+  mSize = X.mSize;
+  mLd = X.mLd;
+  mCapacity = X.mCapacity;
+  X.mMat = NULL;
+  X.mRow = 0;
+  X.mCol = 0;
+  X.mSize = 0;
+  X.mLd = 0;
+  X.mCapacity = 0;
   return * this;
-} // matrix& matrix::operator<<(double X) ----------------------------------------------------------
+} // matrix& matrix::operator=(matrix && X) noexcept -----------------------------------------------
 
 /**
- * @brief operator << - Assigning of values into the matrix via pushing method.
- *                      Note that the first element value of the matrix will be pushed out.
+ * @brief operator << - Assigning of values into the matrix via pushing method. Every value is
+ *                      written once through the returned initializer. The matrix ends up as if
+ *                      every value was pushed into its last element, pushing its first element out.
  * @param X           - The value to be pushed into the last element of the matrix.
- * @return            - Returns the matrix pointer of itself.
+ * @return            - Returns the initializer to push the following values with.
  */
-matrix& matrix::operator<<(float X) {
-  if (mSize > 0) {
-    memcpy(mMat, &mMat[1], sizeof(double) * (mSize - 1));
-    mMat[mSize - 1] = (double)X;
-  }
-  else
-    matrixExit("Matrix size not yet defined.");
-  return * this;
-} // matrix& matrix::operator<<(float X) -----------------------------------------------------------
+matrixInitializer matrix::operator<<(double X) {
+  matrixInitializer Z(* this);
+  Z << X;
+  return Z;
+} // matrixInitializer matrix::operator<<(double X) ------------------------------------------------
 
 /**
- * @brief operator << - Assigning of values into the matrix via pushing method.
- *                      Note that the first element value of the matrix will be pushed out.
+ * @brief operator << - Assigning of values into the matrix via pushing method. Every value is
+ *                      written once through the returned initializer. The matrix ends up as if
+ *                      every value was pushed into its last element, pushing its first element out.
  * @param X           - The value to be pushed into the last element of the matrix.
- * @return            - Returns the matrix pointer of itself.
+ * @return            - Returns the initializer to push the following values with.
  */
-matrix& matrix::operator<<(int X) {
-  if (mSize > 0) {
-    memcpy(mMat, &mMat[1], sizeof(double) * (mSize - 1));
-    mMat[mSize - 1] = (double)X;
-  }
-  else
-    matrixExit("Matrix size not yet defined.");
-  return * this;
-} // matrix& matrix::operator<<(int X) -------------------------------------------------------------
+matrixInitializer matrix::operator<<(float X) {
+  matrixInitializer Z(* this);
+  Z << (double)X;
+  return Z;
+} // matrixInitializer matrix::operator<<(float X) -------------------------------------------------
 
 /**
- * @brief operator << - Assigning of values into the matrix via pushing method.
- *                      Note that the first element value of the matrix will be pushed out.
+ * @brief operator << - Assigning of values into the matrix via pushing method. Every value is
+ *                      written once through the returned initializer. The matrix ends up as if
+ *                      every value was pushed into its last element, pushing its first element out.
  * @param X           - The value to be pushed into the last element of the matrix.
- * @return            - Returns the matrix pointer of itself.
+ * @return            - Returns the initializer to push the following values with.
  */
-matrix& matrix::operator<<(long X) {
-  if (mSize > 0) {
-    memcpy(mMat, &mMat[1], sizeof(double) * (mSize - 1));
-    mMat[mSize - 1] = (double)X;
-  }
-  else
-    matrixExit("Matrix size not yet defined.");
-  return * this;
-} // matrix& matrix::operator<<(long X) ------------------------------------------------------------
+matrixInitializer matrix::operator<<(int X) {
+  matrixInitializer Z(* this);
+  Z << (double)X;
+  return Z;
+} // matrixInitializer matrix::operator<<(int X) ---------------------------------------------------
 
 /**
- * @brief operator << - Assigning of values into the matrix via pushing method.
- *                      Note that the first element value of the matrix will be pushed out.
+ * @brief operator << - Assigning of values into the matrix via pushing method. Every value is
+ *                      written once through the returned initializer. The matrix ends up as if
+ *                      every value was pushed into its last element, pushing its first element out.
  * @param X           - The value to be pushed into the last element of the matrix.
- * @return            - Returns the matrix pointer of itself.
+ * @return            - Returns the initializer to push the following values with.
  */
-matrix& matrix::operator<<(long long X) {
-  if (mSize > 0) {
-    memcpy(mMat, &mMat[1], sizeof(double) * (mSize - 1));
-    mMat[mSize - 1] = (double)X;
-  }
-  else
-    matrixExit("Matrix size not yet defined.");
-  return * this;
-} // matrix& matrix::operator<<(long long X) -------------------------------------------------------
+matrixInitializer matrix::operator<<(long X) {
+  matrixInitializer Z(* this);
+  Z << (double)X;
+  return Z;
+} // matrixInitializer matrix::operator<<(long X) --------------------------------------------------
+
+/**
+ * @brief operator << - Assigning of values into the matrix via pushing method. Every value is
+ *                      written once through the returned initializer. The matrix ends up as if
+ *                      every value was pushed into its last element, pushing its first element out.
+ * @param X           - The value to be pushed into the last element of the matrix.
+ * @return            - Returns the initializer to push the following values with.
+ */
+matrixInitializer matrix::operator<<(long long X) {
+  matrixInitializer Z(* this);
+  Z << (double)X;
+  return Z;
+} // matrixInitializer matrix::operator<<(long long X) ---------------------------------------------
 
 /**
  * @brief operator() - Return the value stored in the element defined by the input arguments.
@@ -234,7 +484,7 @@ matrix& matrix::operator<<(long long X) {
  * @return           - Returns the stored value.
  */
 double& matrix::operator()(unsigned long rowIndex, unsigned long colIndex) const {
-  return mMat[--rowIndex * mCol + --colIndex];
+  return mMat[--rowIndex * mLd + --colIndex];
 } // matrix::operator()(unsigned long rowIndex, unsigned long colIndex) const ----------------------
 
 /**
@@ -254,16 +504,7 @@ void matrix::operator()(unsigned long startRow, unsigned long startCol, const ma
   if ((startCol + X.getColSize() - 1) > mCol)
     matrixExit("The sub matrix column size exceeds the main matrix column size.");
 
-  unsigned long rowIndex = (startRow - 1) * mCol;
-  unsigned long XRowIndex = 0;
-
-  for (unsigned long i = 0; i < X.getRowSize(); i++) {
-    for (unsigned long j = 0; j < X.getColSize(); j++) {
-      mMat[rowIndex + startCol + j - 1] = X.mMat[XRowIndex + j];
-    }
-    rowIndex += mCol;
-    XRowIndex += X.getColSize();
-  }
+  matrixKernelsCopy(X.mRow, X.mCol, X.mMat, X.mLd, &mMat[(startRow - 1) * mLd + startCol - 1], mLd);
 } // matrix::operator()(unsigned long startRow, unsigned long startCol, const matrix & X) ----------
 
 /**
@@ -274,54 +515,73 @@ void matrix::operator()(unsigned long startRow, unsigned long startCol, const ma
  * @param endCol     - End column index of the submatrix.
  * @return           - Returns the submatrix.
  */
-matrix matrix::operator()(unsigned long startRow, unsigned long endRow, unsigned long startCol, unsigned long endCol) {
-  if (startRow == 0)
-    matrixExit("Matrix start row index should be greater than 0.");
-  if (endRow == 0)
-    matrixExit("Matrix end row index should be greater than 0.");
-  if (startRow > mRow)
-    matrixExit("Matrix start row index exceeds matrix row size.");
-  if (endRow > mRow)
-    matrixExit("Matrix end row index exceeds matrix row size.");
-  if (startRow > endRow)
-    matrixExit("Matrix start row index exceeds matrix end row index.");
-  if (startCol > mCol)
-    matrixExit("Matrix start column index exceeds matrix column size.");
-  if (endCol > mCol)
-    matrixExit("Matrix end column index exceeds matrix column size.");
-  if (startCol > endCol)
-    matrixExit("Matrix start column index exceeds matrix end column index.");
-
-  unsigned long rowLength = endRow - startRow + 1;
-  unsigned long colLength = endCol - startCol + 1;
-  unsigned long rowIndex = (startRow - 1) * mCol;
-  unsigned long XRowIndex = 0;
-
-  matrix Z(rowLength, colLength);
-  for (unsigned long i = 0; i < rowLength; i++) {
-    for (unsigned long j = 0; j < colLength; j++)
-      Z.mMat[XRowIndex + j] = mMat[rowIndex + startCol + j - 1];
-    rowIndex += mCol;
-    XRowIndex += colLength;
+matrix matrix::operator()(unsigned long startRow, unsigned long endRow, unsigned long startCol, unsigned long endCol) const {
+  return this->view(startRow, endRow, startCol, endCol);
+} // matrix::operator()(unsigned long startRow, unsigned long endRow, unsigned long startCol, unsigned long endCol) const
+
+/**
+ * @brief assign - Copies values into the elements of the matrix, in row-major order from the first
+ *                 element. The elements after the last value are left unchanged.
+ * @param X      - Pointer to the values.
+ * @param n      - Number of values, no more than the size of the matrix.
+ */
+void matrix::assign(const double * X, unsigned long n) {
+  if (n > mSize)
+    matrixExit("Matrices size mismatch.");
+
+  if (mLd == mCol) {
+    memcpy(mMat, X, sizeof(double) * n);
+    return;
   }
+  for (unsigned long i = 0; n > 0; i++) {
+    unsigned long count = (n < mCol) ? n : mCol;
+    memcpy(&mMat[i * mLd], X, sizeof(double) * count);
+    X += count;
+    n -= count;
+  }
+} // matrix::assign(const double * X, unsigned long n) ---------------------------------------------
 
-  return Z;
-} // matrix::operator()(unsigned long startRow, unsigned long endRow, unsigned long startCol, unsigned long endCol)
+/**
+ * @brief assign - Copies a list of values into the elements of the matrix, in row-major order from
+ *                 the first element. The elements after the last value are left unchanged.
+ * @param X      - The values, no more than the size of the matrix.
+ */
+void matrix::assign(std::initializer_list<double> X) {
+  this->assign(X.begin(), (unsigned long)X.size());
+} // matrix::assign(std::initializer_list<double> X) -----------------------------------------------
 
 /**
  * @brief clear - Clears all the matrix elements to zero.
  */
 void matrix::clear(void) {
-  memset(mMat, 0, sizeof(double) * mSize);
+  if (mMat != NULL)
+    memset(mMat, 0, sizeof(double) * mRow * mLd);
 } // matrix::clear(void) ---------------------------------------------------------------------------
 
+/**
+ * @brief getCapacity - Returns the number of elements, including the padding of the rows, that the
+ *                      memory of the matrix can hold.
+ * @return            - Capacity of the matrix.
+ */
+unsigned long matrix::getCapacity(void) const {
+  return mCapacity;
+} // unsigned long matrix::getCapacity(void) const -------------------------------------------------
+
 /**
  * @brief getColSize - Returns the column size of the matrix.
  * @return           - Column size of the matrix.
  */
 unsigned long matrix::getColSize(void) const {
   return mCol;
-} // matrix::getColSize(void) ----------------------------------------------------------------------
+} // unsigned long matrix::getColSize(void) const --------------------------------------------------
+
+/**
+ * @brief getLd - Returns the leading dimension (row stride) of the matrix.
+ * @return      - Leading dimension of the matrix.
+ */
+unsigned long matrix::getLd(void) const {
+  return mLd;
+} // unsigned long matrix::getLd(void) const -------------------------------------------------------
 
 /**
  * @brief getRowSize - Returns the row size of the matrix.
@@ -329,7 +589,7 @@ unsigned long matrix::getColSize(void) const {
  */
 unsigned long matrix::getRowSize(void) const {
   return mRow;
-} // matrix::getRowSize(void) ----------------------------------------------------------------------
+} // unsigned long matrix::getRowSize(void) const --------------------------------------------------
 
 /**
  * @brief getSize - Returns the total number of elements in the matrix.
@@ -337,7 +597,25 @@ unsigned long matrix::getRowSize(void) const {
  */
 unsigned long matrix::getSize(void) const {
   return mSize;
-} // matrix::getSize(void) -------------------------------------------------------------------------
+} // unsigned long matrix::getSize(void) const -----------------------------------------------------
+
+/**
+ * @brief reserve  - Increases the capacity of the matrix to at least the input number of elements.
+ *                   The existing elements are retained.
+ * @param capacity - Number of elements, including the padding of the rows.
+ */
+void matrix::reserve(unsigned long capacity) {
+  if (capacity <= mCapacity)
+    return;
+
+  double * mat = matrixAllocatorMalloc(sizeof(double) * capacity);
+  if (mMat != NULL) {
+    memcpy(mat, mMat, sizeof(double) * mRow * mLd);
+    matrixAllocatorFree(mMat);
+  }
+  mMat = mat;
+  mCapacity = capacity;
+} // void matrix::reserve(unsigned long capacity) --------------------------------------------------
 
 /**
  * @brief resizeClear - Resize the matrix to a new dimension with all existing elements cleared.
@@ -345,7 +623,6 @@ unsigned long matrix::getSize(void) const {
  * @param col         - Column size of the resize matrix.
  */
 void matrix::resizeClear(unsigned long row, unsigned long col) {
-  this->release();
   this->create(row, col);
 } // matrix::resizeClear(unsigned long row, unsigned long col) -------------------------------------
 
@@ -359,19 +636,221 @@ void matrix::resizeClear(unsigned long row, unsigned long col) {
  * @param col          - Column size of the resize matrix.
  */
 void matrix::resizeRetain(unsigned long row, unsigned long col) {
-  matrix t(mRow, mCol);
-  memcpy(t.mMat, mMat, sizeof(double) * mSize);
+  unsigned long rowSize = mRow > row ? row : mRow;
+  unsigned long colSize = mCol > col ? col : mCol;
+  unsigned long ld = matrixLeadingDimension(col);
+
+  if ((row * ld > mCapacity) || (mMat == NULL)) {
+    matrix t(std::move(* this));
+    this->create(row, col);
+    if ((rowSize > 0) && (colSize > 0))
+      this->view(1, rowSize, 1, colSize) = t.view(1, rowSize, 1, colSize);
+    return;
+  }
 
-  this->release();
-  this->create(row, col);
+  // the new dimension fits in the capacity, move the rows in place. Rows move towards the start of
+  // the memory when the leading dimension shrinks, and towards the end when it grows, so that no
+  // row is overwritten before it is moved.
+  for (unsigned long n = 0; n < rowSize; n++) {
+    unsigned long i = (ld <= mLd) ? n : rowSize - 1 - n;
+    memmove(&mMat[i * ld], &mMat[i * mLd], sizeof(double) * colSize);
+    memset(&mMat[i * ld + colSize], 0, sizeof(double) * (ld - colSize));
+  }
+  if (row > rowSize)
+    memset(&mMat[rowSize * ld], 0, sizeof(double) * (row - rowSize) * ld);
+  this->allocate(row, col);
+} // matrix::resizeRetain(unsigned long row, unsigned long col) ------------------------------------
+
+/**
+ * @brief resizeUninitialized - Resize the matrix to a new dimension without initialising the
+ *                              elements. To be used when every element is to be overwritten right
+ *                              after.
+ * @param row                 - Row size of the resize matrix.
+ * @param col                 - Column size of the resize matrix.
+ */
+void matrix::resizeUninitialized(unsigned long row, unsigned long col) {
+  this->allocate(row, col);
+} // void matrix::resizeUninitialized(unsigned long row, unsigned long col) ------------------------
+
+/**
+ * @brief shrinkToFit - Reduces the capacity of the matrix to its current size. The existing
+ *                      elements are retained.
+ */
+void matrix::shrinkToFit(void) {
+  unsigned long capacity = mRow * mLd;
+  if (capacity >= mCapacity)
+    return;
+
+  double * mat = (capacity > 0) ? matrixAllocatorMalloc(sizeof(double) * capacity) : NULL;
+  if (capacity > 0)
+    memcpy(mat, mMat, sizeof(double) * capacity);
+  matrixAllocatorFree(mMat);
+  mMat = mat;
+  mCapacity = capacity;
+} // void matrix::shrinkToFit(void) ----------------------------------------------------------------
+
+/**
+ * @brief transpose - Transposes the matrix in place. Square matrices and vectors are transposed
+ *                    within their own memory, other matrices through a new allocation.
+ */
+void matrix::transpose(void) {
+  if (mRow == mCol) {
+    matrixKernelsTransposeSquare(mRow, mMat, mLd);
+    return;
+  }
+
+  // the elements of a vector are laid out the same way as the ones of its transpose, only the
+  // leading dimension changes
+  unsigned long ld = matrixLeadingDimension(mRow);
+  if (((mRow == 1) || (mCol == 1)) && (mCol * ld <= mCapacity)) {
+    std::swap(mRow, mCol);
+    mLd = ld;
+    return;
+  }
 
-  matrix a = t(1, t.getRowSize() > row ? row : t.getRowSize(), 1, t.getColSize() > col ? col : t.getColSize());
-  this->operator ()(1, 1, a);
-} // matrix::resizeRetain(unsigned long row, unsigned long col)  -----------------------------------
+  matrix Z(mCol, mRow, matrixUninitialized);
+  matrixKernelsTranspose(mRow, mCol, mMat, mLd, Z.mMat, Z.mLd);
+  * this = std::move(Z);
+} // void matrix::transpose(void) ------------------------------------------------------------------
+
+/**
+ * @brief view - Returns a view of the whole matrix. No element is copied.
+ * @return     - Returns the view of the matrix.
+ */
+matrixView matrix::view(void) const {
+  return matrixView(* this);
+} // matrix::view(void) const ----------------------------------------------------------------------
+
+/**
+ * @brief view     - Returns a view of the submatrix defined by the input arguments. No element is
+ *                   copied, and writing through the view changes the matrix.
+ * @param startRow - Start row index of the submatrix.
+ * @param endRow   - End row index of the submatrix.
+ * @param startCol - Start column index of the submatrix.
+ * @param endCol   - End column index of the submatrix.
+ * @return         - Returns the view of the submatrix.
+ */
+matrixView matrix::view(unsigned long startRow, unsigned long endRow, unsigned long startCol, unsigned long endCol) const {
+  return matrixView(* this).view(startRow, endRow, startCol, endCol);
+} // matrix::view(unsigned long startRow, unsigned long endRow, unsigned long startCol, unsigned long endCol) const
+
+/**
+ * @brief matrixInitializer - Constructor to push values into a matrix, starting at its first
+ *                            element.
+ * @param X                 - The matrix to push the values into.
+ */
+matrixInitializer::matrixInitializer(matrix & X) : mX(&X), mCount(0), mRowIndex(0), mColIndex(0) {
+  if (X.getSize() == 0)
+    matrixExit("Matrix size not yet defined.");
+} // matrixInitializer::matrixInitializer(matrix & X) ----------------------------------------------
+
+/**
+ * @brief matrixInitializer - Overloaded move constructor. The input initializer no longer pushes
+ *                            into the matrix.
+ * @param X                 - Initializer to be moved.
+ */
+matrixInitializer::matrixInitializer(matrixInitializer && X) noexcept
+  : mX(X.mX), mCount(X.mCount), mRowIndex(X.mRowIndex), mColIndex(X.mColIndex) {
+  X.mX = NULL;
+} // matrixInitializer::matrixInitializer(matrixInitializer && X) noexcept -------------------------
+
+/**
+ * @brief ~matrixInitializer - Destructor. When fewer values than the size of the matrix were
+ *                             pushed, or the pushes wrapped around, the elements are rotated so
+ *                             that the last pushed value ends up in the last element.
+ */
+matrixInitializer::~matrixInitializer() {
+  if (mX == NULL)
+    return;
+
+  // the values were written cyclically from the first element, so the oldest element is found at
+  // the position following the last written value
+  unsigned long shift = mCount % mX->getSize();
+  if (shift == 0)
+    return;
+
+  if (mX->getLd() == mX->getColSize())
+    std::rotate(mX->mMat, &mX->mMat[shift], &mX->mMat[mX->getSize()]);
+  else {
+    double * T = matrixAllocatorMalloc(sizeof(double) * mX->getSize());
+    matrixKernelsCopy(mX->getRowSize(), mX->getColSize(), mX->mMat, mX->getLd(), T, mX->getColSize());
+    std::rotate(T, &T[shift], &T[mX->getSize()]);
+    matrixKernelsCopy(mX->getRowSize(), mX->getColSize(), T, mX->getColSize(), mX->mMat, mX->getLd());
+    matrixAllocatorFree(T);
+  }
+} // matrixInitializer::~matrixInitializer() -------------------------------------------------------
+
+/**
+ * @brief operator << - Pushes a value into the next element of the matrix.
+ * @param X           - The value to be pushed.
+ * @return            - Returns the initializer reference of itself.
+ */
+matrixInitializer& matrixInitializer::operator<<(double X) {
+  mX->mMat[mRowIndex * mX->getLd() + mColIndex] = X;
+  mCount++;
+  if (++mColIndex == mX->getColSize()) {
+    mColIndex = 0;
+    if (++mRowIndex == mX->getRowSize())
+      mRowIndex = 0;
+  }
+  return * this;
+} // matrixInitializer::operator<<(double X) -------------------------------------------------------
+
+/**
+ * @brief operator , - Pushes a value into the next element of the matrix.
+ * @param X          - The value to be pushed.
+ * @return           - Returns the initializer reference of itself.
+ */
+matrixInitializer& matrixInitializer::operator,(double X) {
+  return * this << X;
+} // matrixInitializer::operator,(double X) --------------------------------------------------------
 
 /// ================================================================================================
 /// PRIVATE FUNCTIONS
 /// ================================================================================================
+/**
+ * @brief allocate - Sets the dimension of the matrix, reusing its memory when the new dimension
+ *                   fits in the capacity. The elements are not initialised unless requested.
+ *                   Large new memory is cleared lazily by the operating system.
+ * @param row      - Row size of the matrix.
+ * @param col      - Column size of the matrix.
+ * @param zero     - 1 to clear the elements to zero, 0 to leave them uninitialised.
+ */
+void matrix::allocate(unsigned long row, unsigned long col, unsigned char zero) {
+  mRow = row;
+  mCol = col;
+  mSize = row * col;
+  mLd = matrixLeadingDimension(col);
+
+  if (row * mLd > mCapacity) {
+    matrixAllocatorFree(mMat);
+    mCapacity = row * mLd;
+    mMat = (zero != 0) ? matrixAllocatorCalloc(sizeof(double) * mCapacity)
+                       : matrixAllocatorMalloc(sizeof(double) * mCapacity);
+  }
+  else if (zero != 0)
+    this->clear();
+} // matrix::allocate(unsigned long row, unsigned long col, unsigned char zero) --------------------
+
+/**
+ * @brief copyOutside - Copies a matrix into itself, in its own memory when it fits, otherwise in
+ *                      memory allocated outside of any arena scope, which can outlive the active
+ *                      scope.
+ * @param X           - The matrix to copy from.
+ */
+void matrix::copyOutside(const matrix & X) {
+  mRow = X.mRow;
+  mCol = X.mCol;
+  mSize = X.mSize;
+  mLd = matrixLeadingDimension(mCol);
+  if (mRow * mLd > mCapacity) {
+    matrixAllocatorFree(mMat);
+    mCapacity = mRow * mLd;
+    mMat = matrixAllocatorMallocOutside(sizeof(double) * mCapacity);
+  }
+  matrixKernelsCopy(mRow, mCol, X.mMat, X.mLd, mMat, mLd);
+} // void matrix::copyOutside(const matrix & X) ----------------------------------------------------
+
 /**
  * @brief create - Creates a square matrix.
  * @param size   - Size of the square matrix.
@@ -386,11 +865,7 @@ void matrix::create(unsigned long size) {
  * @param col    - Column size of the matrix.
  */
 void matrix::create(unsigned long row, unsigned long col) {
-  mRow = row;
-  mCol = col;
-  mSize = row * col;
-  mMat = (double *)malloc(sizeof(double) * mSize);
-  clear();
+  this->allocate(row, col, 1);
 } // matrix::create(unsigned long row, unsigned long col) ------------------------------------------
 
 /**
@@ -398,88 +873,59 @@ void matrix::create(unsigned long row, unsigned long col) {
  */
 void matrix::release(void) {
   if (mMat != NULL) {
-    free(mMat);
+    matrixAllocatorFree(mMat);
     mMat = NULL;
   }
   mRow = 0;
   mCol = 0;
   mSize = 0;
+  mLd = 0;
+  mCapacity = 0;
 } // matrix::release(void) -------------------------------------------------------------------------
 
 /// ================================================================================================
 /// EXTERNAL FUNCTIONS
 /// ================================================================================================
 /**
- * @brief operator + - Overloading of the addition operatior between a matrix and a double type value.
+ * @brief operator + - Overloading of the addition operatior between a temporary matrix and a double
+ *                     type value. The result is computed in the memory of the temporary matrix.
  * @param X          - Main matrix for addition.
  * @param Y          - Addition value.
  * @return           - The resultant matrix.
  */
-matrix operator+(const matrix & X, const double & Y) {
-  matrix Z(X.getRowSize(), X.getColSize());
-  for (unsigned long i = 0; i < X.getSize(); i++)
-    Z.mMat[i] = X.mMat[i] + Y;
-  return Z;
-} // operator+(const matrix & X, const double & Y) -------------------------------------------------
+matrix operator+(matrix && X, const double & Y) {
+  matrixKernelsApplyScalar(matrixSimd().addScalar, X.getRowSize(), X.getColSize(),
+                           X.mMat, X.getLd(), Y, X.mMat, X.getLd());
+  return std::move(X);
+} // operator+(matrix && X, const double & Y) ------------------------------------------------------
 
 /**
- * @brief operator + - Overloading of the addition operatior between two matrices.
- * @param X          - Main matrix for addition.
- * @param Y          - Addition matrix.
- * @return           - The resultant matrix.
- */
-matrix operator+(const matrix & X, const matrix & Y) {
-  matrix Z;
-  if (matrixCheckIsEqualSize(X, Y)) {
-    Z.resizeClear(X.getRowSize(), X.getColSize());
-    for (unsigned long i = 0; i < X.getSize(); i++)
-      Z.mMat[i] = X.mMat[i] + Y.mMat[i];
-  }
-  return Z;
-} // operator+(const matrix & X, const matrix & Y) -------------------------------------------------
-
-/**
- * @brief operator - - Overloading of the subtraction operatior between a matrix and a double type
- *                     value.
+ * @brief operator - - Overloading of the subtraction operatior between a temporary matrix and a
+ *                     double type value. The result is computed in the memory of the temporary
+ *                     matrix.
  * @param X          - Main matrix for subtraction.
  * @param Y          - Subtraction value.
  * @return           - The resultant matrix.
  */
-matrix operator-(const matrix & X, const double & Y) {
-  matrix Z(X.getRowSize(), X.getColSize());
-  for (unsigned long i = 0; i < X.getSize(); i++)
-    Z.mMat[i] = X.mMat[i] - Y;
-  return Z;
-} // operator-(const matrix & X, const double & Y) -------------------------------------------------
-
-/**
- * @brief operator - - Overloading of the subtraction operatior between two matrices.
- * @param X          - Main matrix for subtraction.
- * @param Y          - Subtraction matrix.
- * @return           - The resultant matrix.
- */
-matrix operator-(const matrix & X, const matrix & Y) {
-  matrix Z;
-  if (matrixCheckIsEqualSize(X, Y)) {
-    Z.resizeClear(X.getRowSize(), X.getColSize());
-    for (unsigned long i = 0; i < X.getSize(); i++)
-      Z.mMat[i] = X.mMat[i] - Y.mMat[i];
-  }
-  return Z;
-} // operator-(const matrix & X, const matrix & Y) -------------------------------------------------
+matrix operator-(matrix && X, const double & Y) {
+  matrixKernelsApplyScalar(matrixSimd().subtractScalar, X.getRowSize(), X.getColSize(),
+                           X.mMat, X.getLd(), Y, X.mMat, X.getLd());
+  return std::move(X);
+} // operator-(matrix && X, const double & Y) ------------------------------------------------------
 
 /**
- * @brief operator * - Overloading of the multiplication operatior between a matrix and a double type value.
+ * @brief operator * - Overloading of the multiplication operatior between a temporary matrix and a
+ *                     double type value. The result is computed in the memory of the temporary
+ *                     matrix.
  * @param X          - Main matrix for multiplication.
  * @param Y          - Multiplication value.
  * @return           - The resultant matrix.
  */
-matrix operator*(const matrix & X, const double & Y) {
-  matrix Z(X.getRowSize(), X.getColSize());
-  for (unsigned long i = 0; i < X.getSize(); i++)
-    Z.mMat[i] = X.mMat[i] * Y;
-  return Z;
-} // operator*(const matrix & X, const double & Y) -------------------------------------------------
+matrix operator*(matrix && X, const double & Y) {
+  matrixKernelsApplyScalar(matrixSimd().multiplyScalar, X.getRowSize(), X.getColSize(),
+                           X.mMat, X.getLd(), Y, X.mMat, X.getLd());
+  return std::move(X);
+} // operator*(matrix && X, const double & Y) ------------------------------------------------------
 
 /**
  * @brief operator * - Overloading of the multiplication operatior between two matrices.
@@ -488,57 +934,31 @@ matrix operator*(const matrix & X, const double & Y) {
  * @return           - The resultant matrix.
  */
 matrix operator*(const matrix & X, const matrix & Y) {
-  matrix Z;
-  if (matrixCheckIsEqualInnerSize(X, Y)) {
-    Z.resizeClear(X.getRowSize(), Y.getColSize());
-    double sum = 0.0;
-    unsigned long XRowIndex = 0;
-    unsigned long YRowIndex = 0;
-    unsigned long ZRowIndex = 0;
-
-    for (unsigned long i = 0; i < X.getRowSize(); i++) {
-      for (unsigned long j = 0; j < Y.getColSize(); j++) {
-        sum = 0.0;
-        YRowIndex = 0;
-        for (unsigned long k = 0; k < X.getColSize(); k++) {
-          sum += X.mMat[XRowIndex + k] * Y.mMat[YRowIndex + j];
-          YRowIndex += Y.getColSize();
-        }
-        Z.mMat[ZRowIndex + j] = sum;
-      }
-      XRowIndex += X.getColSize();
-      ZRowIndex += Y.getColSize();
-    }
-  }
-  return Z;
+  return matrixView(X) * matrixView(Y);
 } // operator*(const matrix & X, const matrix & Y) -------------------------------------------------
 
 /**
- * @brief operator / - Overloading of the division operatior between a matrix and a double type
- *                     value.
+ * @brief operator / - Overloading of the division operatior between a temporary matrix and a double
+ *                     type value. The result is computed in the memory of the temporary matrix.
  * @param X          - Main matrix for division.
  * @param Y          - Division value.
  * @return           - The resultant matrix.
  */
-matrix operator/(const matrix & X, const double & Y) {
-  matrix Z(X.getRowSize(), X.getColSize());
-  for (unsigned long i = 0; i < X.getSize(); i++)
-    Z.mMat[i] = X.mMat[i] / Y;
-  return Z;
-} // operator/(const matrix & X, const double & Y) -------------------------------------------------
+matrix operator/(matrix && X, const double & Y) {
+  matrixKernelsApplyScalar(matrixSimd().divideScalar, X.getRowSize(), X.getColSize(),
+                           X.mMat, X.getLd(), Y, X.mMat, X.getLd());
+  return std::move(X);
+} // operator/(matrix && X, const double & Y) ------------------------------------------------------
 
 /**
- * @brief operator / - Overloading of the division operatior between two matrices.
+ * @brief operator / - Overloading of the division operatior between two matrices, X * Y^-1. The
+ *                     result is solved by "matrixSolveRight()" without forming the inverse.
  * @param X          - Main matrix for division.
  * @param Y          - Division matrix.
  * @return           - The resultant matrix.
  */
 matrix operator/(const matrix & X, const matrix & Y) {
-  matrix Z;
-  if (matrixCheckIsEqualInnerSize(X, Y) && matrixCheckIsSquare(Y)) {
-    Z = X * matrixInverse(Y);
-  }
-  return Z;
+  return matrixSolveRight(Y, X);
 } // operator/(const matrix & X, const matrix & Y) -------------------------------------------------
 
 /**
@@ -548,8 +968,8 @@ matrix operator/(const matrix & X, const matrix & Y) {
  * @param Y           - Addition value.
  */
 void operator+=(matrix & X, const double & Y) {
-  for (unsigned long i = 0; i < X.getSize(); i++)
-    X.mMat[i] += Y;
+  matrixKernelsApplyScalar(matrixSimd().addScalar, X.getRowSize(), X.getColSize(),
+                           X.mMat, X.getLd(), Y, X.mMat, X.getLd());
 } // operator+=(matrix & X, const double & Y) ------------------------------------------------------
 
 /**
@@ -559,8 +979,8 @@ void operator+=(matrix & X, const double & Y) {
  */
 void operator+=(matrix & X, const matrix & Y) {
   if (matrixCheckIsEqualSize(X, Y)) {
-    for (unsigned long i = 0; i < X.getSize(); i++)
-      X.mMat[i] += Y.mMat[i];
+    matrixKernelsApply(matrixSimd().add, X.getRowSize(), X.getColSize(),
+                       X.mMat, X.getLd(), Y.mMat, Y.getLd(), X.mMat, X.getLd());
   }
 } // operator+=(matrix & X, const matrix & Y) ------------------------------------------------------
 
@@ -571,8 +991,8 @@ void operator+=(matrix & X, const matrix & Y) {
  * @param Y           - Subtraction value.
  */
 void operator-=(matrix & X, const double & Y) {
-  for (unsigned long i = 0; i < X.getSize(); i++)
-    X.mMat[i] -= Y;
+  matrixKernelsApplyScalar(matrixSimd().subtractScalar, X.getRowSize(), X.getColSize(),
+                           X.mMat, X.getLd(), Y, X.mMat, X.getLd());
 } // operator-=(matrix & X, const double & Y) ------------------------------------------------------
 
 /**
@@ -582,8 +1002,8 @@ void operator-=(matrix & X, const double & Y) {
  */
 void operator-=(matrix & X, const matrix & Y) {
   if (matrixCheckIsEqualSize(X, Y)) {
-    for (unsigned long i = 0; i < X.getSize(); i++)
-      X.mMat[i] -= Y.mMat[i];
+    matrixKernelsApply(matrixSimd().subtract, X.getRowSize(), X.getColSize(),
+                       X.mMat, X.getLd(), Y.mMat, Y.getLd(), X.mMat, X.getLd());
   }
 } // operator-=(matrix & X, const matrix & Y) ------------------------------------------------------
 
@@ -594,8 +1014,8 @@ void operator-=(matrix & X, const matrix & Y) {
  * @param Y           - Multiplication value.
  */
 void operator*=(matrix & X, const double & Y) {
-  for (unsigned long i = 0; i < X.getSize(); i++)
-    X.mMat[i] *= Y;
+  matrixKernelsApplyScalar(matrixSimd().multiplyScalar, X.getRowSize(), X.getColSize(),
+                           X.mMat, X.getLd(), Y, X.mMat, X.getLd());
 } // operator*=(matrix & X, const double & Y) ------------------------------------------------------
 
 /**
@@ -605,8 +1025,8 @@ void operator*=(matrix & X, const double & Y) {
  * @param Y           - Division value.
  */
 void operator/=(matrix & X, const double & Y) {
-  for (unsigned long i = 0; i < X.getSize(); i++)
-    X.mMat[i] /= Y;
+  matrixKernelsApplyScalar(matrixSimd().divideScalar, X.getRowSize(), X.getColSize(),
+                           X.mMat, X.getLd(), Y, X.mMat, X.getLd());
 } // operator/=(matrix & X, const double & Y) ------------------------------------------------------
 
 /**
@@ -654,8 +1074,8 @@ unsigned char matrixCheckIsSquare(const matrix & X) {
  */
 matrix matrixIdentity(unsigned long size) {
   matrix Z(size, size);
-  for (unsigned long i = 0; i < Z.getSize(); i = i + size + 1)
-    Z.mMat[i] = 1;
+  for (unsigned long i = 0; i < size; i++)
+    Z.mMat[i * Z.getLd() + i] = 1;
   return Z;
 } // matrix matrixIdentity(unsigned long size) -----------------------------------------------------
 
@@ -666,52 +1086,65 @@ matrix matrixIdentity(unsigned long size) {
  * @return               - The identity matrix.
  */
 matrix matrixIdentity(unsigned long row, unsigned long col) {
-  unsigned long size = row < col ? row * col : col * col;
+  unsigned long size = row < col ? row : col;
   matrix Z(row, col);
-  for (unsigned long i = 0; i < size; i = i + col + 1)
-    Z.mMat[i] = 1;
+  for (unsigned long i = 0; i < size; i++)
+    Z.mMat[i * Z.getLd() + i] = 1;
   return Z;
 } // matrix matrixIdentity(unsigned long row, unsigned long col) -----------------------------------
 
 /**
- * @brief matrixInverse - Compute the inverse of a square matrix by linear row reduction method.
+ * @brief matrixInverse - Compute the inverse of a square matrix from its LU factorization with
+ *                        partial pivoting, P * X = L * U. The factorization is done in place in a
+ *                        copy of X, and the inverse is solved from it with the identity as the
+ *                        right-hand sides. If the matrix is singular, every element of the result
+ *                        is NaN.
  * @param X             - Matrix whose inverse is to be calculated.
+ * @param status        - Optional report of the singularity and conditioning of X.
  * @return              - Resultant matrix.
  */
-matrix matrixInverse(const matrix & X) {
-  matrix m = matrixIdentity(X.getRowSize(), X.getColSize());
-
-  if (matrixCheckIsSquare(X)) {
-    matrix a = X;
-    unsigned long i, j;
-    unsigned long size = X.getColSize();
-    for (i = 1; i <= size; i++) {             // the variable i defines the row/column in focus
-      for (j = 1; j <= size; j++) {
-        double divider = a(j, i);
-        // make the matrix element of the focus row and focused column to be of value 1.
-        // correspondingly compute the M matrix value
-        a(j, 1, a(j, j, 1, size) / divider);
-        m(j, 1, m(j, j, 1, size) / divider);
-      }
-      for (j = 1; j <= size; j++) {
-        if (i != j) {
-          // subtract non-focus rows with focus row such that the focus columns of non-focus row will
-          // be zeros. correspondingly compute the M matrix value
-          a(j, 1, a(j, j, 1, size) - a(i, i, 1, size));
-          m(j, 1, m(j, j, 1, size) - m(i, i, 1, size));
-        }
-      }
-    }
-
-    for (i = 1; i <= size; i++) {
-      // divided the focus row of M matrix by the corresponding A matrix diagonal to complete
-      // computation of the inverse matrix.
-      double divider = a(i, i);
-      m(i, 1, m(i, i, 1, size) / divider);
+matrix matrixInverse(const matrix & X, matrixStatus * status) {
+  matrixCheckIsSquare(X);
+  unsigned long size = X.getRowSize();
+  matrix Z = matrixIdentity(size);
+  unsigned long pivot = matrixSolveLU(X, false, Z, NULL);
+
+  // the condition number is exact here, from the inverse itself
+  if (status != NULL) {
+    status->singular = pivot != 0;
+    status->pivot = pivot;
+    status->rcond = 0.0;
+    if ((pivot == 0) && (size > 0)) {
+      double norm = matrixLapackNorm1(size, size, X.mMat, X.getLd());
+      double normInverse = matrixLapackNorm1(size, size, Z.mMat, Z.getLd());
+      if ((norm > 0.0) && (normInverse > 0.0))
+        status->rcond = 1.0 / (norm * normInverse);
     }
   }
-  return m;
-} // matrix matrixInverse(const matrix & X) --------------------------------------------------------
+  return Z;
+} // matrix matrixInverse(const matrix & X, matrixStatus * status) ---------------------------------
+
+/**
+ * @brief matrixLeadingDimension - Determines the leading dimension (row stride) of a new matrix.
+ *                                 When padding is enabled, rows of at least
+ *                                 MATRIXLIBRARY_PADDING_MIN_COL elements are padded to a multiple
+ *                                 of the alignment, and a row stride that is a multiple of 4096
+ *                                 bytes is padded further by one alignment unit, so that
+ *                                 consecutive rows do not map to the same cache sets.
+ * @param col                    - Column size of the matrix.
+ * @param elementSize            - Size of an element in bytes.
+ * @return                       - Leading dimension of the matrix.
+ */
+unsigned long matrixLeadingDimension(unsigned long col, unsigned long elementSize) {
+  const unsigned long unit = MATRIXLIBRARY_ALIGNMENT / elementSize;
+  if ((matrixPaddingEnabled == 0) || (col < MATRIXLIBRARY_PADDING_MIN_COL))
+    return col;
+
+  unsigned long ld = (col + unit - 1) / unit * unit;
+  if ((ld * elementSize) % 4096 == 0)
+    ld += unit;
+  return ld;
+} // unsigned long matrixLeadingDimension(unsigned long col, unsigned long elementSize) ------------
 
 /**
  * @brief matrixPrint - Print the size information and values of each element in the matrix.
@@ -719,35 +1152,85 @@ matrix matrixInverse(const matrix & X) {
  * @param msg         - Message to be print along with the abovementioned information.
  */
 void matrixPrint(const matrix & X, const char * msg) {
-  unsigned long colCount = 0;
-
   if (msg[0] != 0)
     printf("%s[%ldx%ld]:\n", msg, X.getRowSize(), X.getColSize());
 
-  for (unsigned short i = 0; i < X.getSize(); i++) {
-    if (colCount == X.getColSize()) {
-      colCount = 0;
+  for (unsigned long i = 0; i < X.getRowSize(); i++) {
+    if (i > 0)
       printf("\n");
-    }
-    printf("%18.15f ", X.mMat[i]);
-
-    colCount++;
+    for (unsigned long j = 0; j < X.getColSize(); j++)
+      printf("%18.15f ", X.mMat[i * X.getLd() + j]);
   }
   printf("\n\n");
 } // matrixPrint(const matrix & X, const char * msg) -----------------------------------------------
 
+/**
+ * @brief matrixSetPadding - Enables or disables the padding of the leading dimension of matrices
+ *                           created afterwards. Existing matrices are not affected.
+ * @param enable           - 1 to enable and 0 to disable the padding.
+ * @return                 - The previous setting.
+ */
+unsigned char matrixSetPadding(unsigned char enable) {
+  unsigned char previous = matrixPaddingEnabled;
+  matrixPaddingEnabled = (enable != 0) ? 1 : 0;
+  return previous;
+} // unsigned char matrixSetPadding(unsigned char enable) ------------------------------------------
+
+/**
+ * @brief matrixSolve - Solves the linear system A * X = B from the LU factorization with partial
+ *                      pivoting of A. All the columns of B are solved together by blocked forward
+ *                      and back substitutions, at about a third of the flops of forming the
+ *                      inverse and with a smaller error. If A is singular, every element of the
+ *                      result is NaN.
+ * @param A           - Square matrix of the system.
+ * @param B           - Right-hand sides, one per column.
+ * @param status      - Optional report of the singularity and estimated conditioning of A.
+ * @return            - The solution X, of the size of B.
+ */
+matrix matrixSolve(const matrix & A, const matrix & B, matrixStatus * status) {
+  matrixCheckIsSquare(A);
+  matrixCheckIsEqualInnerSize(A, B);
+  matrix Z = B;
+  unsigned long pivot = matrixSolveLU(A, false, Z, (status != NULL) ? &status->rcond : NULL);
+  if (status != NULL) {
+    status->singular = pivot != 0;
+    status->pivot = pivot;
+  }
+  return Z;
+} // matrix matrixSolve(const matrix & A, const matrix & B, matrixStatus * status) -----------------
+
+/**
+ * @brief matrixSolveRight - Solves the linear system X * A = B, that is X = B * A^-1, from the LU
+ *                           factorization with partial pivoting of A. The system is solved as
+ *                           A^T * X^T = B^T, reading the factors of A transposed in place, so that
+ *                           all the rows of B are solved together. If A is singular, every element
+ *                           of the result is NaN.
+ * @param A                - Square matrix of the system.
+ * @param B                - Right-hand sides, one per row.
+ * @param status           - Optional report of the singularity and estimated conditioning of A.
+ * @return                 - The solution X, of the size of B.
+ */
+matrix matrixSolveRight(const matrix & A, const matrix & B, matrixStatus * status) {
+  matrixCheckIsSquare(A);
+  matrixCheckIsEqualInnerSize(B, A);
+  matrix Z = matrixTranspose(B);
+  unsigned long pivot = matrixSolveLU(A, true, Z, (status != NULL) ? &status->rcond : NULL);
+  Z.transpose();
+  if (status != NULL) {
+    status->singular = pivot != 0;
+    status->pivot = pivot;
+  }
+  return Z;
+} // matrix matrixSolveRight(const matrix & A, const matrix & B, matrixStatus * status) ------------
+
 /**
  * @brief matrixTranspose - Create a transpose copy of the input matrix.
  * @param X               - The matrix to be transposed.
  * @return                - The transposed matrix.
  */
 matrix matrixTranspose(const matrix & X) {
-  matrix Z(X.getColSize(), X.getRowSize());
-  for (unsigned long i = 1; i <= X.getRowSize(); i++) {
-    for (unsigned long j = 1; j <= X.getColSize(); j++) {
-      Z(j, i) = X(i, j);
-    }
-  }
+  matrix Z(X.getColSize(), X.getRowSize(), matrixUninitialized);
+  matrixKernelsTranspose(X.getRowSize(), X.getColSize(), X.mMat, X.getLd(), Z.mMat, Z.getLd());
   return Z;
 } // matrix matrixTranspose(const matrix & X) ------------------------------------------------------
 
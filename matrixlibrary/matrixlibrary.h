@@ -19,6 +19,114 @@
  *
  * Note:
  *
+ * Version:     1.0.14
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Moving a matrix whose memory comes from a "matrixAllocatorScope" into a matrix
+ *                 whose memory comes from an enclosing scope, or from no scope at all, now copies
+ *                 the elements, so that a result computed within a scope can be assigned to a
+ *                 matrix outside of it, even when both scopes share an arena.
+ *
+ * Version:     1.0.13
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added "matrixSolve()" and "matrixSolveRight()", which solve A * X = B and
+ *                 X * A = B from the LU factorization of A, for all the right-hand sides together.
+ *              2. The division between two matrices now solves through "matrixSolveRight()"
+ *                 instead of multiplying by the inverse.
+ *
+ * Version:     1.0.12
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. "matrixInverse()" now solves for the inverse from a blocked LU factorization with
+ *                 partial pivoting of matrixlibrarylapack, instead of the unpivoted Gauss-Jordan
+ *                 elimination that allocated a temporary for every row operation.
+ *              2. Added "matrixStatus", through which "matrixInverse()" reports a singular matrix
+ *                 and the reciprocal condition number of the matrix.
+ *
+ * Version:     1.0.11
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. "matrixTranspose()" now transposes tile by tile through the SIMD transpose kernel
+ *                 of matrixlibrarykernels, in parallel for large matrices.
+ *              2. Added "transpose()", which transposes a matrix in place. Square matrices are
+ *                 transposed without any allocation and vectors only swap their dimensions.
+ *
+ * Version:     1.0.10
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. "matrixLeadingDimension()" is now external and takes the element size, so that
+ *                 single precision matrices share the same leading dimension padding.
+ *
+ * Version:     1.0.9
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Pushing values with "operator<<()" now returns a "matrixInitializer" cursor,
+ *                 which writes every value once instead of shifting the whole matrix on every push.
+ *                 Values can also be separated by commas, e.g. X << 1, 2, 3.
+ *              2. Added "assign()" to copy values from a pointer, an iterator range or an
+ *                 initializer list, and a constructor taking an initializer list.
+ *
+ * Version:     1.0.8
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the "matrixUninitialized" construction tag, which allocates a matrix
+ *                 without clearing its memory.
+ *              2. Matrices now keep track of their capacity. Resizing to a size that fits within
+ *                 the capacity reuses the existing memory, and "resizeRetain()" moves the retained
+ *                 elements in place.
+ *              3. Added "getCapacity()", "reserve()", "resizeUninitialized()" and "shrinkToFit()".
+ *              4. Cleared matrices are allocated through "matrixAllocatorCalloc()" so that large
+ *                 matrices are zeroed lazily by the operating system.
+ *
+ * Version:     1.0.7
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The memory of the matrices is now allocated through matrixlibraryallocator, from
+ *                 the per-thread size class pools or the active arena scope.
+ *
+ * Version:     1.0.6
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The memory of every matrix is now aligned to MATRIXLIBRARY_ALIGNMENT (64) bytes.
+ *              2. Added the leading dimension (row stride) of the matrix, returned by "getLd()".
+ *                 Matrices with at least MATRIXLIBRARY_PADDING_MIN_COL columns have their rows
+ *                 padded to a multiple of the alignment, avoiding row strides that are multiples of
+ *                 4096 bytes. The padding can be disabled with "matrixSetPadding()".
+ *              3. Copy, element wise and submatrix operations are now performed row by row through
+ *                 the strided kernels of matrixlibrarykernels.
+ *
+ * Version:     1.0.5
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added "view()" to obtain non-owning views (matrixlibraryview) of the whole matrix
+ *                 or of a submatrix, without any copy.
+ *              2. The submatrix extraction operator, "resizeRetain()", "matrixInverse()" and the
+ *                 matrix multiplication operator now work on views instead of copied submatrices.
+ *
+ * Version:     1.0.4
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The element wise operators "+" and "-" between matrices, and "+", "-", "*" and
+ *                 "/" with a value, now build lazy expression templates of matrixlibraryexpression.
+ *                 An expression is evaluated only when it is assigned into a matrix, in a single
+ *                 fused loop without temporary matrices.
+ *              2. Added the "+=" and "-=" operators with a matrix expression, and the "+" and "-"
+ *                 operators between a temporary matrix and a matrix expression, all evaluated in
+ *                 place.
+ *
+ * Version:     1.0.3
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added move constructor and move assignment operator so that temporary matrices
+ *                 hand over their memory instead of being copied.
+ *              2. Assignment operators now return the matrix reference to allow chained assignment,
+ *                 and guard against self assignment.
+ *              3. Addition, subtraction, multiplication and division of a temporary matrix with a
+ *                 scalar or matrix reuse the memory of the temporary matrix.
+ *              4. The copy constructor no longer clears the memory that is overwritten right after.
+ *
+ * Version:     1.0.2
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The element wise operators "+", "-", "*" and "/" with a value or a matrix, and
+ *                 their compound assignment forms, now run on the runtime dispatched SIMD kernels
+ *                 of matrixlibrarysimd.
+ *
+ * Version:     1.0.1
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The matrix multiplication operator now runs on the cache blocked, register tiled
+ *                 "matrixKernelsGemm()" of matrixlibrarykernels instead of the naive triple loop.
+ *              2. The submatrix extraction operator "operator()(startRow, endRow, startCol,
+ *                 endCol)" is now const so that it can be used on const matrices.
+ *
  * Version:     1.0.0
  * Date:        2021/07/28 (YYYY/MM/DD)
  * Change Log:  1. Implemented first release version of matrixlibrary.
@@ -28,7 +136,62 @@
 #ifndef CMATRIXLIBRARY_H
 #define CMATRIXLIBRARY_H
 
-class matrix
+#include "matrixlibraryexpression.h"
+#include <initializer_list>
+#include <stddef.h>
+#include <utility>
+
+/**
+ * @brief MATRIXLIBRARY_ALIGNMENT - Alignment, in bytes, of the memory of every matrix.
+ */
+#define MATRIXLIBRARY_ALIGNMENT 64
+
+/**
+ * @brief MATRIXLIBRARY_PADDING_MIN_COL - Matrices with at least this number of columns have their
+ *                                        leading dimension padded, see "matrixSetPadding()".
+ */
+#define MATRIXLIBRARY_PADDING_MIN_COL 64
+
+/**
+ * @brief matrixUninitializedTag - Tag type selecting the constructor that leaves the elements of
+ *                                 the matrix uninitialised, for matrices whose every element is to
+ *                                 be overwritten right after.
+ */
+struct matrixUninitializedTag {};
+
+/**
+ * @brief matrixUninitialized - Tag value selecting the constructor that leaves the elements of the
+ *                              matrix uninitialised, e.g. matrix Z(row, col, matrixUninitialized).
+ */
+const matrixUninitializedTag matrixUninitialized = matrixUninitializedTag();
+
+/**
+ * @brief matrixStatus - Report of the factorization behind an inverse or a linear solve, filled in
+ *                      when requested.
+ */
+struct matrixStatus {
+  /**
+   * @brief singular - True if the matrix is singular, that is an exactly zero pivot was met.
+   */
+  bool singular;
+
+  /**
+   * @brief pivot - One based index of the first zero pivot, zero if the matrix is not singular.
+   */
+  unsigned long pivot;
+
+  /**
+   * @brief rcond - Reciprocal of the condition number of the matrix in the 1-norm, from zero for a
+   *                singular matrix to one for the identity. Values near the machine epsilon
+   *                (2.2e-16) mean that the result has few or no correct digits.
+   */
+  double rcond;
+};
+
+class matrixInitializer;
+class matrixView;
+
+class matrix : public matrixExpression<matrix>
 {
 public:
   /**
@@ -49,12 +212,46 @@ public:
    */
   explicit matrix(unsigned long rowSize, unsigned long colSize);
 
+  /**
+   * @brief matrix  - Overloaded constructor to instantiate a mxn matrix without initialising the
+   *                  elements. To be used when every element is to be overwritten right after.
+   * @param rowSize - Row size of the matrix.
+   * @param colSize - Column size of the matrix.
+   */
+  explicit matrix(unsigned long rowSize, unsigned long colSize, matrixUninitializedTag);
+
+  /**
+   * @brief matrix  - Overloaded constructor to instantiate a mxn matrix from a list of values in
+   *                  row-major order, e.g. matrix X(2, 2, {1, 2, 3, 4}).
+   * @param rowSize - Row size of the matrix.
+   * @param colSize - Column size of the matrix.
+   * @param X       - The values, no more than the size of the matrix. Elements without a value
+   *                  are cleared to zero.
+   */
+  explicit matrix(unsigned long rowSize, unsigned long colSize, std::initializer_list<double> X);
+
   /**
    * @brief matrix - Overloaded copy constructor.
    * @param X      - Matrix to be copied
    */
   matrix(const matrix &X);
 
+  /**
+   * @brief matrix - Overloaded move constructor. Takes over the memory of the input matrix without
+   *                 copying, leaving the input matrix empty. Memory from a scope deeper than the
+   *                 active one is copied instead, see "matrixAllocatorScope".
+   * @param X      - Matrix to be moved.
+   */
+  matrix(matrix && X) noexcept;
+
+  /**
+   * @brief matrix - Overloaded constructor to evaluate a matrix expression. All the elements are
+   *                 computed in a single pass, without any temporary matrix.
+   * @param X      - Matrix expression to be evaluated.
+   */
+  template <typename E>
+  matrix(const matrixExpression<E> & X);
+
   /**
    * @brief ~matrix - Default destructor
    */
@@ -63,78 +260,115 @@ public:
   /**
    * @brief operator = - Resize itself to be a 1x1 matrix and stores the input value.
    * @param X          - The value to be stored.
+   * @return           - Returns the matrix reference of itself.
    */
-  void operator=(double X);
+  matrix& operator=(double X);
 
   /**
    * @brief operator = - Resize itself to be a 1x1 matrix and stores the input value.
    * @param X          - The value to be stored.
+   * @return           - Returns the matrix reference of itself.
    */
-  void operator=(float X);
+  matrix& operator=(float X);
 
   /**
    * @brief operator = - Resize itself to be a 1x1 matrix and stores the input value.
    * @param X          - The value to be stored.
+   * @return           - Returns the matrix reference of itself.
    */
-  void operator=(int X);
+  matrix& operator=(int X);
 
   /**
    * @brief operator = - Resize itself to be a 1x1 matrix and stores the input value.
    * @param X          - The value to be stored.
+   * @return           - Returns the matrix reference of itself.
    */
-  void operator=(long X);
+  matrix& operator=(long X);
 
   /**
    * @brief operator = - Resize itself to be a 1x1 matrix and stores the input value.
    * @param X          - The value to be stored.
+   * @return           - Returns the matrix reference of itself.
    */
-  void operator=(long long X);
+  matrix& operator=(long long X);
 
   /**
    * @brief operator = - Overloaded operator to assign a matrix to itself.
    * @param X          - The matrix to copy from.
+   * @return           - Returns the matrix reference of itself.
+   */
+  matrix& operator=(const matrix & X);
+
+  /**
+   * @brief operator = - Overloaded operator to move a matrix into itself. The memory of the input
+   *                     matrix is taken over without copying, leaving the input matrix empty.
+   *                     Memory from an arena scope is copied instead, unless the memory of the
+   *                     matrix comes from the same scope or a deeper one, see
+   *                     "matrixAllocatorScope".
+   * @param X          - The matrix to move from.
+   * @return           - Returns the matrix reference of itself.
+   */
+  matrix& operator=(matrix && X) noexcept;
+
+  /**
+   * @brief operator = - Overloaded operator to evaluate a matrix expression into itself. All the
+   *                     elements are computed in a single pass, without any temporary matrix. The
+   *                     expression may refer to the matrix itself.
+   * @param X          - Matrix expression to be evaluated.
+   * @return           - Returns the matrix reference of itself.
    */
-  void operator=(const matrix & X);
+  template <typename E>
+  matrix& operator=(const matrixExpression<E> & X);
 
   /**
-   * @brief operator << - Assigning of values into the matrix via pushing method.
-   *                      Note that the first element value of the matrix will be pushed out.
+   * @brief operator << - Assigning of values into the matrix via pushing method, e.g.
+   *                      X << 1 << 2 << 3 or X << 1, 2, 3. Every value is written once, in O(1),
+   *                      through the returned initializer. The matrix ends up as if every value was
+   *                      pushed into its last element, pushing its first element out.
    * @param X           - The value to be pushed into the last element of the matrix.
-   * @return            - Returns the matrix pointer of itself.
+   * @return            - Returns the initializer to push the following values with.
    */
-  matrix& operator<<(double X);
+  matrixInitializer operator<<(double X);
 
   /**
-   * @brief operator << - Assigning of values into the matrix via pushing method.
-   *                      Note that the first element value of the matrix will be pushed out.
+   * @brief operator << - Assigning of values into the matrix via pushing method, e.g.
+   *                      X << 1 << 2 << 3 or X << 1, 2, 3. Every value is written once, in O(1),
+   *                      through the returned initializer. The matrix ends up as if every value was
+   *                      pushed into its last element, pushing its first element out.
    * @param X           - The value to be pushed into the last element of the matrix.
-   * @return            - Returns the matrix pointer of itself.
+   * @return            - Returns the initializer to push the following values with.
    */
-  matrix& operator<<(float X);
+  matrixInitializer operator<<(float X);
 
   /**
-   * @brief operator << - Assigning of values into the matrix via pushing method.
-   *                      Note that the first element value of the matrix will be pushed out.
+   * @brief operator << - Assigning of values into the matrix via pushing method, e.g.
+   *                      X << 1 << 2 << 3 or X << 1, 2, 3. Every value is written once, in O(1),
+   *                      through the returned initializer. The matrix ends up as if every value was
+   *                      pushed into its last element, pushing its first element out.
    * @param X           - The value to be pushed into the last element of the matrix.
-   * @return            - Returns the matrix pointer of itself.
+   * @return            - Returns the initializer to push the following values with.
    */
-  matrix& operator<<(int X);
+  matrixInitializer operator<<(int X);
 
   /**
-   * @brief operator << - Assigning of values into the matrix via pushing method.
-   *                      Note that the first element value of the matrix will be pushed out.
+   * @brief operator << - Assigning of values into the matrix via pushing method, e.g.
+   *                      X << 1 << 2 << 3 or X << 1, 2, 3. Every value is written once, in O(1),
+   *                      through the returned initializer. The matrix ends up as if every value was
+   *                      pushed into its last element, pushing its first element out.
    * @param X           - The value to be pushed into the last element of the matrix.
-   * @return            - Returns the matrix pointer of itself.
+   * @return            - Returns the initializer to push the following values with.
    */
-  matrix& operator<<(long X);
+  matrixInitializer operator<<(long X);
 
   /**
-   * @brief operator << - Assigning of values into the matrix via pushing method.
-   *                      Note that the first element value of the matrix will be pushed out.
+   * @brief operator << - Assigning of values into the matrix via pushing method, e.g.
+   *                      X << 1 << 2 << 3 or X << 1, 2, 3. Every value is written once, in O(1),
+   *                      through the returned initializer. The matrix ends up as if every value was
+   *                      pushed into its last element, pushing its first element out.
    * @param X           - The value to be pushed into the last element of the matrix.
-   * @return            - Returns the matrix pointer of itself.
+   * @return            - Returns the initializer to push the following values with.
    */
-  matrix& operator<<(long long X);
+  matrixInitializer operator<<(long long X);
 
   /**
    * @brief operator() - Return the value stored in the element defined by the input arguments.
@@ -161,19 +395,68 @@ public:
    * @param endCol     - End column index of the submatrix.
    * @return           - Returns the submatrix.
    */
-  matrix operator()(unsigned long startRow, unsigned long endRow, unsigned long startCol, unsigned long endCol);
+  matrix operator()(unsigned long startRow, unsigned long endRow, unsigned long startCol, unsigned long endCol) const;
+
+  /**
+   * @brief assign - Copies values into the elements of the matrix, in row-major order from the
+   *                 first element. The elements after the last value are left unchanged.
+   * @param X      - Pointer to the values.
+   * @param n      - Number of values, no more than the size of the matrix.
+   */
+  void assign(const double * X, unsigned long n);
+
+  /**
+   * @brief assign - Copies a list of values into the elements of the matrix, in row-major order
+   *                 from the first element. The elements after the last value are left unchanged.
+   * @param X      - The values, no more than the size of the matrix.
+   */
+  void assign(std::initializer_list<double> X);
+
+  /**
+   * @brief assign - Copies a range of values into the elements of the matrix, in row-major order
+   *                 from the first element. The elements after the last value are left unchanged.
+   * @param first  - Iterator to the first value.
+   * @param last   - Iterator past the last value. The range holds no more than the size of the
+   *                 matrix.
+   */
+  template <typename I>
+  void assign(I first, I last);
 
   /**
    * @brief clear - Clears all the matrix elements to zero.
    */
   void clear(void);
 
+  /**
+   * @brief evaluate - Returns the value of an element as a matrix expression.
+   * @param row      - Zero based row index.
+   * @param col      - Zero based column index.
+   * @return         - Value of the element.
+   */
+  double evaluate(unsigned long row, unsigned long col) const { return mMat[row * mLd + col]; }
+
+  /**
+   * @brief getCapacity - Returns the number of elements, including the padding of the rows, that
+   *                      the memory of the matrix can hold. Resizes that fit in the capacity reuse
+   *                      the memory of the matrix.
+   * @return            - Capacity of the matrix.
+   */
+  unsigned long getCapacity(void) const;
+
   /**
    * @brief getColSize - Returns the column size of the matrix.
    * @return           - Column size of the matrix.
    */
   unsigned long getColSize(void) const;
 
+  /**
+   * @brief getLd - Returns the leading dimension (row stride) of the matrix. Element (i, j) is
+   *                stored at mMat[i * getLd() + j]. The leading dimension may be larger than the
+   *                column size, in which case the rows are not stored back-to-back.
+   * @return      - Leading dimension of the matrix.
+   */
+  unsigned long getLd(void) const;
+
   /**
    * @brief getRowSize - Returns the row size of the matrix.
    * @return           - Row size of the matrix.
@@ -186,6 +469,13 @@ public:
    */
   unsigned long getSize(void) const;
 
+  /**
+   * @brief reserve  - Increases the capacity of the matrix to at least the input number of
+   *                   elements. The existing elements are retained.
+   * @param capacity - Number of elements, including the padding of the rows.
+   */
+  void reserve(unsigned long capacity);
+
   /**
    * @brief resizeClear - Resize the matrix to a new dimension with all existing elements cleared.
    * @param row         - Row size of the resize matrix.
@@ -204,6 +494,44 @@ public:
    */
   void resizeRetain(unsigned long row, unsigned long col);
 
+  /**
+   * @brief resizeUninitialized - Resize the matrix to a new dimension without initialising the
+   *                              elements. To be used when every element is to be overwritten right
+   *                              after.
+   * @param row                 - Row size of the resize matrix.
+   * @param col                 - Column size of the resize matrix.
+   */
+  void resizeUninitialized(unsigned long row, unsigned long col);
+
+  /**
+   * @brief shrinkToFit - Reduces the capacity of the matrix to its current size. The existing
+   *                      elements are retained.
+   */
+  void shrinkToFit(void);
+
+  /**
+   * @brief transpose - Transposes the matrix in place. Square matrices and vectors are transposed
+   *                    within their own memory, other matrices through a new allocation.
+   */
+  void transpose(void);
+
+  /**
+   * @brief view - Returns a view of the whole matrix. No element is copied.
+   * @return     - Returns the view of the matrix.
+   */
+  matrixView view(void) const;
+
+  /**
+   * @brief view     - Returns a view of the submatrix defined by the input arguments. No element is
+   *                   copied, and writing through the view changes the matrix.
+   * @param startRow - Start row index of the submatrix.
+   * @param endRow   - End row index of the submatrix.
+   * @param startCol - Start column index of the submatrix.
+   * @param endCol   - End column index of the submatrix.
+   * @return         - Returns the view of the submatrix.
+   */
+  matrixView view(unsigned long startRow, unsigned long endRow, unsigned long startCol, unsigned long endCol) const;
+
   /**
    * @brief mMat - "double" type pointer to the memory allocated for the matrix.
    *               IMPORTANT NOTE: THIS ATTRIBUTE IS NOT "PRIVATE" FOR EFFICIENCY. DO NOT ACCESS AND
@@ -229,6 +557,33 @@ private:
    */
   unsigned long mSize;
 
+  /**
+   * @brief mLd - To store the leading dimension (row stride) of the matrix.
+   */
+  unsigned long mLd;
+
+  /**
+   * @brief mCapacity - To store the number of elements the memory of the matrix can hold.
+   */
+  unsigned long mCapacity;
+
+  /**
+   * @brief allocate - Sets the dimension of the matrix, reusing its memory when the new dimension
+   *                   fits in the capacity. The elements are not initialised unless requested.
+   * @param row      - Row size of the matrix.
+   * @param col      - Column size of the matrix.
+   * @param zero     - 1 to clear the elements to zero, 0 to leave them uninitialised.
+   */
+  void allocate(unsigned long row, unsigned long col, unsigned char zero = 0);
+
+  /**
+   * @brief copyOutside - Copies a matrix into itself, in its own memory when it fits, otherwise in
+   *                      memory allocated outside of any arena scope, which can outlive the
+   *                      active scope.
+   * @param X           - The matrix to copy from.
+   */
+  void copyOutside(const matrix & X);
+
   /**
    * @brief create - Creates a square matrix.
    * @param size   - Size of the square matrix.
@@ -248,45 +603,97 @@ private:
   void release(void);
 };
 
-/**
- * @brief operator + - Overloading of the addition operatior between a matrix and a double type value.
- * @param X          - Main matrix for addition.
- * @param Y          - Addition value.
- * @return           - The resultant matrix.
- */
-matrix operator+(const matrix & X, const double & Y);
+class matrixInitializer
+{
+public:
+  /**
+   * @brief matrixInitializer - Constructor to push values into a matrix, starting at its first
+   *                            element.
+   * @param X                 - The matrix to push the values into.
+   */
+  explicit matrixInitializer(matrix & X);
+
+  /**
+   * @brief matrixInitializer - Overloaded move constructor. The input initializer no longer
+   *                            pushes into the matrix.
+   * @param X                 - Initializer to be moved.
+   */
+  matrixInitializer(matrixInitializer && X) noexcept;
+
+  matrixInitializer(const matrixInitializer &) = delete;
+  matrixInitializer& operator=(const matrixInitializer &) = delete;
+
+  /**
+   * @brief ~matrixInitializer - Destructor. When fewer values than the size of the matrix were
+   *                             pushed, or the pushes wrapped around, the elements are rotated so
+   *                             that the last pushed value ends up in the last element.
+   */
+  ~matrixInitializer();
+
+  /**
+   * @brief operator << - Pushes a value into the next element of the matrix.
+   * @param X           - The value to be pushed.
+   * @return            - Returns the initializer reference of itself.
+   */
+  matrixInitializer& operator<<(double X);
+
+  /**
+   * @brief operator , - Pushes a value into the next element of the matrix.
+   * @param X          - The value to be pushed.
+   * @return           - Returns the initializer reference of itself.
+   */
+  matrixInitializer& operator,(double X);
+
+private:
+  /**
+   * @brief mX - The matrix the values are pushed into.
+   */
+  matrix * mX;
+
+  /**
+   * @brief mCount - To store the number of values pushed.
+   */
+  unsigned long mCount;
+
+  /**
+   * @brief mRowIndex - To store the zero based row index of the next element to be written.
+   */
+  unsigned long mRowIndex;
+
+  /**
+   * @brief mColIndex - To store the zero based column index of the next element to be written.
+   */
+  unsigned long mColIndex;
+};
 
 /**
- * @brief operator + - Overloading of the addition operatior between two matrices.
+ * @brief operator + - Overloading of the addition operatior between a temporary matrix and a double
+ *                     type value. The result is computed in the memory of the temporary matrix.
  * @param X          - Main matrix for addition.
- * @param Y          - Addition matrix.
+ * @param Y          - Addition value.
  * @return           - The resultant matrix.
  */
-matrix operator+(const matrix & X, const matrix & Y);
+matrix operator+(matrix && X, const double & Y);
 
 /**
- * @brief operator - - Overloading of the subtraction operatior between a matrix and a double type value.
+ * @brief operator - - Overloading of the subtraction operatior between a temporary matrix and a
+ *                     double type value. The result is computed in the memory of the temporary
+ *                     matrix.
  * @param X          - Main matrix for subtraction.
  * @param Y          - Subtraction value.
  * @return           - The resultant matrix.
  */
-matrix operator-(const matrix & X, const double & Y);
+matrix operator-(matrix && X, const double & Y);
 
 /**
- * @brief operator - - Overloading of the subtraction operatior between two matrices.
- * @param X          - Main matrix for subtraction.
- * @param Y          - Subtraction matrix.
- * @return           - The resultant matrix.
- */
-matrix operator-(const matrix & X, const matrix & Y);
-
-/**
- * @brief operator * - Overloading of the multiplication operatior between a matrix and a double type value.
+ * @brief operator * - Overloading of the multiplication operatior between a temporary matrix and a
+ *                     double type value. The result is computed in the memory of the temporary
+ *                     matrix.
  * @param X          - Main matrix for multiplication.
  * @param Y          - Multiplication value.
  * @return           - The resultant matrix.
  */
-matrix operator*(const matrix & X, const double & Y);
+matrix operator*(matrix && X, const double & Y);
 
 /**
  * @brief operator * - Overloading of the multiplication operatior between two matrices.
@@ -297,16 +704,17 @@ matrix operator*(const matrix & X, const double & Y);
 matrix operator*(const matrix & X, const matrix & Y);
 
 /**
- * @brief operator / - Overloading of the division operatior between a matrix and a double type
- *                     value.
+ * @brief operator / - Overloading of the division operatior between a temporary matrix and a double
+ *                     type value. The result is computed in the memory of the temporary matrix.
  * @param X          - Main matrix for division.
  * @param Y          - Division value.
  * @return           - The resultant matrix.
  */
-matrix operator/(const matrix & X, const double & Y);
+matrix operator/(matrix && X, const double & Y);
 
 /**
- * @brief operator / - Overloading of the division operatior between two matrices.
+ * @brief operator / - Overloading of the division operatior between two matrices, X * Y^-1. The
+ *                     result is solved by "matrixSolveRight()" without forming the inverse.
  * @param X          - Main matrix for division.
  * @param Y          - Division matrix.
  * @return           - The resultant matrix.
@@ -359,6 +767,46 @@ void operator*=(matrix & X, const double & Y);
  */
 void operator/=(matrix & X, const double & Y);
 
+/**
+ * @brief operator + - Overloading of the addition operatior between a temporary matrix and a
+ *                     matrix expression. The result is computed in the memory of the temporary
+ *                     matrix.
+ * @param X          - Main matrix for addition.
+ * @param Y          - Addition expression.
+ * @return           - The resultant matrix.
+ */
+template <typename E>
+matrix operator+(matrix && X, const matrixExpression<E> & Y);
+
+/**
+ * @brief operator - - Overloading of the subtraction operatior between a temporary matrix and a
+ *                     matrix expression. The result is computed in the memory of the temporary
+ *                     matrix.
+ * @param X          - Main matrix for subtraction.
+ * @param Y          - Subtraction expression.
+ * @return           - The resultant matrix.
+ */
+template <typename E>
+matrix operator-(matrix && X, const matrixExpression<E> & Y);
+
+/**
+ * @brief operator += - Overloading of the addition equal operatior between a matrix and a matrix
+ *                      expression. The expression is evaluated directly into the matrix.
+ * @param X           - Main matrix for addition.
+ * @param Y           - Addition expression.
+ */
+template <typename E>
+void operator+=(matrix & X, const matrixExpression<E> & Y);
+
+/**
+ * @brief operator -= - Overloading of the subtraction equal operatior between a matrix and a matrix
+ *                      expression. The expression is evaluated directly into the matrix.
+ * @param X           - Main matrix for subtraction.
+ * @param Y           - Subtraction expression.
+ */
+template <typename E>
+void operator-=(matrix & X, const matrixExpression<E> & Y);
+
 /**
  * @brief matrixCheckIsEqualInnerSize - Checks the inner size of the matrices.
  * @param X                           - Main matrix to be check.
@@ -398,11 +846,23 @@ matrix matrixIdentity(unsigned long size);
 matrix matrixIdentity(unsigned long row, unsigned long col);
 
 /**
- * @brief matrixInverse - Compute the inverse of a square matrix.
+ * @brief matrixInverse - Compute the inverse of a square matrix from its LU factorization with
+ *                        partial pivoting. If the matrix is singular, every element of the result
+ *                        is NaN.
  * @param X             - Matrix whose inverse is to be calculated.
+ * @param status        - Optional report of the singularity and conditioning of X.
  * @return              - Resultant matrix.
  */
-matrix matrixInverse(const matrix & X);
+matrix matrixInverse(const matrix & X, matrixStatus * status = NULL);
+
+/**
+ * @brief matrixLeadingDimension - Determines the leading dimension (row stride) of a new matrix of
+ *                                 the given element size, honouring "matrixSetPadding()".
+ * @param col                    - Column size of the matrix.
+ * @param elementSize            - Size of an element in bytes.
+ * @return                       - Leading dimension of the matrix.
+ */
+unsigned long matrixLeadingDimension(unsigned long col, unsigned long elementSize = sizeof(double));
 
 /**
  * @brief matrixPrint - Print the size information and values of each element in the matrix.
@@ -411,6 +871,38 @@ matrix matrixInverse(const matrix & X);
  */
 void matrixPrint(const matrix & mat, const char * msg = "");
 
+/**
+ * @brief matrixSetPadding - Enables or disables the padding of the leading dimension of matrices
+ *                           created afterwards. Existing matrices are not affected. The padding is
+ *                           enabled by default.
+ * @param enable           - 1 to enable and 0 to disable the padding.
+ * @return                 - The previous setting.
+ */
+unsigned char matrixSetPadding(unsigned char enable);
+
+/**
+ * @brief matrixSolve - Solves the linear system A * X = B from the LU factorization with partial
+ *                      pivoting of A, for all the columns of B together. Faster and more accurate
+ *                      than multiplying by "matrixInverse()". If A is singular, every element of
+ *                      the result is NaN.
+ * @param A           - Square matrix of the system.
+ * @param B           - Right-hand sides, one per column.
+ * @param status      - Optional report of the singularity and estimated conditioning of A.
+ * @return            - The solution X, of the size of B.
+ */
+matrix matrixSolve(const matrix & A, const matrix & B, matrixStatus * status = NULL);
+
+/**
+ * @brief matrixSolveRight - Solves the linear system X * A = B, that is X = B * A^-1, from the LU
+ *                           factorization with partial pivoting of A, for all the rows of B
+ *                           together. If A is singular, every element of the result is NaN.
+ * @param A                - Square matrix of the system.
+ * @param B                - Right-hand sides, one per row.
+ * @param status           - Optional report of the singularity and estimated conditioning of A.
+ * @return                 - The solution X, of the size of B.
+ */
+matrix matrixSolveRight(const matrix & A, const matrix & B, matrixStatus * status = NULL);
+
 /**
  * @brief matrixTranspose - Create a transpose copy of the input matrix.
  * @param X               - The matrix to be transposed.
@@ -426,4 +918,117 @@ matrix matrixTranspose(const matrix & X);
  */
 void matrixVersion(unsigned char & major, unsigned char & minor, unsigned char & patch);
 
+/// ================================================================================================
+/// TEMPLATE FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief matrixExpressionStore - Matrices are held by reference in the expression tree.
+ */
+template <>
+struct matrixExpressionStore<matrix> {
+  typedef const matrix & type;
+};
+
+/**
+ * @brief matrix - Overloaded constructor to evaluate a matrix expression. All the elements are
+ *                 computed in a single pass, without any temporary matrix.
+ * @param X      - Matrix expression to be evaluated.
+ */
+template <typename E>
+matrix::matrix(const matrixExpression<E> & X) {
+  mMat = NULL;
+  mCapacity = 0;
+  this->allocate(X.derived().getRowSize(), X.derived().getColSize());
+  matrixExpressionEvaluate<matrixExpressionAssign>(mMat, mRow, mCol, mLd, X);
+} // matrix::matrix(const matrixExpression<E> & X) -------------------------------------------------
+
+/**
+ * @brief operator = - Overloaded operator to evaluate a matrix expression into itself. All the
+ *                     elements are computed in a single pass, without any temporary matrix. The
+ *                     expression may refer to the matrix itself.
+ * @param X          - Matrix expression to be evaluated.
+ * @return           - Returns the matrix reference of itself.
+ */
+template <typename E>
+matrix& matrix::operator=(const matrixExpression<E> & X) {
+  if ((X.derived().getRowSize() != mRow) || (X.derived().getColSize() != mCol))
+    return * this = matrix(X);
+  matrixExpressionEvaluate<matrixExpressionAssign>(mMat, mRow, mCol, mLd, X);
+  return * this;
+} // matrix::operator=(const matrixExpression<E> & X) ----------------------------------------------
+
+/**
+ * @brief assign - Copies a range of values into the elements of the matrix, in row-major order from
+ *                 the first element. The elements after the last value are left unchanged.
+ * @param first  - Iterator to the first value.
+ * @param last   - Iterator past the last value. The range holds no more than the size of the
+ *                 matrix.
+ */
+template <typename I>
+void matrix::assign(I first, I last) {
+  for (unsigned long i = 0; i < mRow; i++) {
+    double * z = &mMat[i * mLd];
+    for (unsigned long j = 0; j < mCol; j++) {
+      if (first == last)
+        return;
+      z[j] = * first;
+      ++first;
+    }
+  }
+  if (first != last)
+    matrixExit("Matrices size mismatch.");
+} // matrix::assign(I first, I last) ---------------------------------------------------------------
+
+/**
+ * @brief operator += - Overloading of the addition equal operatior between a matrix and a matrix
+ *                      expression. The expression is evaluated directly into the matrix.
+ * @param X           - Main matrix for addition.
+ * @param Y           - Addition expression.
+ */
+template <typename E>
+void operator+=(matrix & X, const matrixExpression<E> & Y) {
+  matrixExpressionEvaluate<matrixExpressionAdd>(X.mMat, X.getRowSize(), X.getColSize(), X.getLd(), Y);
+} // operator+=(matrix & X, const matrixExpression<E> & Y) -----------------------------------------
+
+/**
+ * @brief operator -= - Overloading of the subtraction equal operatior between a matrix and a matrix
+ *                      expression. The expression is evaluated directly into the matrix.
+ * @param X           - Main matrix for subtraction.
+ * @param Y           - Subtraction expression.
+ */
+template <typename E>
+void operator-=(matrix & X, const matrixExpression<E> & Y) {
+  matrixExpressionEvaluate<matrixExpressionSubtract>(X.mMat, X.getRowSize(), X.getColSize(), X.getLd(), Y);
+} // operator-=(matrix & X, const matrixExpression<E> & Y) -----------------------------------------
+
+/**
+ * @brief operator + - Overloading of the addition operatior between a temporary matrix and a
+ *                     matrix expression. The result is computed in the memory of the temporary
+ *                     matrix.
+ * @param X          - Main matrix for addition.
+ * @param Y          - Addition expression.
+ * @return           - The resultant matrix.
+ */
+template <typename E>
+matrix operator+(matrix && X, const matrixExpression<E> & Y) {
+  matrixExpressionEvaluate<matrixExpressionAdd>(X.mMat, X.getRowSize(), X.getColSize(), X.getLd(), Y);
+  return std::move(X);
+} // operator+(matrix && X, const matrixExpression<E> & Y) -----------------------------------------
+
+/**
+ * @brief operator - - Overloading of the subtraction operatior between a temporary matrix and a
+ *                     matrix expression. The result is computed in the memory of the temporary
+ *                     matrix.
+ * @param X          - Main matrix for subtraction.
+ * @param Y          - Subtraction expression.
+ * @return           - The resultant matrix.
+ */
+template <typename E>
+matrix operator-(matrix && X, const matrixExpression<E> & Y) {
+  matrixExpressionEvaluate<matrixExpressionSubtract>(X.mMat, X.getRowSize(), X.getColSize(), X.getLd(), Y);
+  return std::move(X);
+} // operator-(matrix && X, const matrixExpression<E> & Y) -----------------------------------------
+
+#include "matrixlibraryview.h"
+
 #endif // CMATRIXLIBRARY_H
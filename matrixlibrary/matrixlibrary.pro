@@ -1,6 +1,6 @@
 QT -= gui
 
-CONFIG += c++11 console
+CONFIG += c++11 console thread
 CONFIG -= app_bundle
 
 # The following define makes your compiler emit warnings if you use
@@ -17,10 +17,20 @@ DEFINES += QT_DEPRECATED_WARNINGS
 SOURCES += \
         main.cpp \
         matrixlibrary.cpp \
+        matrixlibraryallocator.cpp \
+        matrixlibraryblas.cpp \
         matrixlibrarycelloperations.cpp \
         matrixlibrarycsv.cpp \
         matrixlibrarydecomposition.cpp \
-        matrixlibrarymaths.cpp
+        matrixlibraryfactorization.cpp \
+        matrixlibraryfloat.cpp \
+        matrixlibrarykernels.cpp \
+        matrixlibrarylapack.cpp \
+        matrixlibrarymaths.cpp \
+        matrixlibrarysimd.cpp \
+        matrixlibrarythreads.cpp \
+        matrixlibraryview.cpp \
+        matrixlibrarywindow.cpp
 
 # Default rules for deployment.
 qnx: target.path = /tmp/$${TARGET}/bin
@@ -29,7 +39,19 @@ else: unix:!android: target.path = /opt/$${TARGET}/bin
 
 HEADERS += \
     matrixlibrary.h \
+    matrixlibraryallocator.h \
+    matrixlibraryblas.h \
     matrixlibrarycelloperations.h \
     matrixlibrarycsv.h \
     matrixlibrarydecomposition.h \
-    matrixlibrarymaths.h
+    matrixlibraryexpression.h \
+    matrixlibraryfactorization.h \
+    matrixlibraryfixed.h \
+    matrixlibraryfloat.h \
+    matrixlibrarykernels.h \
+    matrixlibrarylapack.h \
+    matrixlibrarymaths.h \
+    matrixlibrarysimd.h \
+    matrixlibrarythreads.h \
+    matrixlibraryview.h \
+    matrixlibrarywindow.h
@@ -0,0 +1,538 @@
+/*
+ * Copyright:   2021 Johnathon Leong
+ *
+ * License:     License under LGPL-3.0-or-later.
+ *              Please refer to https://www.gnu.org/licenses/lgpl-3.0.txt for more information on the
+ *              terms of LGPL-3.0 or relavent website for a later version of the LGPL.
+ *
+ * Disclaimer:  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY
+ *              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ *              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ *              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ *              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *              WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author:      Johnathon Leong
+ *
+ * Note:        Memory allocator of matrixlibrary. Every block is aligned to MATRIXLIBRARY_ALIGNMENT
+ *              bytes and is preceded by a small header recording where it came from, so that a
+ *              block is always returned to its origin whatever the active strategy is when it is
+ *              freed. Blocks are taken, in order of precedence, from:
+ *              1. the arena of the innermost "matrixAllocatorScope" of the calling thread,
+ *              2. the per-thread size class pools, when the strategy is MATRIXALLOCATOR_POOL,
+ *              3. the system allocator.
+ *              The pools and the counters are per thread, so that no lock is taken on any path.
+ *
+ * Version:     1.0.2
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Every arena block records the "matrixAllocatorScope" it was allocated in, and a
+ *                 scope counts its blocks that are not freed yet. A scope that ends while blocks
+ *                 allocated within it are still alive now stops through "matrixExit()" instead of
+ *                 letting them be overwritten, whether the scopes share an arena or not.
+ *              2. Added "matrixAllocatorGetDepth()", "matrixAllocatorGetActiveDepth()" and
+ *                 "matrixAllocatorMallocOutside()", so that a matrix can keep an arena block from
+ *                 outliving its scope.
+ *
+ * Version:     1.0.1
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added "matrixAllocatorCalloc()". Cleared blocks of at least
+ *                 MATRIXALLOCATOR_LAZY_ZERO bytes are mapped directly from the operating system,
+ *                 which zeroes the pages on first touch.
+ *
+ * Version:     1.0.0
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Implemented first release version of matrixlibraryallocator.
+ */
+
+#include "matrixlibraryallocator.h"
+#include "matrixlibrary.h"
+#include <stdlib.h>
+#include <string.h>
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#endif
+
+/**
+ * @brief MATRIXALLOCATOR_ORIGIN_SYSTEM - The block comes from the system allocator.
+ */
+#define MATRIXALLOCATOR_ORIGIN_SYSTEM 0
+
+/**
+ * @brief MATRIXALLOCATOR_ORIGIN_POOL - The block comes from a size class pool.
+ */
+#define MATRIXALLOCATOR_ORIGIN_POOL 1
+
+/**
+ * @brief MATRIXALLOCATOR_ORIGIN_ARENA - The block comes from an arena.
+ */
+#define MATRIXALLOCATOR_ORIGIN_ARENA 2
+
+/**
+ * @brief MATRIXALLOCATOR_ORIGIN_MAPPED - The block is mapped directly from the operating system.
+ */
+#define MATRIXALLOCATOR_ORIGIN_MAPPED 3
+
+/**
+ * @brief matrixAllocatorHeader - Header stored in the MATRIXLIBRARY_ALIGNMENT bytes preceding every
+ *                                block.
+ */
+struct matrixAllocatorHeader {
+  /**
+   * @brief size - Size of the block in bytes, including the header.
+   */
+  unsigned long size;
+
+  /**
+   * @brief origin - Origin of the block, one of the MATRIXALLOCATOR_ORIGIN_* values.
+   */
+  unsigned char origin;
+
+  /**
+   * @brief sizeClass - Size class of a pool block.
+   */
+  unsigned char sizeClass;
+
+  /**
+   * @brief scope - Scope an arena block was allocated in.
+   */
+  matrixAllocatorScope * scope;
+
+  /**
+   * @brief next - Next cached block of a pool.
+   */
+  matrixAllocatorHeader * next;
+};
+
+static_assert(sizeof(matrixAllocatorHeader) <= MATRIXLIBRARY_ALIGNMENT,
+              "The allocator header must fit in the alignment.");
+
+/**
+ * @brief matrixAllocatorChunk - Memory chunk of an arena. The memory of the chunk starts
+ *                               MATRIXLIBRARY_ALIGNMENT bytes after the chunk.
+ */
+struct matrixAllocatorChunk {
+  /**
+   * @brief next - Next memory chunk of the arena.
+   */
+  matrixAllocatorChunk * next;
+
+  /**
+   * @brief size - Size of the memory of the chunk in bytes.
+   */
+  unsigned long size;
+};
+
+/**
+ * @brief matrixAllocatorPool - Size class pools of a thread. The cached blocks are returned to the
+ *                              system when the thread exits.
+ */
+struct matrixAllocatorPool {
+  ~matrixAllocatorPool();
+
+  /**
+   * @brief head - Head of the list of cached blocks of every size class.
+   */
+  matrixAllocatorHeader * head[MATRIXALLOCATOR_POOL_CLASSES];
+
+  /**
+   * @brief count - Number of cached blocks of every size class.
+   */
+  unsigned long count[MATRIXALLOCATOR_POOL_CLASSES];
+
+  /**
+   * @brief bytes - Number of bytes cached by all the size classes.
+   */
+  unsigned long bytes;
+};
+
+/**
+ * @brief matrixAllocatorStrategy - Allocation strategy outside of any arena scope.
+ */
+static unsigned char matrixAllocatorStrategy = MATRIXALLOCATOR_POOL;
+
+/**
+ * @brief matrixAllocatorPools - Size class pools of the thread.
+ */
+static thread_local matrixAllocatorPool matrixAllocatorPools;
+
+/**
+ * @brief matrixAllocatorPoolsClosed - Set once the pools of the thread have been destroyed, after
+ *                                     which freed blocks go straight back to the system.
+ */
+static thread_local unsigned char matrixAllocatorPoolsClosed = 0;
+
+/**
+ * @brief matrixAllocatorActive - Innermost scope of the thread, NULL if none.
+ */
+static thread_local matrixAllocatorScope * matrixAllocatorActive = NULL;
+
+/**
+ * @brief matrixAllocatorCounters - Allocation counters of the thread.
+ */
+static thread_local matrixAllocatorStats matrixAllocatorCounters;
+
+/// ================================================================================================
+/// STATIC FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief matrixAllocatorSystemMalloc - Allocates memory aligned to MATRIXLIBRARY_ALIGNMENT bytes
+ *                                      from the system. Aborts when the memory cannot be allocated.
+ * @param size                        - Size of the memory in bytes.
+ * @return                            - Pointer to the allocated memory.
+ */
+static char * matrixAllocatorSystemMalloc(unsigned long size) {
+  void * ptr = NULL;
+#if defined(_MSC_VER)
+  ptr = _aligned_malloc(size, MATRIXLIBRARY_ALIGNMENT);
+#else
+  if (posix_memalign(&ptr, MATRIXLIBRARY_ALIGNMENT, size) != 0)
+    ptr = NULL;
+#endif
+  if (ptr == NULL)
+    matrixExit("Matrix memory allocation failed.");
+  matrixAllocatorCounters.heapAlloc++;
+  return (char *)ptr;
+} // char * matrixAllocatorSystemMalloc(unsigned long size) ----------------------------------------
+
+/**
+ * @brief matrixAllocatorSystemFree - Frees memory allocated by "matrixAllocatorSystemMalloc()".
+ * @param ptr                       - Pointer to the memory.
+ */
+static void matrixAllocatorSystemFree(void * ptr) {
+#if defined(_MSC_VER)
+  _aligned_free(ptr);
+#else
+  free(ptr);
+#endif
+  matrixAllocatorCounters.heapFree++;
+} // void matrixAllocatorSystemFree(void * ptr) ----------------------------------------------------
+
+/**
+ * @brief matrixAllocatorPoolMalloc - Allocates a block of a size class, from the pool of the thread
+ *                                    when one is cached.
+ * @param sizeClass                 - The size class.
+ * @return                          - Header of the block.
+ */
+static matrixAllocatorHeader * matrixAllocatorPoolMalloc(unsigned char sizeClass) {
+  matrixAllocatorHeader * header = matrixAllocatorPools.head[sizeClass];
+  if (header != NULL) {
+    matrixAllocatorPools.head[sizeClass] = header->next;
+    matrixAllocatorPools.count[sizeClass]--;
+    matrixAllocatorPools.bytes -= header->size;
+    matrixAllocatorCounters.poolAlloc++;
+    return header;
+  }
+
+  unsigned long size = (unsigned long)MATRIXLIBRARY_ALIGNMENT << sizeClass;
+  header = (matrixAllocatorHeader *)matrixAllocatorSystemMalloc(size);
+  header->size = size;
+  header->origin = MATRIXALLOCATOR_ORIGIN_POOL;
+  header->sizeClass = sizeClass;
+  return header;
+} // matrixAllocatorHeader * matrixAllocatorPoolMalloc(unsigned char sizeClass) --------------------
+
+/**
+ * @brief matrixAllocatorPoolFree - Caches a block into the pool of the thread, or returns it to the
+ *                                  system when the pool of its size class, or the pools as a
+ *                                  whole, are full.
+ * @param header                  - Header of the block.
+ */
+static void matrixAllocatorPoolFree(matrixAllocatorHeader * header) {
+  unsigned char sizeClass = header->sizeClass;
+  if ((matrixAllocatorPoolsClosed != 0) ||
+      (matrixAllocatorPools.count[sizeClass] >= MATRIXALLOCATOR_POOL_DEPTH) ||
+      (matrixAllocatorPools.bytes + header->size > MATRIXALLOCATOR_POOL_LIMIT)) {
+    matrixAllocatorSystemFree(header);
+    return;
+  }
+  header->next = matrixAllocatorPools.head[sizeClass];
+  matrixAllocatorPools.head[sizeClass] = header;
+  matrixAllocatorPools.count[sizeClass]++;
+  matrixAllocatorPools.bytes += header->size;
+  matrixAllocatorCounters.poolFree++;
+} // void matrixAllocatorPoolFree(matrixAllocatorHeader * header) ----------------------------------
+
+/// ================================================================================================
+/// PUBLIC FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief ~matrixAllocatorPool - Destructor. Returns all the cached blocks to the system.
+ */
+matrixAllocatorPool::~matrixAllocatorPool() {
+  matrixAllocatorTrim();
+  matrixAllocatorPoolsClosed = 1;
+} // matrixAllocatorPool::~matrixAllocatorPool() ---------------------------------------------------
+
+/**
+ * @brief matrixAllocatorArena - Constructor. No memory is allocated until the first allocation.
+ * @param chunkSize            - Size, in bytes, of the memory chunks of the arena.
+ */
+matrixAllocatorArena::matrixAllocatorArena(unsigned long chunkSize)
+  : mHead(NULL), mCurrent(NULL), mOffset(0), mChunkSize(chunkSize) {
+} // matrixAllocatorArena::matrixAllocatorArena(unsigned long chunkSize) ---------------------------
+
+/**
+ * @brief ~matrixAllocatorArena - Destructor. Frees all the memory chunks. The arena must not be
+ *                                active in any scope.
+ */
+matrixAllocatorArena::~matrixAllocatorArena() {
+  while (mHead != NULL) {
+    matrixAllocatorChunk * next = mHead->next;
+    matrixAllocatorSystemFree(mHead);
+    mHead = next;
+  }
+} // matrixAllocatorArena::~matrixAllocatorArena() -------------------------------------------------
+
+/**
+ * @brief allocate - Allocates a block from the arena, adding a new chunk when the block fits in
+ *                   none of the existing ones.
+ * @param size     - Size of the block in bytes, including the header.
+ * @return         - Pointer to the block.
+ */
+char * matrixAllocatorArena::allocate(unsigned long size) {
+  if (mCurrent == NULL) {
+    mCurrent = mHead;
+    mOffset = 0;
+  }
+  while (mCurrent != NULL) {
+    if (mOffset + size <= mCurrent->size) {
+      char * block = (char *)mCurrent + MATRIXLIBRARY_ALIGNMENT + mOffset;
+      mOffset += size;
+      return block;
+    }
+    if (mCurrent->next == NULL)
+      break;
+    mCurrent = mCurrent->next;
+    mOffset = 0;
+  }
+
+  unsigned long chunkSize = (size > mChunkSize) ? size : mChunkSize;
+  chunkSize = (chunkSize + MATRIXLIBRARY_ALIGNMENT - 1) / MATRIXLIBRARY_ALIGNMENT *
+              MATRIXLIBRARY_ALIGNMENT;
+  matrixAllocatorChunk * chunk =
+    (matrixAllocatorChunk *)matrixAllocatorSystemMalloc(MATRIXLIBRARY_ALIGNMENT + chunkSize);
+  chunk->next = NULL;
+  chunk->size = chunkSize;
+  if (mCurrent == NULL)
+    mHead = chunk;
+  else
+    mCurrent->next = chunk;
+  mCurrent = chunk;
+  mOffset = size;
+  return (char *)chunk + MATRIXLIBRARY_ALIGNMENT;
+} // char * matrixAllocatorArena::allocate(unsigned long size) -------------------------------------
+
+/**
+ * @brief release - Releases a block. Only the most recent block is given back immediately, the
+ *                  others are recycled when the scope ends.
+ * @param block   - Pointer to the block.
+ * @param size    - Size of the block in bytes, including the header.
+ */
+void matrixAllocatorArena::release(char * block, unsigned long size) {
+  if ((mCurrent != NULL) && (block + size == (char *)mCurrent + MATRIXLIBRARY_ALIGNMENT + mOffset))
+    mOffset -= size;
+} // void matrixAllocatorArena::release(char * block, unsigned long size) --------------------------
+
+/**
+ * @brief matrixAllocatorScope - Constructor. Makes the arena the source of every allocation of the
+ *                               calling thread until the scope ends.
+ * @param arena                - The arena to allocate from.
+ */
+matrixAllocatorScope::matrixAllocatorScope(matrixAllocatorArena & arena)
+  : mArena(arena), mPrevious(matrixAllocatorActive), mChunk(arena.mCurrent),
+    mOffset(arena.mOffset), mDepth((mPrevious != NULL) ? mPrevious->mDepth + 1 : 1), mLive(0) {
+  matrixAllocatorActive = this;
+} // matrixAllocatorScope::matrixAllocatorScope(matrixAllocatorArena & arena) ----------------------
+
+/**
+ * @brief ~matrixAllocatorScope - Destructor. Recycles all the memory allocated from the arena
+ *                                within the scope, and restores the previously active scope.
+ *                                Exits through "matrixExit()" if a block allocated within the
+ *                                scope is still alive.
+ */
+matrixAllocatorScope::~matrixAllocatorScope() {
+  if (mLive != 0)
+    matrixExit("Matrix allocated within an arena scope outlives the scope.");
+  mArena.mCurrent = mChunk;
+  mArena.mOffset = mOffset;
+  matrixAllocatorActive = mPrevious;
+} // matrixAllocatorScope::~matrixAllocatorScope() -------------------------------------------------
+
+/// ================================================================================================
+/// EXTERNAL FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief matrixAllocatorCalloc - Allocates a block aligned to MATRIXLIBRARY_ALIGNMENT bytes with all
+ *                                the memory cleared to zero.
+ * @param size                  - Size of the block in bytes.
+ * @return                      - Pointer to the block.
+ */
+double * matrixAllocatorCalloc(unsigned long size) {
+#if !defined(_WIN32)
+  if ((matrixAllocatorActive == NULL) && (size >= MATRIXALLOCATOR_LAZY_ZERO)) {
+    unsigned long blockSize = MATRIXLIBRARY_ALIGNMENT + size;
+    void * ptr = mmap(NULL, blockSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED)
+      matrixExit("Matrix memory allocation failed.");
+    matrixAllocatorCounters.heapAlloc++;
+
+    matrixAllocatorHeader * header = (matrixAllocatorHeader *)ptr;
+    header->size = blockSize;
+    header->origin = MATRIXALLOCATOR_ORIGIN_MAPPED;
+    return (double *)((char *)header + MATRIXLIBRARY_ALIGNMENT);
+  }
+#endif
+  double * ptr = matrixAllocatorMalloc(size);
+  memset(ptr, 0, size);
+  return ptr;
+} // double * matrixAllocatorCalloc(unsigned long size) --------------------------------------------
+
+/**
+ * @brief matrixAllocatorFree - Frees a block allocated by "matrixAllocatorMalloc()". NULL is
+ *                              ignored.
+ * @param ptr                 - Pointer to the block.
+ */
+void matrixAllocatorFree(double * ptr) {
+  if (ptr == NULL)
+    return;
+
+  matrixAllocatorHeader * header = (matrixAllocatorHeader *)((char *)ptr - MATRIXLIBRARY_ALIGNMENT);
+  if (header->origin == MATRIXALLOCATOR_ORIGIN_ARENA) {
+    header->scope->mLive--;
+    header->scope->mArena.release((char *)header, header->size);
+  }
+  else if (header->origin == MATRIXALLOCATOR_ORIGIN_POOL)
+    matrixAllocatorPoolFree(header);
+#if !defined(_WIN32)
+  else if (header->origin == MATRIXALLOCATOR_ORIGIN_MAPPED) {
+    munmap(header, header->size);
+    matrixAllocatorCounters.heapFree++;
+  }
+#endif
+  else
+    matrixAllocatorSystemFree(header);
+} // void matrixAllocatorFree(double * ptr) --------------------------------------------------------
+
+/**
+ * @brief matrixAllocatorGetActiveDepth - Returns the depth of the innermost scope of the calling
+ *                                        thread, the number of scopes enclosing it included.
+ * @return                              - The depth, 0 outside of any scope.
+ */
+unsigned long matrixAllocatorGetActiveDepth(void) {
+  return (matrixAllocatorActive != NULL) ? matrixAllocatorActive->mDepth : 0;
+} // unsigned long matrixAllocatorGetActiveDepth(void) ---------------------------------------------
+
+/**
+ * @brief matrixAllocatorGetDepth - Returns the depth of the scope a block was allocated in. A
+ *                                  block outlives every scope of a larger depth.
+ * @param ptr                     - Pointer to the block, or NULL.
+ * @return                        - The depth, 0 if the block does not come from an arena.
+ */
+unsigned long matrixAllocatorGetDepth(const double * ptr) {
+  if (ptr == NULL)
+    return 0;
+
+  const matrixAllocatorHeader * header =
+    (const matrixAllocatorHeader *)((const char *)ptr - MATRIXLIBRARY_ALIGNMENT);
+  return (header->origin == MATRIXALLOCATOR_ORIGIN_ARENA) ? header->scope->mDepth : 0;
+} // unsigned long matrixAllocatorGetDepth(const double * ptr) -------------------------------------
+
+/**
+ * @brief matrixAllocatorGetStats - Returns the allocation counters of the calling thread.
+ * @return                        - The allocation counters.
+ */
+matrixAllocatorStats matrixAllocatorGetStats(void) {
+  return matrixAllocatorCounters;
+} // matrixAllocatorStats matrixAllocatorGetStats(void) --------------------------------------------
+
+/**
+ * @brief matrixAllocatorMalloc - Allocates a block aligned to MATRIXLIBRARY_ALIGNMENT bytes. The
+ *                                memory is not initialised. Aborts when the memory cannot be
+ *                                allocated.
+ * @param size                  - Size of the block in bytes.
+ * @return                      - Pointer to the block.
+ */
+double * matrixAllocatorMalloc(unsigned long size) {
+  unsigned long blockSize = MATRIXLIBRARY_ALIGNMENT + (size + MATRIXLIBRARY_ALIGNMENT - 1) /
+                            MATRIXLIBRARY_ALIGNMENT * MATRIXLIBRARY_ALIGNMENT;
+  matrixAllocatorHeader * header;
+
+  if (matrixAllocatorActive != NULL) {
+    header = (matrixAllocatorHeader *)matrixAllocatorActive->mArena.allocate(blockSize);
+    header->size = blockSize;
+    header->origin = MATRIXALLOCATOR_ORIGIN_ARENA;
+    header->scope = matrixAllocatorActive;
+    matrixAllocatorActive->mLive++;
+    matrixAllocatorCounters.arenaAlloc++;
+  }
+  else {
+    unsigned char sizeClass = 0;
+    while ((sizeClass < MATRIXALLOCATOR_POOL_CLASSES) &&
+           (((unsigned long)MATRIXLIBRARY_ALIGNMENT << sizeClass) < blockSize))
+      sizeClass++;
+
+    if ((matrixAllocatorStrategy == MATRIXALLOCATOR_POOL) &&
+        (sizeClass < MATRIXALLOCATOR_POOL_CLASSES))
+      header = matrixAllocatorPoolMalloc(sizeClass);
+    else {
+      header = (matrixAllocatorHeader *)matrixAllocatorSystemMalloc(blockSize);
+      header->size = blockSize;
+      header->origin = MATRIXALLOCATOR_ORIGIN_SYSTEM;
+    }
+  }
+  return (double *)((char *)header + MATRIXLIBRARY_ALIGNMENT);
+} // double * matrixAllocatorMalloc(unsigned long size) --------------------------------------------
+
+/**
+ * @brief matrixAllocatorMallocOutside - Allocates a block as "matrixAllocatorMalloc()" does outside
+ *                                       of any arena scope, from the pools or the system, whatever
+ *                                       scope is active. The block may outlive the active scope.
+ * @param size                         - Size of the block in bytes.
+ * @return                             - Pointer to the block.
+ */
+double * matrixAllocatorMallocOutside(unsigned long size) {
+  matrixAllocatorScope * active = matrixAllocatorActive;
+  matrixAllocatorActive = NULL;
+  double * ptr = matrixAllocatorMalloc(size);
+  matrixAllocatorActive = active;
+  return ptr;
+} // double * matrixAllocatorMallocOutside(unsigned long size) -------------------------------------
+
+/**
+ * @brief matrixAllocatorResetStats - Clears the allocation counters of the calling thread.
+ */
+void matrixAllocatorResetStats(void) {
+  matrixAllocatorStats zero = {0, 0, 0, 0, 0};
+  matrixAllocatorCounters = zero;
+} // void matrixAllocatorResetStats(void) ----------------------------------------------------------
+
+/**
+ * @brief matrixAllocatorSetStrategy - Selects how blocks are allocated outside of any arena scope.
+ * @param strategy                   - MATRIXALLOCATOR_SYSTEM or MATRIXALLOCATOR_POOL.
+ * @return                           - The previous strategy.
+ */
+unsigned char matrixAllocatorSetStrategy(unsigned char strategy) {
+  unsigned char previous = matrixAllocatorStrategy;
+  matrixAllocatorStrategy = (strategy == MATRIXALLOCATOR_SYSTEM) ? MATRIXALLOCATOR_SYSTEM
+                                                                 : MATRIXALLOCATOR_POOL;
+  return previous;
+} // unsigned char matrixAllocatorSetStrategy(unsigned char strategy) ------------------------------
+
+/**
+ * @brief matrixAllocatorTrim - Returns all the blocks cached in the pools of the calling thread to
+ *                              the system.
+ */
+void matrixAllocatorTrim(void) {
+  for (unsigned long i = 0; i < MATRIXALLOCATOR_POOL_CLASSES; i++) {
+    while (matrixAllocatorPools.head[i] != NULL) {
+      matrixAllocatorHeader * next = matrixAllocatorPools.head[i]->next;
+      matrixAllocatorSystemFree(matrixAllocatorPools.head[i]);
+      matrixAllocatorPools.head[i] = next;
+    }
+    matrixAllocatorPools.count[i] = 0;
+  }
+  matrixAllocatorPools.bytes = 0;
+} // void matrixAllocatorTrim(void) ----------------------------------------------------------------
@@ -0,0 +1,328 @@
+/*
+ * Copyright:   2021 Johnathon Leong
+ *
+ * License:     License under LGPL-3.0-or-later.
+ *              Please refer to https://www.gnu.org/licenses/lgpl-3.0.txt for more information on the
+ *              terms of LGPL-3.0 or relavent website for a later version of the LGPL.
+ *
+ * Disclaimer:  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY
+ *              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ *              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ *              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ *              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *              WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author:      Johnathon Leong
+ *
+ * Note:        Memory allocator of matrixlibrary. Every block is aligned to MATRIXLIBRARY_ALIGNMENT
+ *              bytes and is preceded by a small header recording where it came from, so that a
+ *              block is always returned to its origin whatever the active strategy is when it is
+ *              freed. Blocks are taken, in order of precedence, from:
+ *              1. the arena of the innermost "matrixAllocatorScope" of the calling thread,
+ *              2. the per-thread size class pools, when the strategy is MATRIXALLOCATOR_POOL,
+ *              3. the system allocator.
+ *              The pools and the counters are per thread, so that no lock is taken on any path.
+ *
+ * Version:     1.0.2
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Every arena block records the "matrixAllocatorScope" it was allocated in, and a
+ *                 scope counts its blocks that are not freed yet. A scope that ends while blocks
+ *                 allocated within it are still alive now stops through "matrixExit()" instead of
+ *                 letting them be overwritten, whether the scopes share an arena or not.
+ *              2. Added "matrixAllocatorGetDepth()", "matrixAllocatorGetActiveDepth()" and
+ *                 "matrixAllocatorMallocOutside()", so that a matrix can keep an arena block from
+ *                 outliving its scope.
+ *
+ * Version:     1.0.1
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added "matrixAllocatorCalloc()". Cleared blocks of at least
+ *                 MATRIXALLOCATOR_LAZY_ZERO bytes are mapped directly from the operating system,
+ *                 which zeroes the pages on first touch.
+ *
+ * Version:     1.0.0
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Implemented first release version of matrixlibraryallocator.
+ */
+
+#ifndef MATRIXLIBRARYALLOCATOR_H
+#define MATRIXLIBRARYALLOCATOR_H
+
+/**
+ * @brief MATRIXALLOCATOR_SYSTEM - Every block is allocated from and freed to the system allocator.
+ */
+#define MATRIXALLOCATOR_SYSTEM 0
+
+/**
+ * @brief MATRIXALLOCATOR_POOL - Freed blocks are cached in per-thread size class pools and reused
+ *                               by later allocations of the same size class.
+ */
+#define MATRIXALLOCATOR_POOL 1
+
+/**
+ * @brief MATRIXALLOCATOR_POOL_CLASSES - Number of size classes. Size class i holds blocks of
+ *                                       MATRIXLIBRARY_ALIGNMENT << i bytes, including the header.
+ *                                       Larger blocks bypass the pools.
+ */
+#define MATRIXALLOCATOR_POOL_CLASSES 18
+
+/**
+ * @brief MATRIXALLOCATOR_POOL_DEPTH - Maximum number of cached blocks per size class and thread.
+ *                                     Blocks freed beyond this are returned to the system.
+ */
+#define MATRIXALLOCATOR_POOL_DEPTH 16
+
+/**
+ * @brief MATRIXALLOCATOR_POOL_LIMIT - Maximum number of bytes cached by the pools of a thread.
+ */
+#define MATRIXALLOCATOR_POOL_LIMIT 67108864
+
+/**
+ * @brief MATRIXALLOCATOR_ARENA_CHUNK - Default size, in bytes, of the memory chunks of an arena.
+ */
+#define MATRIXALLOCATOR_ARENA_CHUNK 1048576
+
+/**
+ * @brief MATRIXALLOCATOR_LAZY_ZERO - Cleared blocks of at least this size, in bytes, are mapped
+ *                                    directly from the operating system, which provides zeroed
+ *                                    pages on first touch instead of clearing them up front.
+ */
+#define MATRIXALLOCATOR_LAZY_ZERO 1048576
+
+struct matrixAllocatorChunk;
+class matrixAllocatorScope;
+
+/**
+ * @brief matrixAllocatorStats - Allocation counters of the calling thread.
+ */
+struct matrixAllocatorStats {
+  /**
+   * @brief heapAlloc - Number of blocks allocated from the system allocator.
+   */
+  unsigned long heapAlloc;
+
+  /**
+   * @brief heapFree - Number of blocks freed to the system allocator.
+   */
+  unsigned long heapFree;
+
+  /**
+   * @brief poolAlloc - Number of allocations served from a pool.
+   */
+  unsigned long poolAlloc;
+
+  /**
+   * @brief poolFree - Number of frees cached into a pool.
+   */
+  unsigned long poolFree;
+
+  /**
+   * @brief arenaAlloc - Number of allocations served from an arena.
+   */
+  unsigned long arenaAlloc;
+};
+
+class matrixAllocatorArena
+{
+public:
+  /**
+   * @brief matrixAllocatorArena - Constructor. No memory is allocated until the first allocation.
+   * @param chunkSize            - Size, in bytes, of the memory chunks of the arena.
+   */
+  explicit matrixAllocatorArena(unsigned long chunkSize = MATRIXALLOCATOR_ARENA_CHUNK);
+
+  matrixAllocatorArena(const matrixAllocatorArena &) = delete;
+  matrixAllocatorArena& operator=(const matrixAllocatorArena &) = delete;
+
+  /**
+   * @brief ~matrixAllocatorArena - Destructor. Frees all the memory chunks. The arena must not be
+   *                                active in any scope.
+   */
+  ~matrixAllocatorArena();
+
+private:
+  friend class matrixAllocatorScope;
+  friend double * matrixAllocatorMalloc(unsigned long size);
+  friend void matrixAllocatorFree(double * ptr);
+
+  /**
+   * @brief allocate - Allocates a block from the arena, adding a new chunk when the block fits in
+   *                   none of the existing ones.
+   * @param size     - Size of the block in bytes, including the header.
+   * @return         - Pointer to the block.
+   */
+  char * allocate(unsigned long size);
+
+  /**
+   * @brief release - Releases a block. Only the most recent block is given back immediately, the
+   *                  others are recycled when the scope ends.
+   * @param block   - Pointer to the block.
+   * @param size    - Size of the block in bytes, including the header.
+   */
+  void release(char * block, unsigned long size);
+
+  /**
+   * @brief mHead - First memory chunk.
+   */
+  matrixAllocatorChunk * mHead;
+
+  /**
+   * @brief mCurrent - Memory chunk being allocated from.
+   */
+  matrixAllocatorChunk * mCurrent;
+
+  /**
+   * @brief mOffset - Number of bytes in use in the current chunk.
+   */
+  unsigned long mOffset;
+
+  /**
+   * @brief mChunkSize - Size, in bytes, of the memory chunks.
+   */
+  unsigned long mChunkSize;
+};
+
+class matrixAllocatorScope
+{
+public:
+  /**
+   * @brief matrixAllocatorScope - Constructor. Makes the arena the source of every allocation of
+   *                               the calling thread until the scope ends. A matrix moved into a
+   *                               matrix whose memory comes from an enclosing scope, or from no
+   *                               scope at all, is copied, so that results can be assigned to
+   *                               matrices outside of the scope.
+   *                               IMPORTANT NOTE: EVERY MATRIX ALLOCATED WITHIN THE SCOPE MUST BE
+   *                                               DESTROYED OR RELEASED BEFORE THE SCOPE ENDS.
+   * @param arena                - The arena to allocate from.
+   */
+  explicit matrixAllocatorScope(matrixAllocatorArena & arena);
+
+  matrixAllocatorScope(const matrixAllocatorScope &) = delete;
+  matrixAllocatorScope& operator=(const matrixAllocatorScope &) = delete;
+
+  /**
+   * @brief ~matrixAllocatorScope - Destructor. Recycles all the memory allocated from the arena
+   *                                within the scope, and restores the previously active scope.
+   *                                Exits through "matrixExit()" if a block allocated within the
+   *                                scope is still alive.
+   */
+  ~matrixAllocatorScope();
+
+private:
+  friend double * matrixAllocatorMalloc(unsigned long size);
+  friend void matrixAllocatorFree(double * ptr);
+  friend unsigned long matrixAllocatorGetActiveDepth(void);
+  friend unsigned long matrixAllocatorGetDepth(const double * ptr);
+
+  /**
+   * @brief mArena - The arena of the scope.
+   */
+  matrixAllocatorArena & mArena;
+
+  /**
+   * @brief mPrevious - The scope that was active when the scope started, NULL if none.
+   */
+  matrixAllocatorScope * mPrevious;
+
+  /**
+   * @brief mChunk - Current chunk of the arena when the scope started.
+   */
+  matrixAllocatorChunk * mChunk;
+
+  /**
+   * @brief mOffset - Offset in the current chunk of the arena when the scope started.
+   */
+  unsigned long mOffset;
+
+  /**
+   * @brief mDepth - Number of scopes of the thread enclosing the scope, including itself.
+   */
+  unsigned long mDepth;
+
+  /**
+   * @brief mLive - Number of blocks allocated within the scope and not freed yet.
+   */
+  unsigned long mLive;
+};
+
+/**
+ * @brief matrixAllocatorCalloc - Allocates a block aligned to MATRIXLIBRARY_ALIGNMENT bytes with
+ *                                all the memory cleared to zero. Blocks of at least
+ *                                MATRIXALLOCATOR_LAZY_ZERO bytes allocated outside of any arena
+ *                                scope are cleared lazily by the operating system. Aborts when
+ *                                the memory cannot be allocated.
+ * @param size                  - Size of the block in bytes.
+ * @return                      - Pointer to the block.
+ */
+double * matrixAllocatorCalloc(unsigned long size);
+
+/**
+ * @brief matrixAllocatorFree - Frees a block allocated by "matrixAllocatorMalloc()". NULL is
+ *                              ignored.
+ * @param ptr                 - Pointer to the block.
+ */
+void matrixAllocatorFree(double * ptr);
+
+/**
+ * @brief matrixAllocatorGetActiveDepth - Returns the depth of the innermost scope of the calling
+ *                                        thread, the number of scopes enclosing it included.
+ * @return                              - The depth, 0 outside of any scope.
+ */
+unsigned long matrixAllocatorGetActiveDepth(void);
+
+/**
+ * @brief matrixAllocatorGetDepth - Returns the depth of the scope a block was allocated in. A
+ *                                  block outlives every scope of a larger depth.
+ * @param ptr                     - Pointer to the block, or NULL.
+ * @return                        - The depth, 0 if the block does not come from an arena.
+ */
+unsigned long matrixAllocatorGetDepth(const double * ptr);
+
+/**
+ * @brief matrixAllocatorGetStats - Returns the allocation counters of the calling thread.
+ * @return                        - The allocation counters.
+ */
+matrixAllocatorStats matrixAllocatorGetStats(void);
+
+/**
+ * @brief matrixAllocatorMalloc - Allocates a block aligned to MATRIXLIBRARY_ALIGNMENT bytes. The
+ *                                memory is not initialised. Aborts when the memory cannot be
+ *                                allocated.
+ * @param size                  - Size of the block in bytes.
+ * @return                      - Pointer to the block.
+ */
+double * matrixAllocatorMalloc(unsigned long size);
+
+/**
+ * @brief matrixAllocatorMallocOutside - Allocates a block as "matrixAllocatorMalloc()" does outside
+ *                                       of any arena scope, from the pools or the system, whatever
+ *                                       scope is active. The block may outlive the active scope.
+ * @param size                         - Size of the block in bytes.
+ * @return                             - Pointer to the block.
+ */
+double * matrixAllocatorMallocOutside(unsigned long size);
+
+/**
+ * @brief matrixAllocatorResetStats - Clears the allocation counters of the calling thread.
+ */
+void matrixAllocatorResetStats(void);
+
+/**
+ * @brief matrixAllocatorSetStrategy - Selects how blocks are allocated outside of any arena scope.
+ *                                     The default strategy is MATRIXALLOCATOR_POOL. This is meant
+ *                                     to be called during start up, before any matrix operation
+ *                                     runs on another thread.
+ * @param strategy                   - MATRIXALLOCATOR_SYSTEM or MATRIXALLOCATOR_POOL.
+ * @return                           - The previous strategy.
+ */
+unsigned char matrixAllocatorSetStrategy(unsigned char strategy);
+
+/**
+ * @brief matrixAllocatorTrim - Returns all the blocks cached in the pools of the calling thread to
+ *                              the system. The pools of a thread are also trimmed when it exits.
+ */
+void matrixAllocatorTrim(void);
+
+#endif // MATRIXLIBRARYALLOCATOR_H
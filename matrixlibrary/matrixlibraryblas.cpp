@@ -0,0 +1,184 @@
+/*
+ * Copyright:   2021 Johnathon Leong
+ *
+ * License:     License under LGPL-3.0-or-later.
+ *              Please refer to https://www.gnu.org/licenses/lgpl-3.0.txt for more information on the
+ *              terms of LGPL-3.0 or relavent website for a later version of the LGPL.
+ *
+ * Disclaimer:  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY
+ *              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ *              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ *              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ *              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *              WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author:      Johnathon Leong
+ *
+ * Note:        BLAS style level 3 routines of matrixlibrary. The routines accumulate into an existing
+ *              output matrix or view and read transposed operands in place, so that they allocate
+ *              no memory beyond the packing buffers of the kernels, which are served by the pools of
+ *              matrixlibraryallocator once warm.
+ *
+ * Version:     1.0.1
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the symmetric rank-k update "matrixSyrk()" and "matrixGram()".
+ *
+ * Version:     1.0.0
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Implemented first release version of matrixlibraryblas.
+ */
+
+
+#include "matrixlibraryblas.h"
+#include "matrixlibrarykernels.h"
+
+/// ================================================================================================
+/// STATIC FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief matrixBlasOverlap - Checks whether two row-major blocks share any memory.
+ * @param X                 - Pointer to the first element of X.
+ * @param rowX              - Row size of X.
+ * @param colX              - Column size of X.
+ * @param ldx               - Leading dimension of X.
+ * @param Y                 - Pointer to the first element of Y.
+ * @param rowY              - Row size of Y.
+ * @param colY              - Column size of Y.
+ * @param ldy               - Leading dimension of Y.
+ * @return                  - True if the memory spans of the blocks overlap.
+ */
+template <typename T>
+static bool matrixBlasOverlap(const T * X, unsigned long rowX, unsigned long colX, unsigned long ldx,
+                              const T * Y, unsigned long rowY, unsigned long colY, unsigned long ldy) {
+  if ((rowX == 0) || (colX == 0) || (rowY == 0) || (colY == 0))
+    return false;
+  const T * endX = X + (rowX - 1) * ldx + colX;
+  const T * endY = Y + (rowY - 1) * ldy + colY;
+  return (X < endY) && (Y < endX);
+} // bool matrixBlasOverlap(const T * X, unsigned long rowX, unsigned long colX, unsigned long ldx, const T * Y, unsigned long rowY, unsigned long colY, unsigned long ldy)
+
+/**
+ * @brief matrixBlasGemm - General matrix multiplication shared by the scalar types. The operands
+ *                         are given as row-major blocks and their sizes are checked against C.
+ *                         The remaining arguments are the same as "matrixGemm()".
+ * @param rowA           - Row size of A as stored.
+ * @param colA           - Column size of A as stored.
+ * @param lda            - Leading dimension of A.
+ * @param rowB           - Row size of B as stored.
+ * @param colB           - Column size of B as stored.
+ * @param ldb            - Leading dimension of B.
+ * @param rowC           - Row size of C.
+ * @param colC           - Column size of C.
+ * @param ldc            - Leading dimension of C.
+ */
+template <typename T>
+static void matrixBlasGemm(T alpha, const T * A, unsigned long rowA, unsigned long colA,
+                           unsigned long lda, bool transA,
+                           const T * B, unsigned long rowB, unsigned long colB,
+                           unsigned long ldb, bool transB,
+                           T beta, T * C, unsigned long rowC, unsigned long colC,
+                           unsigned long ldc) {
+  unsigned long m = transA ? colA : rowA;
+  unsigned long k = transA ? rowA : colA;
+  unsigned long n = transB ? rowB : colB;
+
+  if ((transB ? colB : rowB) != k)
+    matrixExit("Matrices inner size mismatch.");
+  if ((rowC != m) || (colC != n))
+    matrixExit("Matrices size mismatch.");
+  if (matrixBlasOverlap(C, rowC, colC, ldc, A, rowA, colA, lda) ||
+      matrixBlasOverlap(C, rowC, colC, ldc, B, rowB, colB, ldb))
+    matrixExit("The result matrix overlaps an operand.");
+
+  // a transposed operand is read in place by swapping its row and column strides
+  matrixKernelsGemm(m, n, k, alpha,
+                    A, transA ? 1 : lda, transA ? lda : 1,
+                    B, transB ? 1 : ldb, transB ? ldb : 1,
+                    beta, C, ldc);
+} // void matrixBlasGemm(T alpha, const T * A, unsigned long rowA, unsigned long colA, unsigned long lda, bool transA, const T * B, unsigned long rowB, unsigned long colB, unsigned long ldb, bool transB, T beta, T * C, unsigned long rowC, unsigned long colC, unsigned long ldc)
+
+/// ================================================================================================
+/// EXTERNAL FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief matrixGemm - General matrix multiplication, C = alpha * op(A) * op(B) + beta * C, where
+ *                     op(X) is X or its transpose. The transposed operands are read in place and
+ *                     the result is accumulated into C, which must already have the size of the
+ *                     product and must not overlap A or B. When beta is zero, C is not read. A
+ *                     matrix can be passed wherever a view is expected.
+ * @param alpha      - Scaling of the product op(A) * op(B).
+ * @param A          - First operand.
+ * @param transA     - Uses the transpose of A when true.
+ * @param B          - Second operand.
+ * @param transB     - Uses the transpose of B when true.
+ * @param beta       - Scaling of C.
+ * @param C          - The result.
+ */
+void matrixGemm(double alpha, const matrixView & A, bool transA, const matrixView & B, bool transB,
+                double beta, const matrixView & C) {
+  matrixBlasGemm(alpha, A.mMat, A.getRowSize(), A.getColSize(), A.getLd(), transA,
+                 B.mMat, B.getRowSize(), B.getColSize(), B.getLd(), transB,
+                 beta, C.mMat, C.getRowSize(), C.getColSize(), C.getLd());
+} // void matrixGemm(double alpha, const matrixView & A, bool transA, const matrixView & B, bool transB, double beta, const matrixView & C)
+
+/**
+ * @brief matrixGemm - Single precision general matrix multiplication,
+ *                     C = alpha * op(A) * op(B) + beta * C. The arguments are the same as the
+ *                     double precision version.
+ * @param alpha      - Scaling of the product op(A) * op(B).
+ * @param A          - First operand.
+ * @param transA     - Uses the transpose of A when true.
+ * @param B          - Second operand.
+ * @param transB     - Uses the transpose of B when true.
+ * @param beta       - Scaling of C.
+ * @param C          - The result.
+ */
+void matrixGemm(float alpha, const matrixFloat & A, bool transA, const matrixFloat & B, bool transB,
+                float beta, matrixFloat & C) {
+  matrixBlasGemm(alpha, A.mMat, A.getRowSize(), A.getColSize(), A.getLd(), transA,
+                 B.mMat, B.getRowSize(), B.getColSize(), B.getLd(), transB,
+                 beta, C.mMat, C.getRowSize(), C.getColSize(), C.getLd());
+} // void matrixGemm(float alpha, const matrixFloat & A, bool transA, const matrixFloat & B, bool transB, float beta, matrixFloat & C)
+
+/**
+ * @brief matrixGram - Computes the Gram matrix op(A) * op(A)^T, where op(A) is A or its transpose,
+ *                     with "matrixSyrk()". The default A^T * A is the Gram matrix of the columns
+ *                     of A, as used by the normal equations and covariances.
+ * @param A          - The matrix.
+ * @param transA     - Uses the transpose of A when true.
+ * @return           - The symmetric Gram matrix.
+ */
+matrix matrixGram(const matrixView & A, bool transA) {
+  unsigned long n = transA ? A.getColSize() : A.getRowSize();
+  matrix Z(n, n, matrixUninitialized);
+  matrixSyrk(1.0, A, transA, 0.0, Z);
+  return Z;
+} // matrix matrixGram(const matrixView & A, bool transA) ------------------------------------------
+
+/**
+ * @brief matrixSyrk - Symmetric rank-k update, C = alpha * op(A) * op(A)^T + beta * C, where op(A)
+ *                     is A or its transpose, read in place. Only the lower triangle is computed,
+ *                     with about half the flops of "matrixGemm()", and it is then mirrored into
+ *                     the upper triangle. C must already be square with the row size of op(A), and
+ *                     must not overlap A. When beta is zero, C is not read.
+ * @param alpha      - Scaling of the product op(A) * op(A)^T.
+ * @param A          - The operand.
+ * @param transA     - Uses the transpose of A when true.
+ * @param beta       - Scaling of C.
+ * @param C          - The result.
+ */
+void matrixSyrk(double alpha, const matrixView & A, bool transA, double beta, const matrixView & C) {
+  unsigned long n = transA ? A.getColSize() : A.getRowSize();
+  unsigned long k = transA ? A.getRowSize() : A.getColSize();
+
+  if ((C.getRowSize() != n) || (C.getColSize() != n))
+    matrixExit("Matrices size mismatch.");
+  if (matrixBlasOverlap(C.mMat, n, n, C.getLd(), A.mMat, A.getRowSize(), A.getColSize(), A.getLd()))
+    matrixExit("The result matrix overlaps an operand.");
+
+  matrixKernelsSyrk(n, k, alpha, A.mMat, transA ? 1 : A.getLd(), transA ? A.getLd() : 1,
+                    beta, C.mMat, C.getLd());
+} // void matrixSyrk(double alpha, const matrixView & A, bool transA, double beta, const matrixView & C)
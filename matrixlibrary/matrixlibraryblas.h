@@ -0,0 +1,89 @@
+/*
+ * Copyright:   2021 Johnathon Leong
+ *
+ * License:     License under LGPL-3.0-or-later.
+ *              Please refer to https://www.gnu.org/licenses/lgpl-3.0.txt for more information on the
+ *              terms of LGPL-3.0 or relavent website for a later version of the LGPL.
+ *
+ * Disclaimer:  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY
+ *              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ *              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ *              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ *              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *              WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author:      Johnathon Leong
+ *
+ * Note:        BLAS style level 3 routines of matrixlibrary. The routines accumulate into an existing
+ *              output matrix or view and read transposed operands in place, so that they allocate
+ *              no memory beyond the packing buffers of the kernels, which are served by the pools of
+ *              matrixlibraryallocator once warm.
+ *
+ * Version:     1.0.1
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the symmetric rank-k update "matrixSyrk()" and "matrixGram()".
+ *
+ * Version:     1.0.0
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Implemented first release version of matrixlibraryblas.
+ */
+
+#ifndef MATRIXLIBRARYBLAS_H
+#define MATRIXLIBRARYBLAS_H
+
+#include "matrixlibraryfloat.h"
+#include "matrixlibraryview.h"
+
+/**
+ * @brief matrixGemm - General matrix multiplication, C = alpha * op(A) * op(B) + beta * C, where
+ *                     op(X) is X or its transpose. The transposed operands are read in place and
+ *                     the result is accumulated into C, which must already have the size of the
+ *                     product and must not overlap A or B. When beta is zero, C is not read. A
+ *                     matrix can be passed wherever a view is expected.
+ * @param alpha      - Scaling of the product op(A) * op(B).
+ * @param A          - First operand.
+ * @param transA     - Uses the transpose of A when true.
+ * @param B          - Second operand.
+ * @param transB     - Uses the transpose of B when true.
+ * @param beta       - Scaling of C.
+ * @param C          - The result.
+ */
+void matrixGemm(double alpha, const matrixView & A, bool transA, const matrixView & B, bool transB,
+                double beta, const matrixView & C);
+
+/**
+ * @brief matrixGemm - Single precision general matrix multiplication,
+ *                     C = alpha * op(A) * op(B) + beta * C. The arguments are the same as the
+ *                     double precision version.
+ */
+void matrixGemm(float alpha, const matrixFloat & A, bool transA, const matrixFloat & B, bool transB,
+                float beta, matrixFloat & C);
+
+/**
+ * @brief matrixGram - Computes the Gram matrix op(A) * op(A)^T, where op(A) is A or its transpose,
+ *                     with "matrixSyrk()". The default A^T * A is the Gram matrix of the columns
+ *                     of A, as used by the normal equations and covariances.
+ * @param A          - The matrix.
+ * @param transA     - Uses the transpose of A when true.
+ * @return           - The symmetric Gram matrix.
+ */
+matrix matrixGram(const matrixView & A, bool transA = true);
+
+/**
+ * @brief matrixSyrk - Symmetric rank-k update, C = alpha * op(A) * op(A)^T + beta * C, where op(A)
+ *                     is A or its transpose, read in place. Only the lower triangle is computed,
+ *                     with about half the flops of "matrixGemm()", and it is then mirrored into
+ *                     the upper triangle. C must already be square with the row size of op(A), and
+ *                     must not overlap A. When beta is zero, C is not read.
+ * @param alpha      - Scaling of the product op(A) * op(A)^T.
+ * @param A          - The operand.
+ * @param transA     - Uses the transpose of A when true.
+ * @param beta       - Scaling of C.
+ * @param C          - The result.
+ */
+void matrixSyrk(double alpha, const matrixView & A, bool transA, double beta, const matrixView & C);
+
+#endif // MATRIXLIBRARYBLAS_H
@@ -17,7 +17,28 @@
  *
  * Author:      Johnathon Leong
  *
- * Note:        To be used together with matrixlibrary.
+ * Note:        To be used together with matrixlibrary and matrixlibrarysimd.
+ *
+ * Version:     1.0.5
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The result matrix of the element wise operations is allocated uninitialized.
+ *
+ * Version:     1.0.4
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The element wise operations are now performed through the strided kernels,
+ *                 honouring the leading dimension of the resultant matrix.
+ *
+ * Version:     1.0.3
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added view overloads of all the functions. The matrix overloads forward to them.
+ *              2. Added in place "matrixCellOperationsSwapRows()" and
+ *                 "matrixCellOperationsSwapCols()" on views. The matrix versions no longer copy the
+ *                 swapped rows and columns through submatrices.
+ *
+ * Version:     1.0.2
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The functions "matrixCellOperationsDivide()" and "matrixCellOperationsMultiply()"
+ *                 now run on the runtime dispatched SIMD kernels of matrixlibrarysimd.
  *
  * Version:     1.0.1
  * Date:        2021/08/03 (YYYY/MM/DD)
@@ -30,7 +51,34 @@
  */
 
 #include "matrixlibrarycelloperations.h"
+#include "matrixlibrarykernels.h"
+#include "matrixlibrarysimd.h"
+
+/// ================================================================================================
+/// STATIC FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief matrixCellOperationsApply - Applies a SIMD element wise kernel between two views, row by
+ *                                    row, into a new matrix.
+ * @param kernel                    - The element wise kernel.
+ * @param X                         - Main view.
+ * @param Y                         - Second view.
+ * @return                          - Resultant matrix.
+ */
+static matrix matrixCellOperationsApply(void (*kernel)(unsigned long, const double *, const double *, double *),
+                                        const matrixView & X, const matrixView & Y) {
+  if ((X.getRowSize() != Y.getRowSize()) || (X.getColSize() != Y.getColSize()))
+    matrixExit("Matrices size mismatch.");
+
+  matrix Z(X.getRowSize(), X.getColSize(), matrixUninitialized);
+  matrixKernelsApply(kernel, X.getRowSize(), X.getColSize(), X.mMat, X.getLd(), Y.mMat, Y.getLd(),
+                     Z.mMat, Z.getLd());
+  return Z;
+} // matrix matrixCellOperationsApply(void (*kernel)(unsigned long, const double *, const double *, double *), const matrixView & X, const matrixView & Y)
 
+/// ================================================================================================
+/// EXTERNAL FUNCTIONS
+/// ================================================================================================
 /**
  * @brief matrixCellOperationsDivide - Perform cell to cell division between two matrices.
  * @param X                          - Main matrix.
@@ -38,15 +86,19 @@
  * @return                           - Resultant matrix.
  */
 matrix matrixCellOperationsDivide(const matrix & X, const matrix & Y) {
-  matrix Z;
-  if (matrixCheckIsEqualSize(X, Y)) {
-    Z.resizeClear(X.getRowSize(), X.getColSize());
-    for (unsigned long i = 0; i < X.getSize(); i++)
-      Z.mMat[i] = X.mMat[i] / Y.mMat[i];
-  }
-  return Z;
+  return matrixCellOperationsApply(matrixSimd().divide, X, Y);
 } // matrixCellOperationsDivide(const matrix & X, const matrix & Y) --------------------------------
 
+/**
+ * @brief matrixCellOperationsDivide - Perform cell to cell division between two views.
+ * @param X                          - Main view.
+ * @param Y                          - Divisor view.
+ * @return                           - Resultant matrix.
+ */
+matrix matrixCellOperationsDivide(const matrixView & X, const matrixView & Y) {
+  return matrixCellOperationsApply(matrixSimd().divide, X, Y);
+} // matrixCellOperationsDivide(const matrixView & X, const matrixView & Y) ------------------------
+
 /**
  * @brief matrixCellOperationsMultiply - Perform cell to cell multiplication between two matrices.
  * @param X                            - Main matrix.
@@ -54,15 +106,19 @@ matrix matrixCellOperationsDivide(const matrix & X, const matrix & Y) {
  * @return                             - Resultant matrix.
  */
 matrix matrixCellOperationsMultiply(const matrix & X, const matrix & Y) {
-  matrix Z;
-  if (matrixCheckIsEqualSize(X, Y)) {
-    Z.resizeClear(X.getRowSize(), X.getColSize());
-    for (unsigned long i = 0; i < X.getSize(); i++)
-      Z.mMat[i] = X.mMat[i] * Y.mMat[i];
-  }
-  return Z;
+  return matrixCellOperationsApply(matrixSimd().multiply, X, Y);
 } // matrixCellOperationsMultiply(const matrix & X, const matrix & Y) ------------------------------
 
+/**
+ * @brief matrixCellOperationsMultiply - Perform cell to cell multiplication between two views.
+ * @param X                            - Main view.
+ * @param Y                            - Multiplier view.
+ * @return                             - Resultant matrix.
+ */
+matrix matrixCellOperationsMultiply(const matrixView & X, const matrixView & Y) {
+  return matrixCellOperationsApply(matrixSimd().multiply, X, Y);
+} // matrixCellOperationsMultiply(const matrixView & X, const matrixView & Y) ----------------------
+
 /**
  * @brief matrixCellOperationsSwapCols - Swap the elements of two columns.
  * @param X                            - The matrix whose columns are to be swapped.
@@ -72,11 +128,31 @@ matrix matrixCellOperationsMultiply(const matrix & X, const matrix & Y) {
  */
 matrix matrixCellOperationsSwapCols(const matrix & X, unsigned long col1, unsigned long col2) {
   matrix Z = X;
-  Z(1, col1, X(1, X.getRowSize(), col2, col2));
-  Z(1, col2, X(1, X.getRowSize(), col1, col1));
+  matrixCellOperationsSwapCols(Z.view(), col1, col2);
   return Z;
 } // matrix matrixCellOperationsSwapCols(const matrix & X, unsigned long col1, unsigned long col2) -
 
+/**
+ * @brief matrixCellOperationsSwapCols - Swap the elements of two columns of a view, in place.
+ * @param X                            - The view whose columns are to be swapped.
+ * @param col1                         - Index of the first column to be swapped.
+ * @param col2                         - Index of the second column to be swapped.
+ */
+void matrixCellOperationsSwapCols(const matrixView & X, unsigned long col1, unsigned long col2) {
+  if ((col1 == 0) || (col2 == 0) || (col1 > X.getColSize()) || (col2 > X.getColSize()))
+    matrixExit("Matrix column index out of range.");
+  if (col1 == col2)
+    return;
+
+  double * x1 = &X.mMat[col1 - 1];
+  double * x2 = &X.mMat[col2 - 1];
+  for (unsigned long i = 0; i < X.getRowSize(); i++) {
+    double t = x1[i * X.getLd()];
+    x1[i * X.getLd()] = x2[i * X.getLd()];
+    x2[i * X.getLd()] = t;
+  }
+} // void matrixCellOperationsSwapCols(const matrixView & X, unsigned long col1, unsigned long col2)
+
 /**
  * @brief matrixCellOperationsSwapRows - Swap the elements of two rows.
  * @param X                            - The matrix whose rows are to be swapped.
@@ -86,7 +162,27 @@ matrix matrixCellOperationsSwapCols(const matrix & X, unsigned long col1, unsign
  */
 matrix matrixCellOperationsSwapRows(const matrix & X, unsigned long row1, unsigned long row2) {
   matrix Z = X;
-  Z(row1, 1, X(row2, row2, 1, X.getColSize()));
-  Z(row2, 1, X(row1, row1, 1, X.getColSize()));
+  matrixCellOperationsSwapRows(Z.view(), row1, row2);
   return Z;
 } // matrix matrixCellOperationsSwapRows(const matrix & X, unsigned long row1, unsigned long row2) -
+
+/**
+ * @brief matrixCellOperationsSwapRows - Swap the elements of two rows of a view, in place.
+ * @param X                            - The view whose rows are to be swapped.
+ * @param row1                         - Index of the first row to be swapped.
+ * @param row2                         - Index of the second row to be swapped.
+ */
+void matrixCellOperationsSwapRows(const matrixView & X, unsigned long row1, unsigned long row2) {
+  if ((row1 == 0) || (row2 == 0) || (row1 > X.getRowSize()) || (row2 > X.getRowSize()))
+    matrixExit("Matrix row index out of range.");
+  if (row1 == row2)
+    return;
+
+  double * x1 = &X.mMat[(row1 - 1) * X.getLd()];
+  double * x2 = &X.mMat[(row2 - 1) * X.getLd()];
+  for (unsigned long j = 0; j < X.getColSize(); j++) {
+    double t = x1[j];
+    x1[j] = x2[j];
+    x2[j] = t;
+  }
+} // void matrixCellOperationsSwapRows(const matrixView & X, unsigned long row1, unsigned long row2)
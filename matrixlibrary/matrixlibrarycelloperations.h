@@ -17,7 +17,28 @@
  *
  * Author:      Johnathon Leong
  *
- * Note:        To be used together with matrixlibrary.
+ * Note:        To be used together with matrixlibrary and matrixlibrarysimd.
+ *
+ * Version:     1.0.5
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The result matrix of the element wise operations is allocated uninitialized.
+ *
+ * Version:     1.0.4
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The element wise operations are now performed through the strided kernels,
+ *                 honouring the leading dimension of the resultant matrix.
+ *
+ * Version:     1.0.3
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added view overloads of all the functions. The matrix overloads forward to them.
+ *              2. Added in place "matrixCellOperationsSwapRows()" and
+ *                 "matrixCellOperationsSwapCols()" on views. The matrix versions no longer copy the
+ *                 swapped rows and columns through submatrices.
+ *
+ * Version:     1.0.2
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The functions "matrixCellOperationsDivide()" and "matrixCellOperationsMultiply()"
+ *                 now run on the runtime dispatched SIMD kernels of matrixlibrarysimd.
  *
  * Version:     1.0.1
  * Date:        2021/08/03 (YYYY/MM/DD)
@@ -42,6 +63,14 @@
  */
 matrix matrixCellOperationsDivide(const matrix & X, const matrix & Y);
 
+/**
+ * @brief matrixCellOperationsDivide - Perform cell to cell division between two views.
+ * @param X                          - Main view.
+ * @param Y                          - Divisor view.
+ * @return                           - Resultant matrix.
+ */
+matrix matrixCellOperationsDivide(const matrixView & X, const matrixView & Y);
+
 /**
  * @brief matrixCellOperationsMultiply - Perform cell to cell multiplication between two matrices.
  * @param X                            - Main matrix.
@@ -50,6 +79,14 @@ matrix matrixCellOperationsDivide(const matrix & X, const matrix & Y);
  */
 matrix matrixCellOperationsMultiply(const matrix & X, const matrix & Y);
 
+/**
+ * @brief matrixCellOperationsMultiply - Perform cell to cell multiplication between two views.
+ * @param X                            - Main view.
+ * @param Y                            - Multiplier view.
+ * @return                             - Resultant matrix.
+ */
+matrix matrixCellOperationsMultiply(const matrixView & X, const matrixView & Y);
+
 /**
  * @brief matrixCellOperationsSwapCols - Swap the elements of two columns.
  * @param X                            - The matrix whose columns are to be swapped.
@@ -59,6 +96,14 @@ matrix matrixCellOperationsMultiply(const matrix & X, const matrix & Y);
  */
 matrix matrixCellOperationsSwapCols(const matrix & X, unsigned long col1, unsigned long col2);
 
+/**
+ * @brief matrixCellOperationsSwapCols - Swap the elements of two columns of a view, in place.
+ * @param X                            - The view whose columns are to be swapped.
+ * @param col1                         - Index of the first column to be swapped.
+ * @param col2                         - Index of the second column to be swapped.
+ */
+void matrixCellOperationsSwapCols(const matrixView & X, unsigned long col1, unsigned long col2);
+
 /**
  * @brief matrixCellOperationsSwapRows - Swap the elements of two rows.
  * @param X                            - The matrix whose rows are to be swapped.
@@ -68,4 +113,12 @@ matrix matrixCellOperationsSwapCols(const matrix & X, unsigned long col1, unsign
  */
 matrix matrixCellOperationsSwapRows(const matrix & X, unsigned long row1, unsigned long row2);
 
+/**
+ * @brief matrixCellOperationsSwapRows - Swap the elements of two rows of a view, in place.
+ * @param X                            - The view whose rows are to be swapped.
+ * @param row1                         - Index of the first row to be swapped.
+ * @param row2                         - Index of the second row to be swapped.
+ */
+void matrixCellOperationsSwapRows(const matrixView & X, unsigned long row1, unsigned long row2);
+
 #endif // MATRIXLIBRARYCELLOPERATIONS_H
@@ -19,6 +19,10 @@
  *
  * Note:        To be used together with matrixlibrary.
  *
+ * Version:     1.0.1
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The matrix is now written row by row using its leading dimension.
+ *
  * Version:     1.0.0
  * Date:        2021/07/28 (YYYY/MM/DD)
  * Change Log:  1. Implemented first release version of matrixlibrarycsv.
@@ -96,7 +100,7 @@ unsigned char matrixCsvReadIsNumeric(const char * str) {
       return 0;
   }
   return 1;
-} // matrixCsvReadIsNumeric(const char* str) -------------------------------------------------------
+} // unsigned char matrixCsvReadIsNumeric(const char * str) ----------------------------------------
 
 /**
  * @brief matrixCsvReadExtract - Extract numbers from a string data line of the csv file.
@@ -192,15 +196,16 @@ matrix matrixCsvRead(const char * filename) {
  */
 void matrixCsvWrite(const char * filename, const matrix & X) {
   FILE * ptr = fopen(filename, "w");
-  unsigned long index = X.getColSize() - 1;
 
-  for (unsigned long i = 0; i < X.getSize(); i++) {
-    if (i < index) {
-      fprintf(ptr, "%.12f,", X.mMat[i]);
-    }
-    else {
-      fprintf(ptr, "%.12f\n", X.mMat[i]);
-      index += X.getColSize();
+  for (unsigned long i = 0; i < X.getRowSize(); i++) {
+    const double * x = &X.mMat[i * X.getLd()];
+    for (unsigned long j = 0; j < X.getColSize(); j++) {
+      if (j + 1 < X.getColSize()) {
+        fprintf(ptr, "%.12f,", x[j]);
+      }
+      else {
+        fprintf(ptr, "%.12f\n", x[j]);
+      }
     }
   }
 
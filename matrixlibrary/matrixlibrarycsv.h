@@ -19,6 +19,10 @@
  *
  * Note:        To be used together with matrixlibrary.
  *
+ * Version:     1.0.1
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The matrix is now written row by row using its leading dimension.
+ *
  * Version:     1.0.0
  * Date:        2021/07/28 (YYYY/MM/DD)
  * Change Log:  1. Implemented first release version of matrixlibrarycsv.
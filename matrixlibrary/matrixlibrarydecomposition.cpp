@@ -17,9 +17,49 @@
  *
  * Author:      Johnathon Leong
  *
- * Note:        To be used together with: matrixlibrary,
- *                                        matrixlibrarycelloperations, and
- *                                        matrixlibrarymaths
+ * Note:        To be used together with: matrixlibrary, and
+ *                                        matrixlibrarylapack
+ *
+ * Version:     1.0.8
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the tall and skinny QR decomposition "matrixDecompositionQRTallSkinny()",
+ *                 which returns R, and the first rows of Q^T * B for a right-hand side B, without
+ *                 forming Q, in memory independent of the row size.
+ *
+ * Version:     1.0.7
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the Cholesky decomposition of symmetric positive definite matrices
+ *                 "matrixDecompositionCholesky()", its in place version
+ *                 "matrixDecompositionCholeskyInPlace()" and the solver
+ *                 "matrixDecompositionCholeskySolve()", on the blocked and parallel
+ *                 "matrixLapackPotrf()".
+ *
+ * Version:     1.0.6
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. "matrixDecompositionQR()" now uses the blocked Householder QR of
+ *                 "matrixLapackGeqrf()", whose trailing updates are GEMM calls on compact WY block
+ *                 reflectors, instead of the Gram-Schmidt process. Q is formed from the reflectors
+ *                 only when it is asked for.
+ *              2. Added an overload of "matrixDecompositionQR()" returning only R,
+ *                 "matrixDecompositionQRInPlace()" returning the packed factorization, and
+ *                 "matrixDecompositionQRMultiply()" to apply Q or Q^T without forming Q.
+ *
+ * Version:     1.0.5
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. "matrixDecompositionLU()" now factorizes in place in a single buffer with the
+ *                 blocked LU factorization with partial pivoting of "matrixLapackGetrf()", whose
+ *                 trailing updates are GEMM calls. The pivot is now chosen from the updated column,
+ *                 as partial pivoting requires.
+ *              2. Added "matrixDecompositionLUInPlace()", which returns the pivot index vector
+ *                 instead of the dense permutation matrix.
+ *
+ * Version:     1.0.4
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added view overloads of "matrixDecompositionLU()" and "matrixDecompositionQR()".
+ *                 The matrix overloads forward to them.
+ *              2. The pivoting of "matrixDecompositionLU()" and the column updates of
+ *                 "matrixDecompositionQR()" now work in place on views instead of copied rows and
+ *                 columns.
  *
  * Version:     1.0.3
  * Date:        2021/08/05 (YYYY/MM/DD)
@@ -43,72 +83,178 @@
  */
 
 #include "matrixlibrarydecomposition.h"
-#include "matrixlibrarycelloperations.h"
-#include "matrixlibrarymaths.h"
+#include "matrixlibrarylapack.h"
+#include <algorithm>
+#include <functional>
 #include <stdio.h>
 
+/// ================================================================================================
+/// STATIC FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief matrixDecompositionQRUnpack - Copies R from a factorization of
+ *                                      "matrixDecompositionQRInPlace()", negating the rows whose
+ *                                      diagonal element is negative, so that the diagonal of R is
+ *                                      not negative as in the Gram-Schmidt QR.
+ * @param F                           - The factorization.
+ * @param R                           - Resultant R matrix, (min(m, n) x n).
+ */
+static void matrixDecompositionQRUnpack(const matrix & F, matrix & R) {
+  unsigned long XSizeCol = F.getColSize();
+  unsigned long minSize = XSizeCol < F.getRowSize() ? XSizeCol : F.getRowSize();
+  R.resizeClear(minSize, XSizeCol);
+  for (unsigned long i = 0; i < minSize; i++) {
+    const double * f = &F.mMat[i * F.getLd()];
+    double * r = &R.mMat[i * R.getLd()];
+    if (f[i] < 0.0)
+      std::transform(f + i, f + XSizeCol, r + i, std::negate<double>());
+    else
+      std::copy(f + i, f + XSizeCol, r + i);
+  }
+} // void matrixDecompositionQRUnpack(const matrix & F, matrix & R) --------------------------------
+
+/// ================================================================================================
+/// EXTERNAL FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief matrixDecompositionCholesky - Cholesky decomposition of a symmetric positive definite
+ *                                      matrix, X = L * L^T.
+ * @param X                           - Matrix for Cholesky decomposition.
+ * @param L                           - Resultant lower triangular L matrix.
+ * @return                            - Returns zero on success, otherwise the one based index of
+ *                                      the first leading minor that is not positive definite.
+ */
+unsigned long matrixDecompositionCholesky(const matrix & X, matrix & L) {
+  return matrixDecompositionCholesky(matrixView(X), L);
+} // unsigned long matrixDecompositionCholesky(const matrix & X, matrix & L) -----------------------
+
+/**
+ * @brief matrixDecompositionCholesky - Cholesky decomposition of a symmetric positive definite
+ *                                      view, X = L * L^T. The view is copied once and factorized
+ *                                      in place by "matrixDecompositionCholeskyInPlace()", and the
+ *                                      strict upper triangle of the copy is then cleared. Only the
+ *                                      lower triangle of X is read. It costs half the flops of the
+ *                                      LU decomposition and needs no pivoting.
+ * @param X                           - View for Cholesky decomposition.
+ * @param L                           - Resultant lower triangular L matrix.
+ * @return                            - Returns zero on success, otherwise the one based index of
+ *                                      the first leading minor that is not positive definite, in
+ *                                      which case L is not a valid factor.
+ */
+unsigned long matrixDecompositionCholesky(const matrixView & X, matrix & L) {
+  L = X;
+  unsigned long info = matrixDecompositionCholeskyInPlace(L);
+  unsigned long size = L.getRowSize();
+  for (unsigned long i = 0; i + 1 < size; i++)
+    std::fill(&L.mMat[i * L.getLd() + i + 1], &L.mMat[i * L.getLd() + size], 0.0);
+  return info;
+} // unsigned long matrixDecompositionCholesky(const matrixView & X, matrix & L) -------------------
+
+/**
+ * @brief matrixDecompositionCholeskyInPlace - Cholesky decomposition in place, X = L * L^T, by
+ *                                             the right-looking blocked factorization of
+ *                                             "matrixLapackPotrf()". Each diagonal block is
+ *                                             factorized and the rows below it are solved by a
+ *                                             TRSM, and the trailing matrix is updated by GEMMs,
+ *                                             in parallel for large matrices.
+ * @param X                                  - Matrix for Cholesky decomposition, whose lower
+ *                                             triangle is overwritten by L.
+ * @return                                   - Returns zero on success, otherwise the one based
+ *                                             index of the first leading minor that is not
+ *                                             positive definite, at which the decomposition
+ *                                             stopped.
+ */
+unsigned long matrixDecompositionCholeskyInPlace(matrix & X) {
+  matrixCheckIsSquare(X);
+  return matrixLapackPotrf(X.getRowSize(), X.mMat, X.getLd());
+} // unsigned long matrixDecompositionCholeskyInPlace(matrix & X) ----------------------------------
+
+/**
+ * @brief matrixDecompositionCholeskySolve - Solves X * Y = B from the Cholesky decomposition of
+ *                                           X, by a forward TRSM with L and a backward TRSM with
+ *                                           L^T read in place. Only the lower triangle of L is
+ *                                           read, so the factor of
+ *                                           "matrixDecompositionCholeskyInPlace()" can be passed
+ *                                           directly.
+ * @param L                                - Cholesky factor of X.
+ * @param B                                - Right-hand side matrix.
+ * @return                                 - Returns the solution Y.
+ */
+matrix matrixDecompositionCholeskySolve(const matrix & L, const matrix & B) {
+  matrixCheckIsSquare(L);
+  matrixCheckIsEqualInnerSize(L, B);
+  matrix Y = B;
+  matrixLapackPotrs(L.getRowSize(), Y.getColSize(), L.mMat, L.getLd(), Y.mMat, Y.getLd());
+  return Y;
+} // matrix matrixDecompositionCholeskySolve(const matrix & L, const matrix & B) -------------------
+
 /**
- * @brief matrixDecompositionLU - LU decomposition.
+ * @brief matrixDecompositionLU - LU decomposition with partial pivoting, P * X = L * U.
  * @param X                     - Matrix for LU decomposition.
  * @param L                     - Resultant L matrix.
  * @param U                     - Resultant U matrix.
  * @return                      - Returns the pivot matrix.
  */
 matrix matrixDecompositionLU(const matrix &X, matrix & L, matrix & U) {
+  return matrixDecompositionLU(matrixView(X), L, U);
+} // matrix matrixDecompositionLU(const matrix &X, matrix & L, matrix & U) -------------------------
 
+/**
+ * @brief matrixDecompositionLU - LU decomposition with partial pivoting of a view, P * X = L * U.
+ *                                The view is copied once and factorized in place by
+ *                                "matrixDecompositionLUInPlace()", and L, U and P are then
+ *                                unpacked from the factor and the pivot vector. For a (m x n)
+ *                                matrix, L is (m x k) and U is (k x n), with k = min(m, n).
+ * @param X                     - View for LU decomposition.
+ * @param L                     - Resultant L matrix.
+ * @param U                     - Resultant U matrix.
+ * @return                      - Returns the pivot matrix.
+ */
+matrix matrixDecompositionLU(const matrixView & X, matrix & L, matrix & U) {
   unsigned long XSizeCol = X.getColSize();
   unsigned long XSizeRow = X.getRowSize();
+  unsigned long minSize = XSizeCol < XSizeRow ? XSizeCol : XSizeRow;
 
-  matrix R = X;
-  matrix T1, T2, T3;
-  matrix P = matrixIdentity(XSizeRow, XSizeRow);
-  double temp = 0;
+  matrix F = X;
+  std::vector<unsigned long> pivot = matrixDecompositionLUInPlace(F);
 
-  if (XSizeRow == XSizeCol) {
-    L = matrixIdentity(XSizeRow, XSizeCol);
-    U.resizeClear(XSizeRow, XSizeCol);
-  }
-  else if (XSizeRow > XSizeCol) {
-    L = matrixIdentity(XSizeRow, XSizeCol);
-    U.resizeClear(XSizeCol, XSizeCol);
+  L = matrixIdentity(XSizeRow, minSize);
+  U.resizeClear(minSize, XSizeCol);
+  for (unsigned long i = 0; i < XSizeRow; i++) {
+    const double * f = &F.mMat[i * F.getLd()];
+    std::copy(f, f + (i < minSize ? i : minSize), &L.mMat[i * L.getLd()]);
+    if (i < minSize)
+      std::copy(f + i, f + XSizeCol, &U.mMat[i * U.getLd() + i]);
   }
-  else if(XSizeRow < XSizeCol) {
-    L = matrixIdentity(XSizeRow, XSizeRow);
-    U.resizeClear(XSizeRow, XSizeCol);
-  }
-
-  for (unsigned long i = 1; i <= XSizeRow; i++) {
-    if (i < XSizeRow) {
-      T1 = R(i, XSizeRow, 1, XSizeCol);
-      T3 = matrixMathsAbsMax(T1, T2);
-      R = matrixCellOperationsSwapRows(R, i, T3(1, i) + (i-1));
-      P = matrixCellOperationsSwapRows(P, i, T3(1, i) + (i-1));
-    }
 
-    // compute LU decomposition
-    for (unsigned long j = 1; j <= XSizeCol; j++) {
-      temp = 0;
-
-      // check for lower triangle matrix indices
-      if (j < i) {
-        for (unsigned long k = 1; k <= XSizeRow; k++)
-          temp += L(i, k) * U(k, j);
-        // determine L elements
-        L(i, j) = (R(i, j) - temp) / U(j, j);
-      }
-
-      temp = 0;
-      // check for upper triangle matrix indices
-      if (j >= i) {
-        for (unsigned long k = 1; k <= XSizeRow; k++)
-          temp += L(i, k) * U(k, j);
-        U(i, j) = (R(i, j) - temp);
-      }
-    }
+  // P applies the interchanges of the factorization to the rows of the identity
+  matrix P = matrixIdentity(XSizeRow, XSizeRow);
+  for (unsigned long i = 0; i < minSize; i++) {
+    if (pivot[i] != i)
+      std::swap_ranges(&P.mMat[i * P.getLd()], &P.mMat[i * P.getLd() + XSizeRow],
+                       &P.mMat[pivot[i] * P.getLd()]);
   }
-
   return P;
-}
+} // matrix matrixDecompositionLU(const matrixView & X, matrix & L, matrix & U) --------------------
+
+/**
+ * @brief matrixDecompositionLUInPlace - LU decomposition with partial pivoting in place,
+ *                                       P * X = L * U, by the right-looking blocked factorization
+ *                                       of "matrixLapackGetrf()". Each panel is factorized with
+ *                                       full row interchanges, and the trailing matrix is updated
+ *                                       by a TRSM and a GEMM, in parallel for large matrices.
+ * @param X                            - Matrix for LU decomposition, overwritten by L and U.
+ * @return                             - Returns the zero based pivot index vector of min(m, n)
+ *                                       elements. Row i was interchanged with row pivot[i] at
+ *                                       step i.
+ */
+std::vector<unsigned long> matrixDecompositionLUInPlace(matrix & X) {
+  unsigned long minSize = X.getColSize() < X.getRowSize() ? X.getColSize() : X.getRowSize();
+  std::vector<unsigned long> pivot(minSize, 0);
+  if (minSize > 0)
+    matrixLapackGetrf(X.getRowSize(), X.getColSize(), X.mMat, X.getLd(), pivot.data());
+  return pivot;
+} // std::vector<unsigned long> matrixDecompositionLUInPlace(matrix & X) ---------------------------
 
 /**
  * @brief matrixDecompositionQR - QR decomposition.
@@ -117,27 +263,174 @@ matrix matrixDecompositionLU(const matrix &X, matrix & L, matrix & U) {
  * @param R                     - Resultant R matrix.
  */
 void matrixDecompositionQR(const matrix & X, matrix & Q, matrix & R) {
-  unsigned long XSizeCol = X.getColSize();
-  unsigned long XSizeRow = X.getRowSize();
-  unsigned long minSize = XSizeCol < XSizeRow ? XSizeCol : XSizeRow;
+  matrixDecompositionQR(matrixView(X), Q, R);
+} // void matrixDecompositionQR(const matrix & X, matrix & Q, matrix & R) --------------------------
 
-  matrix M = X;
-  Q.resizeClear(XSizeRow, XSizeRow);
-  R.resizeClear(XSizeRow, XSizeCol);
+/**
+ * @brief matrixDecompositionQR - QR decomposition of a view, X = Q * R. The view is copied once
+ *                                and factorized by the blocked Householder QR of
+ *                                "matrixDecompositionQRInPlace()", and Q is then formed by
+ *                                applying its block reflectors to the columns of the identity.
+ *                                For a (m x n) matrix, Q is (m x k) with orthonormal columns and R
+ *                                is (k x n) upper triangular, with k = min(m, n). The signs are
+ *                                chosen so that the diagonal of R is not negative.
+ * @param X                     - View for QR decomposition.
+ * @param Q                     - Resultant Q matrix.
+ * @param R                     - Resultant R matrix.
+ */
+void matrixDecompositionQR(const matrixView & X, matrix & Q, matrix & R) {
+  unsigned long XSizeRow = X.getRowSize();
+  unsigned long minSize = X.getColSize() < XSizeRow ? X.getColSize() : XSizeRow;
 
-  for (unsigned long i = 1; i <= minSize; i++) {
-    R(i, i) = matrixMathsVectorSquareRoot(M(1, XSizeRow, i, i));
-    Q(1, i, M(1, XSizeRow, i, i) / R(i, i));
+  matrix F = X;
+  std::vector<double> tau = matrixDecompositionQRInPlace(F);
+  matrixDecompositionQRUnpack(F, R);
 
-    for (unsigned long j = i + 1; j <= XSizeCol; j++) {
-      R(i, j) = matrixMathsVectorSum(matrixCellOperationsMultiply(Q(1, XSizeRow, i, i), M(1, XSizeRow, j, j)));
-      M(1, j, M(1, XSizeRow, j, j) - Q(1, XSizeRow, i, i) * R(i, j));
+  Q = matrixIdentity(XSizeRow, minSize);
+  matrixLapackOrmqr(false, XSizeRow, minSize, minSize, F.mMat, F.getLd(), tau.data(), Q.mMat,
+                    Q.getLd());
+  for (unsigned long i = 0; i < minSize; i++) {
+    if (F.mMat[i * F.getLd() + i] < 0.0) {
+      for (unsigned long r = 0; r < XSizeRow; r++)
+        Q.mMat[r * Q.getLd() + i] = -Q.mMat[r * Q.getLd() + i];
     }
   }
+} // void matrixDecompositionQR(const matrixView & X, matrix & Q, matrix & R) ----------------------
+
+/**
+ * @brief matrixDecompositionQR - QR decomposition without forming Q.
+ * @param X                     - Matrix for QR decomposition.
+ * @param R                     - Resultant R matrix.
+ */
+void matrixDecompositionQR(const matrix & X, matrix & R) {
+  matrixDecompositionQR(matrixView(X), R);
+} // void matrixDecompositionQR(const matrix & X, matrix & R) --------------------------------------
+
+/**
+ * @brief matrixDecompositionQR - QR decomposition of a view without forming Q, which saves the
+ *                                cost of generating Q, about as much as the factorization itself.
+ *                                R is the same as the one of the overload returning Q.
+ * @param X                     - View for QR decomposition.
+ * @param R                     - Resultant R matrix.
+ */
+void matrixDecompositionQR(const matrixView & X, matrix & R) {
+  matrix F = X;
+  matrixDecompositionQRInPlace(F);
+  matrixDecompositionQRUnpack(F, R);
+} // void matrixDecompositionQR(const matrixView & X, matrix & R) ----------------------------------
+
+/**
+ * @brief matrixDecompositionQRInPlace - Householder QR decomposition in place, X = Q * R, by the
+ *                                       blocked factorization of "matrixLapackGeqrf()". The
+ *                                       reflectors of each panel are applied to the trailing
+ *                                       columns as one compact WY block reflector by GEMMs, in
+ *                                       parallel for large matrices.
+ * @param X                            - Matrix for QR decomposition, overwritten by R and the
+ *                                       Householder vectors.
+ * @return                             - Returns the scalar factors of the min(m, n) reflectors.
+ */
+std::vector<double> matrixDecompositionQRInPlace(matrix & X) {
+  unsigned long minSize = X.getColSize() < X.getRowSize() ? X.getColSize() : X.getRowSize();
+  std::vector<double> tau(minSize, 0.0);
+  if (minSize > 0)
+    matrixLapackGeqrf(X.getRowSize(), X.getColSize(), X.mMat, X.getLd(), tau.data());
+  return tau;
+} // std::vector<double> matrixDecompositionQRInPlace(matrix & X) ----------------------------------
+
+/**
+ * @brief matrixDecompositionQRMultiply - Multiplies a matrix in place by the Q of
+ *                                        "matrixDecompositionQRInPlace()", B = Q^T * B or
+ *                                        B = Q * B, by its block reflectors, without forming Q.
+ *                                        This is all a least squares solve needs besides R.
+ * @param F                             - Factorization of "matrixDecompositionQRInPlace()".
+ * @param tau                           - Scalar factors of the reflectors.
+ * @param B                             - Matrix to multiply, with as many rows as F.
+ * @param trans                         - Multiplies by Q^T when true, by Q otherwise.
+ */
+void matrixDecompositionQRMultiply(const matrix & F, const std::vector<double> & tau, matrix & B,
+                                   bool trans) {
+  if (F.getRowSize() != B.getRowSize())
+    matrixExit("Matrices row size mismatch.");
+  matrixLapackOrmqr(trans, F.getRowSize(), B.getColSize(), tau.size(), F.mMat, F.getLd(),
+                    tau.data(), B.mMat, B.getLd());
+} // void matrixDecompositionQRMultiply(const matrix & F, const std::vector<double> & tau, matrix & B, bool trans)
+
+/**
+ * @brief matrixDecompositionQRTallSkinny - Tall and skinny QR decomposition without forming Q.
+ * @param X                               - Matrix for QR decomposition, with at least as many
+ *                                          rows as columns.
+ * @param R                               - Resultant R matrix.
+ */
+void matrixDecompositionQRTallSkinny(const matrix & X, matrix & R) {
+  matrixDecompositionQRTallSkinny(matrixView(X), R);
+} // void matrixDecompositionQRTallSkinny(const matrix & X, matrix & R) ----------------------------
+
+/**
+ * @brief matrixDecompositionQRTallSkinny - Tall and skinny QR decomposition of a view without
+ *                                          forming Q, by the TSQR of "matrixLapackTsqr()": row
+ *                                          blocks are factorized on separate threads and their R
+ *                                          merged in a reduction tree. X is read in place and the
+ *                                          memory used does not grow with its row size. R is the
+ *                                          same as the one of "matrixDecompositionQR()", up to
+ *                                          rounding.
+ * @param X                               - View for QR decomposition, with at least as many rows
+ *                                          as columns.
+ * @param R                               - Resultant R matrix.
+ */
+void matrixDecompositionQRTallSkinny(const matrixView & X, matrix & R) {
+  matrix C;
+  matrixDecompositionQRTallSkinny(X, matrixView(C), R);
+} // void matrixDecompositionQRTallSkinny(const matrixView & X, matrix & R) ------------------------
 
-  if (XSizeRow > XSizeCol) {
-    Q.resizeRetain(XSizeRow, XSizeCol);
-    R.resizeRetain(XSizeCol, XSizeCol);
+/**
+ * @brief matrixDecompositionQRTallSkinny - Tall and skinny QR decomposition without forming Q,
+ *                                          which also applies Q^T to a right-hand side.
+ * @param X                               - Matrix for QR decomposition, with at least as many
+ *                                          rows as columns.
+ * @param B                               - Right-hand side matrix, with as many rows as X.
+ * @param R                               - Resultant R matrix.
+ * @return                                - Returns the first n rows of Q^T * B.
+ */
+matrix matrixDecompositionQRTallSkinny(const matrix & X, const matrix & B, matrix & R) {
+  return matrixDecompositionQRTallSkinny(matrixView(X), matrixView(B), R);
+} // matrix matrixDecompositionQRTallSkinny(const matrix & X, const matrix & B, matrix & R) --------
+
+/**
+ * @brief matrixDecompositionQRTallSkinny - Tall and skinny QR decomposition of a view without
+ *                                          forming Q, which also applies Q^T to a right-hand side
+ *                                          as the reflectors are generated. For a (m x n) X, only
+ *                                          the first n rows of Q^T * B are returned, so that the
+ *                                          least squares solution of X * Y = B is the solution of
+ *                                          R * Y = Q^T * B, and the memory used is O(n * (n + k))
+ *                                          per thread for a B of k columns. The signs are chosen
+ *                                          so that the diagonal of R is not negative.
+ * @param X                               - View for QR decomposition, with at least as many rows
+ *                                          as columns.
+ * @param B                               - Right-hand side view, with as many rows as X.
+ * @param R                               - Resultant R matrix.
+ * @return                                - Returns the first n rows of Q^T * B.
+ */
+matrix matrixDecompositionQRTallSkinny(const matrixView & X, const matrixView & B, matrix & R) {
+  unsigned long XSizeCol = X.getColSize();
+  unsigned long XSizeRow = X.getRowSize();
+  if (XSizeRow < XSizeCol)
+    matrixExit("QR factorization requires at least as many rows as columns.");
+  unsigned long BSizeCol = B.getColSize();
+  if ((BSizeCol > 0) && (B.getRowSize() != XSizeRow))
+    matrixExit("Matrices row size mismatch.");
+
+  matrix C(XSizeCol, BSizeCol);
+  R.resizeClear(XSizeCol, XSizeCol);
+  matrixLapackTsqr(XSizeRow, XSizeCol, BSizeCol, X.mMat, X.getLd(), B.mMat, B.getLd(), R.mMat,
+                   R.getLd(), C.mMat, C.getLd());
+  for (unsigned long i = 0; i < XSizeCol; i++) {
+    if (R.mMat[i * R.getLd() + i] < 0.0) {
+      double * r = &R.mMat[i * R.getLd()];
+      double * c = &C.mMat[i * C.getLd()];
+      std::transform(r + i, r + XSizeCol, r + i, std::negate<double>());
+      std::transform(c, c + BSizeCol, c, std::negate<double>());
+    }
   }
-}
+  return C;
+} // matrix matrixDecompositionQRTallSkinny(const matrixView & X, const matrixView & B, matrix & R)
 
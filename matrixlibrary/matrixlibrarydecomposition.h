@@ -17,9 +17,49 @@
  *
  * Author:      Johnathon Leong
  *
- * Note:        To be used together with: matrixlibrary,
- *                                        matrixlibrarycelloperations, and
- *                                        matrixlibrarymaths
+ * Note:        To be used together with: matrixlibrary, and
+ *                                        matrixlibrarylapack
+ *
+ * Version:     1.0.8
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the tall and skinny QR decomposition "matrixDecompositionQRTallSkinny()",
+ *                 which returns R, and the first rows of Q^T * B for a right-hand side B, without
+ *                 forming Q, in memory independent of the row size.
+ *
+ * Version:     1.0.7
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the Cholesky decomposition of symmetric positive definite matrices
+ *                 "matrixDecompositionCholesky()", its in place version
+ *                 "matrixDecompositionCholeskyInPlace()" and the solver
+ *                 "matrixDecompositionCholeskySolve()", on the blocked and parallel
+ *                 "matrixLapackPotrf()".
+ *
+ * Version:     1.0.6
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. "matrixDecompositionQR()" now uses the blocked Householder QR of
+ *                 "matrixLapackGeqrf()", whose trailing updates are GEMM calls on compact WY block
+ *                 reflectors, instead of the Gram-Schmidt process. Q is formed from the reflectors
+ *                 only when it is asked for.
+ *              2. Added an overload of "matrixDecompositionQR()" returning only R,
+ *                 "matrixDecompositionQRInPlace()" returning the packed factorization, and
+ *                 "matrixDecompositionQRMultiply()" to apply Q or Q^T without forming Q.
+ *
+ * Version:     1.0.5
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. "matrixDecompositionLU()" now factorizes in place in a single buffer with the
+ *                 blocked LU factorization with partial pivoting of "matrixLapackGetrf()", whose
+ *                 trailing updates are GEMM calls. The pivot is now chosen from the updated column,
+ *                 as partial pivoting requires.
+ *              2. Added "matrixDecompositionLUInPlace()", which returns the pivot index vector
+ *                 instead of the dense permutation matrix.
+ *
+ * Version:     1.0.4
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added view overloads of "matrixDecompositionLU()" and "matrixDecompositionQR()".
+ *                 The matrix overloads forward to them.
+ *              2. The pivoting of "matrixDecompositionLU()" and the column updates of
+ *                 "matrixDecompositionQR()" now work in place on views instead of copied rows and
+ *                 columns.
  *
  * Version:     1.0.3
  * Date:        2021/08/05 (YYYY/MM/DD)
@@ -46,9 +86,53 @@
 #define MATRIXLIBRARYDECOMPOSITION_H
 
 #include "matrixlibrary.h"
+#include <vector>
+
+/**
+ * @brief matrixDecompositionCholesky - Cholesky decomposition of a symmetric positive definite
+ *                                      matrix, X = L * L^T.
+ * @param X                           - Matrix for Cholesky decomposition.
+ * @param L                           - Resultant lower triangular L matrix.
+ * @return                            - Returns zero on success, otherwise the one based index of
+ *                                      the first leading minor that is not positive definite.
+ */
+unsigned long matrixDecompositionCholesky(const matrix & X, matrix & L);
 
 /**
- * @brief matrixDecompositionLU - LU decomposition.
+ * @brief matrixDecompositionCholesky - Cholesky decomposition of a symmetric positive definite
+ *                                      view, X = L * L^T. Only the lower triangle of X is read.
+ * @param X                           - View for Cholesky decomposition.
+ * @param L                           - Resultant lower triangular L matrix.
+ * @return                            - Returns zero on success, otherwise the one based index of
+ *                                      the first leading minor that is not positive definite, in
+ *                                      which case L is not a valid factor.
+ */
+unsigned long matrixDecompositionCholesky(const matrixView & X, matrix & L);
+
+/**
+ * @brief matrixDecompositionCholeskyInPlace - Cholesky decomposition in place, X = L * L^T. The
+ *                                             lower triangle of X is overwritten by L, and its
+ *                                             strict upper triangle is left untouched.
+ * @param X                                  - Matrix for Cholesky decomposition, whose lower
+ *                                             triangle is overwritten by L.
+ * @return                                   - Returns zero on success, otherwise the one based
+ *                                             index of the first leading minor that is not
+ *                                             positive definite, at which the decomposition
+ *                                             stopped.
+ */
+unsigned long matrixDecompositionCholeskyInPlace(matrix & X);
+
+/**
+ * @brief matrixDecompositionCholeskySolve - Solves X * Y = B from the Cholesky decomposition of
+ *                                           X. Only the lower triangle of L is read.
+ * @param L                                - Cholesky factor of X.
+ * @param B                                - Right-hand side matrix.
+ * @return                                 - Returns the solution Y.
+ */
+matrix matrixDecompositionCholeskySolve(const matrix & L, const matrix & B);
+
+/**
+ * @brief matrixDecompositionLU - LU decomposition with partial pivoting, P * X = L * U.
  * @param X                     - Matrix for LU decomposition.
  * @param L                     - Resultant L matrix.
  * @param U                     - Resultant U matrix.
@@ -56,6 +140,26 @@
  */
 matrix matrixDecompositionLU(const matrix &X, matrix & L, matrix & U);
 
+/**
+ * @brief matrixDecompositionLU - LU decomposition with partial pivoting of a view, P * X = L * U.
+ * @param X                     - View for LU decomposition.
+ * @param L                     - Resultant L matrix.
+ * @param U                     - Resultant U matrix.
+ * @return                      - Returns the pivot matrix.
+ */
+matrix matrixDecompositionLU(const matrixView & X, matrix & L, matrix & U);
+
+/**
+ * @brief matrixDecompositionLUInPlace - LU decomposition with partial pivoting in place,
+ *                                       P * X = L * U. X is overwritten by U on and above the
+ *                                       diagonal and by L without its unit diagonal below it.
+ * @param X                            - Matrix for LU decomposition, overwritten by L and U.
+ * @return                             - Returns the zero based pivot index vector of min(m, n)
+ *                                       elements. Row i was interchanged with row pivot[i] at
+ *                                       step i.
+ */
+std::vector<unsigned long> matrixDecompositionLUInPlace(matrix & X);
+
 /**
  * @brief matrixDecompositionQR - QR decomposition.
  * @param X                     - Matrix for QR decomposition.
@@ -64,4 +168,93 @@ matrix matrixDecompositionLU(const matrix &X, matrix & L, matrix & U);
  */
 void matrixDecompositionQR(const matrix &X, matrix & Q, matrix & R);
 
+/**
+ * @brief matrixDecompositionQR - QR decomposition of a view.
+ * @param X                     - View for QR decomposition.
+ * @param Q                     - Resultant Q matrix.
+ * @param R                     - Resultant R matrix.
+ */
+void matrixDecompositionQR(const matrixView & X, matrix & Q, matrix & R);
+
+/**
+ * @brief matrixDecompositionQR - QR decomposition without forming Q.
+ * @param X                     - Matrix for QR decomposition.
+ * @param R                     - Resultant R matrix.
+ */
+void matrixDecompositionQR(const matrix & X, matrix & R);
+
+/**
+ * @brief matrixDecompositionQR - QR decomposition of a view without forming Q.
+ * @param X                     - View for QR decomposition.
+ * @param R                     - Resultant R matrix.
+ */
+void matrixDecompositionQR(const matrixView & X, matrix & R);
+
+/**
+ * @brief matrixDecompositionQRInPlace - Householder QR decomposition in place, X = Q * R. X is
+ *                                       overwritten by R on and above the diagonal and by the
+ *                                       Householder vectors of Q below it. Unlike
+ *                                       "matrixDecompositionQR()", the diagonal of R may be
+ *                                       negative.
+ * @param X                            - Matrix for QR decomposition, overwritten by R and the
+ *                                       Householder vectors.
+ * @return                             - Returns the scalar factors of the min(m, n) reflectors.
+ */
+std::vector<double> matrixDecompositionQRInPlace(matrix & X);
+
+/**
+ * @brief matrixDecompositionQRMultiply - Multiplies a matrix in place by the Q of
+ *                                        "matrixDecompositionQRInPlace()", B = Q^T * B or
+ *                                        B = Q * B, without forming Q.
+ * @param F                             - Factorization of "matrixDecompositionQRInPlace()".
+ * @param tau                           - Scalar factors of the reflectors.
+ * @param B                             - Matrix to multiply, with as many rows as F.
+ * @param trans                         - Multiplies by Q^T when true, by Q otherwise.
+ */
+void matrixDecompositionQRMultiply(const matrix & F, const std::vector<double> & tau, matrix & B,
+                                   bool trans);
+
+/**
+ * @brief matrixDecompositionQRTallSkinny - Tall and skinny QR decomposition without forming Q.
+ * @param X                               - Matrix for QR decomposition, with at least as many
+ *                                          rows as columns.
+ * @param R                               - Resultant R matrix.
+ */
+void matrixDecompositionQRTallSkinny(const matrix & X, matrix & R);
+
+/**
+ * @brief matrixDecompositionQRTallSkinny - Tall and skinny QR decomposition of a view without
+ *                                          forming Q. Row blocks are factorized on separate threads
+ *                                          and their R merged in a reduction tree, reading X in
+ *                                          place.
+ * @param X                               - View for QR decomposition, with at least as many rows
+ *                                          as columns.
+ * @param R                               - Resultant R matrix.
+ */
+void matrixDecompositionQRTallSkinny(const matrixView & X, matrix & R);
+
+/**
+ * @brief matrixDecompositionQRTallSkinny - Tall and skinny QR decomposition without forming Q,
+ *                                          which also applies Q^T to a right-hand side.
+ * @param X                               - Matrix for QR decomposition, with at least as many
+ *                                          rows as columns.
+ * @param B                               - Right-hand side matrix, with as many rows as X.
+ * @param R                               - Resultant R matrix.
+ * @return                                - Returns the first n rows of Q^T * B.
+ */
+matrix matrixDecompositionQRTallSkinny(const matrix & X, const matrix & B, matrix & R);
+
+/**
+ * @brief matrixDecompositionQRTallSkinny - Tall and skinny QR decomposition of a view without
+ *                                          forming Q, which also applies Q^T to a right-hand side.
+ *                                          The least squares solution of X * Y = B is the solution
+ *                                          of R * Y = C, where C is the returned matrix.
+ * @param X                               - View for QR decomposition, with at least as many rows
+ *                                          as columns.
+ * @param B                               - Right-hand side view, with as many rows as X.
+ * @param R                               - Resultant R matrix.
+ * @return                                - Returns the first n rows of Q^T * B.
+ */
+matrix matrixDecompositionQRTallSkinny(const matrixView & X, const matrixView & B, matrix & R);
+
 #endif // MATRIXLIBRARYDECOMPOSITION_H
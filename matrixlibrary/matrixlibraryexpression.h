@@ -0,0 +1,293 @@
+/*
+ * Copyright:   2021 Johnathon Leong
+ *
+ * License:     License under LGPL-3.0-or-later.
+ *              Please refer to https://www.gnu.org/licenses/lgpl-3.0.txt for more information on the
+ *              terms of LGPL-3.0 or relavent website for a later version of the LGPL.
+ *
+ * Disclaimer:  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY
+ *              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ *              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ *              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ *              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *              WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author:      Johnathon Leong
+ *
+ * Note:        Expression templates of matrixlibrary. The element wise operators build a lightweight
+ *              expression tree instead of computing the result right away. The tree is evaluated
+ *              only when it is assigned into a matrix, in a single fused loop without any temporary
+ *              matrix. Matrices in the tree are held by reference, so an expression must be used
+ *              within the statement that creates it and must not be stored.
+ *              To be used together with matrixlibrary.
+ *
+ * Version:     1.0.1
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. "matrixExpressionEvaluate()" now evaluates into a strided row-major buffer so
+ *                 that it can be shared by matrices and views.
+ *
+ * Version:     1.0.0
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Implemented first release version of matrixlibraryexpression.
+ */
+
+#ifndef MATRIXLIBRARYEXPRESSION_H
+#define MATRIXLIBRARYEXPRESSION_H
+
+/**
+ * @brief matrixExit - Abort program.
+ * @param msg        - Error message.
+ */
+void matrixExit(const char * msg);
+
+/**
+ * @brief matrixExpression - Base class of every matrix expression. The actual expression type E is
+ *                           recovered at compile time, so that the evaluation is fully inlined.
+ *                           Every expression type provides getRowSize(), getColSize(), getSize()
+ *                           and evaluate(row, col), with zero based row and column indices.
+ */
+template <typename E>
+class matrixExpression
+{
+public:
+  /**
+   * @brief derived - Returns the actual expression.
+   * @return        - The actual expression.
+   */
+  const E & derived(void) const { return static_cast<const E &>(* this); }
+};
+
+/**
+ * @brief matrixExpressionStore - Defines how an operand is held in the expression tree. Expression
+ *                                nodes are small and are held by value. Types that own memory, such
+ *                                as matrix, specialise this to be held by reference.
+ */
+template <typename E>
+struct matrixExpressionStore {
+  typedef const E type;
+};
+
+/**
+ * @brief matrixExpressionAssign - Operation that assigns the right operand.
+ */
+struct matrixExpressionAssign {
+  static double apply(double X, double Y) { (void)X; return Y; }
+};
+
+/**
+ * @brief matrixExpressionAdd - Operation that adds the operands.
+ */
+struct matrixExpressionAdd {
+  static double apply(double X, double Y) { return X + Y; }
+};
+
+/**
+ * @brief matrixExpressionSubtract - Operation that subtracts the right operand from the left.
+ */
+struct matrixExpressionSubtract {
+  static double apply(double X, double Y) { return X - Y; }
+};
+
+/**
+ * @brief matrixExpressionMultiply - Operation that multiplies the operands.
+ */
+struct matrixExpressionMultiply {
+  static double apply(double X, double Y) { return X * Y; }
+};
+
+/**
+ * @brief matrixExpressionDivide - Operation that divides the left operand by the right.
+ */
+struct matrixExpressionDivide {
+  static double apply(double X, double Y) { return X / Y; }
+};
+
+/**
+ * @brief matrixExpressionBinary - Element wise operation O between two expressions of equal size.
+ */
+template <typename L, typename R, typename O>
+class matrixExpressionBinary : public matrixExpression<matrixExpressionBinary<L, R, O> >
+{
+public:
+  /**
+   * @brief matrixExpressionBinary - Constructor. Aborts when the operand sizes do not match.
+   * @param X                      - Left operand.
+   * @param Y                      - Right operand.
+   */
+  matrixExpressionBinary(const L & X, const R & Y) : mX(X), mY(Y) {
+    if ((X.getRowSize() != Y.getRowSize()) || (X.getColSize() != Y.getColSize()))
+      matrixExit("Matrices size mismatch.");
+  }
+
+  unsigned long getRowSize(void) const { return mX.getRowSize(); }
+  unsigned long getColSize(void) const { return mX.getColSize(); }
+  unsigned long getSize(void) const { return mX.getSize(); }
+
+  /**
+   * @brief evaluate - Computes one element of the expression.
+   * @param row      - Zero based row index.
+   * @param col      - Zero based column index.
+   * @return         - Value of the element.
+   */
+  double evaluate(unsigned long row, unsigned long col) const {
+    return O::apply(mX.evaluate(row, col), mY.evaluate(row, col));
+  }
+
+private:
+  /**
+   * @brief mX - Left operand.
+   */
+  typename matrixExpressionStore<L>::type mX;
+
+  /**
+   * @brief mY - Right operand.
+   */
+  typename matrixExpressionStore<R>::type mY;
+};
+
+/**
+ * @brief matrixExpressionScalar - Element wise operation O between an expression and a value.
+ */
+template <typename L, typename O>
+class matrixExpressionScalar : public matrixExpression<matrixExpressionScalar<L, O> >
+{
+public:
+  /**
+   * @brief matrixExpressionScalar - Constructor.
+   * @param X                      - Left operand.
+   * @param Y                      - Right operand value.
+   */
+  matrixExpressionScalar(const L & X, double Y) : mX(X), mY(Y) {}
+
+  unsigned long getRowSize(void) const { return mX.getRowSize(); }
+  unsigned long getColSize(void) const { return mX.getColSize(); }
+  unsigned long getSize(void) const { return mX.getSize(); }
+
+  /**
+   * @brief evaluate - Computes one element of the expression.
+   * @param row      - Zero based row index.
+   * @param col      - Zero based column index.
+   * @return         - Value of the element.
+   */
+  double evaluate(unsigned long row, unsigned long col) const {
+    return O::apply(mX.evaluate(row, col), mY);
+  }
+
+private:
+  /**
+   * @brief mX - Left operand.
+   */
+  typename matrixExpressionStore<L>::type mX;
+
+  /**
+   * @brief mY - Right operand value.
+   */
+  double mY;
+};
+
+/**
+ * @brief operator + - Overloading of the addition operatior between two matrix expressions.
+ * @param X          - Main expression for addition.
+ * @param Y          - Addition expression.
+ * @return           - The addition expression.
+ */
+template <typename L, typename R>
+matrixExpressionBinary<L, R, matrixExpressionAdd> operator+(const matrixExpression<L> & X,
+                                                            const matrixExpression<R> & Y) {
+  return matrixExpressionBinary<L, R, matrixExpressionAdd>(X.derived(), Y.derived());
+} // operator+(const matrixExpression<L> & X, const matrixExpression<R> & Y) -----------------------
+
+/**
+ * @brief operator - - Overloading of the subtraction operatior between two matrix expressions.
+ * @param X          - Main expression for subtraction.
+ * @param Y          - Subtraction expression.
+ * @return           - The subtraction expression.
+ */
+template <typename L, typename R>
+matrixExpressionBinary<L, R, matrixExpressionSubtract> operator-(const matrixExpression<L> & X,
+                                                                 const matrixExpression<R> & Y) {
+  return matrixExpressionBinary<L, R, matrixExpressionSubtract>(X.derived(), Y.derived());
+} // operator-(const matrixExpression<L> & X, const matrixExpression<R> & Y) -----------------------
+
+/**
+ * @brief operator + - Overloading of the addition operatior between a matrix expression and a
+ *                     double type value.
+ * @param X          - Main expression for addition.
+ * @param Y          - Addition value.
+ * @return           - The addition expression.
+ */
+template <typename L>
+matrixExpressionScalar<L, matrixExpressionAdd> operator+(const matrixExpression<L> & X,
+                                                         const double & Y) {
+  return matrixExpressionScalar<L, matrixExpressionAdd>(X.derived(), Y);
+} // operator+(const matrixExpression<L> & X, const double & Y) ------------------------------------
+
+/**
+ * @brief operator - - Overloading of the subtraction operatior between a matrix expression and a
+ *                     double type value.
+ * @param X          - Main expression for subtraction.
+ * @param Y          - Subtraction value.
+ * @return           - The subtraction expression.
+ */
+template <typename L>
+matrixExpressionScalar<L, matrixExpressionSubtract> operator-(const matrixExpression<L> & X,
+                                                              const double & Y) {
+  return matrixExpressionScalar<L, matrixExpressionSubtract>(X.derived(), Y);
+} // operator-(const matrixExpression<L> & X, const double & Y) ------------------------------------
+
+/**
+ * @brief operator * - Overloading of the multiplication operatior between a matrix expression and a
+ *                     double type value.
+ * @param X          - Main expression for multiplication.
+ * @param Y          - Multiplication value.
+ * @return           - The multiplication expression.
+ */
+template <typename L>
+matrixExpressionScalar<L, matrixExpressionMultiply> operator*(const matrixExpression<L> & X,
+                                                              const double & Y) {
+  return matrixExpressionScalar<L, matrixExpressionMultiply>(X.derived(), Y);
+} // operator*(const matrixExpression<L> & X, const double & Y) ------------------------------------
+
+/**
+ * @brief operator / - Overloading of the division operatior between a matrix expression and a
+ *                     double type value.
+ * @param X          - Main expression for division.
+ * @param Y          - Division value.
+ * @return           - The division expression.
+ */
+template <typename L>
+matrixExpressionScalar<L, matrixExpressionDivide> operator/(const matrixExpression<L> & X,
+                                                            const double & Y) {
+  return matrixExpressionScalar<L, matrixExpressionDivide>(X.derived(), Y);
+} // operator/(const matrixExpression<L> & X, const double & Y) ------------------------------------
+
+/**
+ * @brief matrixExpressionEvaluate - Evaluates a matrix expression into a row-major buffer of the
+ *                                   same size, Z = O(Z, X), in a single fused loop. The expression
+ *                                   may refer to Z itself as every element only depends on the
+ *                                   elements at the same position. Aborts when the sizes do not
+ *                                   match.
+ * @param Z                        - Pointer to the first element of the resultant buffer.
+ * @param row                      - Row size of the resultant buffer.
+ * @param col                      - Column size of the resultant buffer.
+ * @param ld                       - Leading dimension (row stride) of the resultant buffer.
+ * @param X                        - Matrix expression to be evaluated.
+ */
+template <typename O, typename E>
+void matrixExpressionEvaluate(double * Z, unsigned long row, unsigned long col, unsigned long ld,
+                              const matrixExpression<E> & X) {
+  const E & Y = X.derived();
+  if ((Y.getRowSize() != row) || (Y.getColSize() != col))
+    matrixExit("Matrices size mismatch.");
+
+  for (unsigned long i = 0; i < row; i++) {
+    double * z = &Z[i * ld];
+    for (unsigned long j = 0; j < col; j++)
+      z[j] = O::apply(z[j], Y.evaluate(i, j));
+  }
+} // matrixExpressionEvaluate(double * Z, unsigned long row, unsigned long col, unsigned long ld, const matrixExpression<E> & X)
+
+#endif // MATRIXLIBRARYEXPRESSION_H
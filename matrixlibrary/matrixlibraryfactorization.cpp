@@ -0,0 +1,385 @@
+/*
+ * Copyright:   2021 Johnathon Leong
+ *
+ * License:     License under LGPL-3.0-or-later.
+ *              Please refer to https://www.gnu.org/licenses/lgpl-3.0.txt for more information on the
+ *              terms of LGPL-3.0 or relavent website for a later version of the LGPL.
+ *
+ * Disclaimer:  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY
+ *              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ *              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ *              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ *              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *              WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author:      Johnathon Leong
+ *
+ * Note:        Factorization objects of matrixlibrary. Each object factorizes a matrix once and
+ *              owns its compact factor, packed in a single matrix as LAPACK stores it, together
+ *              with the pivot vector or the Householder scalars of the factorization. Every later
+ *              solve, determinant or inverse is computed from the stored factor, so that a solve
+ *              costs O(n^2) per right-hand side instead of the O(n^3) of a new factorization. A
+ *              factorization that fails, such as the LU of a singular matrix, is reported by
+ *              "getStatus()", and its solutions are NaN. To be used together with matrixlibrary
+ *              and matrixlibrarylapack.
+ *
+ * Version:     1.0.0
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Implemented first release version of matrixlibraryfactorization.
+ */
+
+#include "matrixlibraryfactorization.h"
+#include "matrixlibrarykernels.h"
+#include "matrixlibrarylapack.h"
+#include <algorithm>
+#include <limits>
+
+/// ================================================================================================
+/// STATIC FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief matrixFactorizationFailed - Sets every element of the solution of a failed factorization
+ *                                    to NaN.
+ * @param Z                         - The solution.
+ */
+static void matrixFactorizationFailed(matrix & Z) {
+  for (unsigned long i = 0; i < Z.getRowSize(); i++)
+    std::fill(&Z.mMat[i * Z.getLd()], &Z.mMat[i * Z.getLd() + Z.getColSize()],
+              std::numeric_limits<double>::quiet_NaN());
+} // void matrixFactorizationFailed(matrix & Z)
+
+/**
+ * @brief matrixFactorizationStatus - Returns the status of the factorization of an empty matrix.
+ * @return                          - Status that is not singular, with an rcond of one.
+ */
+static matrixStatus matrixFactorizationStatus(void) {
+  matrixStatus status = {false, 0, 1.0};
+  return status;
+} // matrixStatus matrixFactorizationStatus(void)
+
+/// ================================================================================================
+/// PUBLIC FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief luFactorization - Default constructor, of the factorization of an empty matrix.
+ */
+luFactorization::luFactorization() : mStatus(matrixFactorizationStatus()) {
+} // luFactorization::luFactorization()
+
+/**
+ * @brief luFactorization - Overloaded constructor to factorize a square matrix.
+ * @param X               - Matrix to be factorized.
+ */
+luFactorization::luFactorization(const matrix & X) {
+  this->factorize(X);
+} // luFactorization::luFactorization(const matrix & X)
+
+/**
+ * @brief determinant - Returns the determinant of the factorized matrix, the product of the
+ *                      diagonal of U with the sign of the row interchanges.
+ * @return            - Determinant of the factorized matrix, zero if it is singular.
+ */
+double luFactorization::determinant(void) const {
+  double det = 1.0;
+  for (unsigned long i = 0; i < mFactor.getRowSize(); i++) {
+    det *= mFactor.mMat[i * mFactor.getLd() + i];
+    if (mPivot[i] != i)
+      det = -det;
+  }
+  return det;
+} // double luFactorization::determinant(void) const
+
+/**
+ * @brief factorize - Factorizes a square matrix, P * X = L * U, with the blocked LU factorization
+ *                    with partial pivoting of "matrixLapackGetrf()", replacing any previous
+ *                    factorization. The conditioning of X is estimated once here, at O(n^2).
+ * @param X         - Matrix to be factorized.
+ */
+void luFactorization::factorize(const matrix & X) {
+  matrixCheckIsSquare(X);
+  unsigned long size = X.getRowSize();
+  mFactor = X;
+  mPivot.assign(size, 0);
+  mStatus = matrixFactorizationStatus();
+  if (size == 0)
+    return;
+
+  mStatus.pivot = matrixLapackGetrf(size, size, mFactor.mMat, mFactor.getLd(), mPivot.data());
+  mStatus.singular = mStatus.pivot != 0;
+  mStatus.rcond = 0.0;
+  if (!mStatus.singular)
+    mStatus.rcond = matrixLapackGecon(size, mFactor.mMat, mFactor.getLd(), mPivot.data(),
+                                      matrixLapackNorm1(size, size, X.mMat, X.getLd()));
+} // void luFactorization::factorize(const matrix & X)
+
+/**
+ * @brief getFactor - Returns the packed factor, U on and above the diagonal and L without its unit
+ *                    diagonal below it.
+ * @return          - The packed factor.
+ */
+const matrix & luFactorization::getFactor(void) const {
+  return mFactor;
+} // const matrix & luFactorization::getFactor(void) const
+
+/**
+ * @brief getPivot - Returns the zero based pivot vector. Row i was interchanged with row
+ *                   getPivot()[i] at step i of the factorization.
+ * @return         - The pivot vector.
+ */
+const std::vector<unsigned long> & luFactorization::getPivot(void) const {
+  return mPivot;
+} // const std::vector<unsigned long> & luFactorization::getPivot(void) const
+
+/**
+ * @brief getStatus - Returns the singularity and estimated conditioning of the factorized matrix.
+ * @return          - Status of the factorization.
+ */
+matrixStatus luFactorization::getStatus(void) const {
+  return mStatus;
+} // matrixStatus luFactorization::getStatus(void) const
+
+/**
+ * @brief inverse - Returns the inverse of the factorized matrix, solved with the identity as the
+ *                  right-hand sides.
+ * @return        - The inverse, NaN if the matrix is singular.
+ */
+matrix luFactorization::inverse(void) const {
+  return this->solve(matrixIdentity(mFactor.getRowSize()));
+} // matrix luFactorization::inverse(void) const
+
+/**
+ * @brief solve - Solves X * Z = B for Z with the factorized X, by forward and back substitutions
+ *                on all the columns of B together.
+ * @param B     - Right-hand sides, one per column.
+ * @return      - The solution, of the size of B, NaN if the matrix is singular.
+ */
+matrix luFactorization::solve(const matrix & B) const {
+  matrixCheckIsEqualInnerSize(mFactor, B);
+  matrix Z = B;
+  if (mStatus.singular)
+    matrixFactorizationFailed(Z);
+  else
+    matrixLapackGetrs(false, mFactor.getRowSize(), Z.getColSize(), mFactor.mMat, mFactor.getLd(),
+                      mPivot.data(), Z.mMat, Z.getLd());
+  return Z;
+} // matrix luFactorization::solve(const matrix & B) const
+
+/**
+ * @brief qrFactorization - Default constructor, of the factorization of an empty matrix.
+ */
+qrFactorization::qrFactorization() : mStatus(matrixFactorizationStatus()) {
+} // qrFactorization::qrFactorization()
+
+/**
+ * @brief qrFactorization - Overloaded constructor to factorize a (m x n) matrix, m >= n.
+ * @param X               - Matrix to be factorized.
+ */
+qrFactorization::qrFactorization(const matrix & X) {
+  this->factorize(X);
+} // qrFactorization::qrFactorization(const matrix & X)
+
+/**
+ * @brief determinant - Returns the determinant of the factorized square matrix, the product of the
+ *                      diagonal of R with the sign of the Householder reflectors. Each reflector
+ *                      with a nonzero tau has a determinant of -1.
+ * @return            - Determinant of the factorized matrix, zero if it is singular.
+ */
+double qrFactorization::determinant(void) const {
+  matrixCheckIsSquare(mFactor);
+  double det = 1.0;
+  for (unsigned long i = 0; i < mFactor.getRowSize(); i++) {
+    det *= mFactor.mMat[i * mFactor.getLd() + i];
+    if (mTau[i] != 0.0)
+      det = -det;
+  }
+  return det;
+} // double qrFactorization::determinant(void) const
+
+/**
+ * @brief factorize - Factorizes a (m x n) matrix, m >= n, X = Q * R, with the Householder
+ *                    reflectors of "matrixLapackGeqrf()", replacing any previous factorization.
+ *                    R is singular if any of its diagonal elements is exactly zero.
+ * @param X         - Matrix to be factorized.
+ */
+void qrFactorization::factorize(const matrix & X) {
+  if (X.getRowSize() < X.getColSize())
+    matrixExit("QR factorization requires at least as many rows as columns.");
+  unsigned long row = X.getRowSize();
+  unsigned long col = X.getColSize();
+  mFactor = X;
+  mTau.assign(col, 0.0);
+  mStatus = matrixFactorizationStatus();
+  if (col == 0)
+    return;
+
+  matrixLapackGeqrf(row, col, mFactor.mMat, mFactor.getLd(), mTau.data());
+  for (unsigned long i = 0; i < col; i++) {
+    if (mFactor.mMat[i * mFactor.getLd() + i] == 0.0) {
+      mStatus.singular = true;
+      mStatus.pivot = i + 1;
+      break;
+    }
+  }
+  mStatus.rcond = matrixLapackTrcon(true, col, mFactor.mMat, mFactor.getLd());
+} // void qrFactorization::factorize(const matrix & X)
+
+/**
+ * @brief getFactor - Returns the packed factor, R on and above the diagonal and the Householder
+ *                    vectors without their unit first element below it.
+ * @return          - The packed factor.
+ */
+const matrix & qrFactorization::getFactor(void) const {
+  return mFactor;
+} // const matrix & qrFactorization::getFactor(void) const
+
+/**
+ * @brief getStatus - Returns the rank deficiency and estimated conditioning of R.
+ * @return          - Status of the factorization.
+ */
+matrixStatus qrFactorization::getStatus(void) const {
+  return mStatus;
+} // matrixStatus qrFactorization::getStatus(void) const
+
+/**
+ * @brief getTau - Returns the scalar factors of the Householder reflectors.
+ * @return       - The scalar factors, one per column of the factorized matrix.
+ */
+const std::vector<double> & qrFactorization::getTau(void) const {
+  return mTau;
+} // const std::vector<double> & qrFactorization::getTau(void) const
+
+/**
+ * @brief inverse - Returns the inverse of the factorized square matrix.
+ * @return        - The inverse, NaN if the matrix is singular.
+ */
+matrix qrFactorization::inverse(void) const {
+  matrixCheckIsSquare(mFactor);
+  return this->solve(matrixIdentity(mFactor.getRowSize()));
+} // matrix qrFactorization::inverse(void) const
+
+/**
+ * @brief solve - Solves X * Z = B for Z with the factorized X, in the least squares sense when X
+ *                has more rows than columns. Q^T is applied to B one reflector at a time, without
+ *                forming Q, and the first n rows are then solved with R.
+ * @param B     - Right-hand sides, one per column, with the row size of X.
+ * @return      - The (n x nrhs) solution, NaN if R is singular.
+ */
+matrix qrFactorization::solve(const matrix & B) const {
+  if (B.getRowSize() != mFactor.getRowSize())
+    matrixExit("Matrices row size mismatch.");
+  unsigned long row = mFactor.getRowSize();
+  unsigned long col = mFactor.getColSize();
+  matrix Z(col, B.getColSize(), matrixUninitialized);
+  if (mStatus.singular) {
+    matrixFactorizationFailed(Z);
+    return Z;
+  }
+
+  matrix C = B;
+  matrixLapackOrmqr(true, row, C.getColSize(), col, mFactor.mMat, mFactor.getLd(), mTau.data(),
+                    C.mMat, C.getLd());
+  matrixKernelsCopy(col, C.getColSize(), C.mMat, C.getLd(), Z.mMat, Z.getLd());
+  matrixKernelsTrsm(true, false, col, Z.getColSize(), mFactor.mMat, mFactor.getLd(), 1, Z.mMat,
+                    Z.getLd());
+  return Z;
+} // matrix qrFactorization::solve(const matrix & B) const
+
+/**
+ * @brief choleskyFactorization - Default constructor, of the factorization of an empty matrix.
+ */
+choleskyFactorization::choleskyFactorization() : mStatus(matrixFactorizationStatus()) {
+} // choleskyFactorization::choleskyFactorization()
+
+/**
+ * @brief choleskyFactorization - Overloaded constructor to factorize a symmetric positive definite
+ *                                matrix.
+ * @param X                     - Matrix to be factorized.
+ */
+choleskyFactorization::choleskyFactorization(const matrix & X) {
+  this->factorize(X);
+} // choleskyFactorization::choleskyFactorization(const matrix & X)
+
+/**
+ * @brief determinant - Returns the determinant of the factorized matrix, the squared product of the
+ *                      diagonal of L.
+ * @return            - Determinant of the factorized matrix, NaN if the factorization failed.
+ */
+double choleskyFactorization::determinant(void) const {
+  if (mStatus.singular)
+    return std::numeric_limits<double>::quiet_NaN();
+
+  double det = 1.0;
+  for (unsigned long i = 0; i < mFactor.getRowSize(); i++)
+    det *= mFactor.mMat[i * mFactor.getLd() + i];
+  return det * det;
+} // double choleskyFactorization::determinant(void) const
+
+/**
+ * @brief factorize - Factorizes a symmetric positive definite matrix, X = L * L^T, with
+ *                    "matrixLapackPotrf()", replacing any previous factorization. Only the lower
+ *                    triangle of X is read, and the upper triangle of the factor is cleared.
+ * @param X         - Matrix to be factorized.
+ */
+void choleskyFactorization::factorize(const matrix & X) {
+  matrixCheckIsSquare(X);
+  unsigned long size = X.getRowSize();
+  mFactor = X;
+  mStatus = matrixFactorizationStatus();
+  if (size == 0)
+    return;
+
+  mStatus.pivot = matrixLapackPotrf(size, mFactor.mMat, mFactor.getLd());
+  mStatus.singular = mStatus.pivot != 0;
+  for (unsigned long i = 0; i + 1 < size; i++)
+    std::fill(&mFactor.mMat[i * mFactor.getLd() + i + 1], &mFactor.mMat[i * mFactor.getLd() + size],
+              0.0);
+  mStatus.rcond = 0.0;
+  if (!mStatus.singular)
+    mStatus.rcond = matrixLapackPocon(size, mFactor.mMat, mFactor.getLd(),
+                                      matrixLapackNorm1(size, size, X.mMat, X.getLd()));
+} // void choleskyFactorization::factorize(const matrix & X)
+
+/**
+ * @brief getFactor - Returns the lower triangular factor L, with zeros above the diagonal.
+ * @return          - The factor L.
+ */
+const matrix & choleskyFactorization::getFactor(void) const {
+  return mFactor;
+} // const matrix & choleskyFactorization::getFactor(void) const
+
+/**
+ * @brief getStatus - Returns whether the factorized matrix is positive definite, and its estimated
+ *                    conditioning.
+ * @return          - Status of the factorization.
+ */
+matrixStatus choleskyFactorization::getStatus(void) const {
+  return mStatus;
+} // matrixStatus choleskyFactorization::getStatus(void) const
+
+/**
+ * @brief inverse - Returns the inverse of the factorized matrix.
+ * @return        - The inverse, NaN if the factorization failed.
+ */
+matrix choleskyFactorization::inverse(void) const {
+  return this->solve(matrixIdentity(mFactor.getRowSize()));
+} // matrix choleskyFactorization::inverse(void) const
+
+/**
+ * @brief solve - Solves X * Z = B for Z with the factorized X, by forward and back substitutions
+ *                with L and L^T on all the columns of B together.
+ * @param B     - Right-hand sides, one per column.
+ * @return      - The solution, of the size of B, NaN if the factorization failed.
+ */
+matrix choleskyFactorization::solve(const matrix & B) const {
+  matrixCheckIsEqualInnerSize(mFactor, B);
+  matrix Z = B;
+  if (mStatus.singular)
+    matrixFactorizationFailed(Z);
+  else
+    matrixLapackPotrs(mFactor.getRowSize(), Z.getColSize(), mFactor.mMat, mFactor.getLd(), Z.mMat,
+                      Z.getLd());
+  return Z;
+} // matrix choleskyFactorization::solve(const matrix & B) const
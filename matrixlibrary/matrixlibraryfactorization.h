@@ -0,0 +1,265 @@
+/*
+ * Copyright:   2021 Johnathon Leong
+ *
+ * License:     License under LGPL-3.0-or-later.
+ *              Please refer to https://www.gnu.org/licenses/lgpl-3.0.txt for more information on the
+ *              terms of LGPL-3.0 or relavent website for a later version of the LGPL.
+ *
+ * Disclaimer:  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY
+ *              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ *              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ *              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ *              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *              WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author:      Johnathon Leong
+ *
+ * Note:        Factorization objects of matrixlibrary. Each object factorizes a matrix once and
+ *              owns its compact factor, packed in a single matrix as LAPACK stores it, together
+ *              with the pivot vector or the Householder scalars of the factorization. Every later
+ *              solve, determinant or inverse is computed from the stored factor, so that a solve
+ *              costs O(n^2) per right-hand side instead of the O(n^3) of a new factorization. A
+ *              factorization that fails, such as the LU of a singular matrix, is reported by
+ *              "getStatus()", and its solutions are NaN. To be used together with matrixlibrary
+ *              and matrixlibrarylapack.
+ *
+ * Version:     1.0.0
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Implemented first release version of matrixlibraryfactorization.
+ */
+
+#ifndef MATRIXLIBRARYFACTORIZATION_H
+#define MATRIXLIBRARYFACTORIZATION_H
+
+#include "matrixlibrary.h"
+#include <vector>
+
+class luFactorization
+{
+public:
+  /**
+   * @brief luFactorization - Default constructor, of the factorization of an empty matrix.
+   */
+  explicit luFactorization();
+
+  /**
+   * @brief luFactorization - Overloaded constructor to factorize a square matrix.
+   * @param X               - Matrix to be factorized.
+   */
+  explicit luFactorization(const matrix & X);
+
+  /**
+   * @brief determinant - Returns the determinant of the factorized matrix, the product of the
+   *                      diagonal of U with the sign of the row interchanges.
+   * @return            - Determinant of the factorized matrix, zero if it is singular.
+   */
+  double determinant(void) const;
+
+  /**
+   * @brief factorize - Factorizes a square matrix, P * X = L * U, replacing any previous
+   *                    factorization.
+   * @param X         - Matrix to be factorized.
+   */
+  void factorize(const matrix & X);
+
+  /**
+   * @brief getFactor - Returns the packed factor, U on and above the diagonal and L without its
+   *                    unit diagonal below it.
+   * @return          - The packed factor.
+   */
+  const matrix & getFactor(void) const;
+
+  /**
+   * @brief getPivot - Returns the zero based pivot vector. Row i was interchanged with row
+   *                   getPivot()[i] at step i of the factorization.
+   * @return         - The pivot vector.
+   */
+  const std::vector<unsigned long> & getPivot(void) const;
+
+  /**
+   * @brief getStatus - Returns the singularity and estimated conditioning of the factorized matrix.
+   * @return          - Status of the factorization.
+   */
+  matrixStatus getStatus(void) const;
+
+  /**
+   * @brief inverse - Returns the inverse of the factorized matrix, solved with the identity as the
+   *                  right-hand sides.
+   * @return        - The inverse, NaN if the matrix is singular.
+   */
+  matrix inverse(void) const;
+
+  /**
+   * @brief solve - Solves X * Z = B for Z with the factorized X.
+   * @param B     - Right-hand sides, one per column.
+   * @return      - The solution, of the size of B, NaN if the matrix is singular.
+   */
+  matrix solve(const matrix & B) const;
+
+private:
+  /**
+   * @brief mFactor - To store the packed L and U factors.
+   */
+  matrix mFactor;
+
+  /**
+   * @brief mPivot - To store the pivot vector.
+   */
+  std::vector<unsigned long> mPivot;
+
+  /**
+   * @brief mStatus - To store the status of the factorization.
+   */
+  matrixStatus mStatus;
+};
+
+class qrFactorization
+{
+public:
+  /**
+   * @brief qrFactorization - Default constructor, of the factorization of an empty matrix.
+   */
+  explicit qrFactorization();
+
+  /**
+   * @brief qrFactorization - Overloaded constructor to factorize a (m x n) matrix, m >= n.
+   * @param X               - Matrix to be factorized.
+   */
+  explicit qrFactorization(const matrix & X);
+
+  /**
+   * @brief determinant - Returns the determinant of the factorized square matrix, the product of
+   *                      the diagonal of R with the sign of the Householder reflectors.
+   * @return            - Determinant of the factorized matrix, zero if it is singular.
+   */
+  double determinant(void) const;
+
+  /**
+   * @brief factorize - Factorizes a (m x n) matrix, m >= n, X = Q * R, with Householder
+   *                    reflectors, replacing any previous factorization.
+   * @param X         - Matrix to be factorized.
+   */
+  void factorize(const matrix & X);
+
+  /**
+   * @brief getFactor - Returns the packed factor, R on and above the diagonal and the Householder
+   *                    vectors without their unit first element below it.
+   * @return          - The packed factor.
+   */
+  const matrix & getFactor(void) const;
+
+  /**
+   * @brief getStatus - Returns the rank deficiency and estimated conditioning of R.
+   * @return          - Status of the factorization.
+   */
+  matrixStatus getStatus(void) const;
+
+  /**
+   * @brief getTau - Returns the scalar factors of the Householder reflectors.
+   * @return       - The scalar factors, one per column of the factorized matrix.
+   */
+  const std::vector<double> & getTau(void) const;
+
+  /**
+   * @brief inverse - Returns the inverse of the factorized square matrix.
+   * @return        - The inverse, NaN if the matrix is singular.
+   */
+  matrix inverse(void) const;
+
+  /**
+   * @brief solve - Solves X * Z = B for Z with the factorized X, in the least squares sense when X
+   *                has more rows than columns, Z = R^-1 * (Q^T * B)(0:n, :).
+   * @param B     - Right-hand sides, one per column, with the row size of X.
+   * @return      - The (n x nrhs) solution, NaN if R is singular.
+   */
+  matrix solve(const matrix & B) const;
+
+private:
+  /**
+   * @brief mFactor - To store the packed R factor and Householder vectors.
+   */
+  matrix mFactor;
+
+  /**
+   * @brief mTau - To store the scalar factors of the Householder reflectors.
+   */
+  std::vector<double> mTau;
+
+  /**
+   * @brief mStatus - To store the status of the factorization.
+   */
+  matrixStatus mStatus;
+};
+
+class choleskyFactorization
+{
+public:
+  /**
+   * @brief choleskyFactorization - Default constructor, of the factorization of an empty matrix.
+   */
+  explicit choleskyFactorization();
+
+  /**
+   * @brief choleskyFactorization - Overloaded constructor to factorize a symmetric positive
+   *                                definite matrix.
+   * @param X                     - Matrix to be factorized.
+   */
+  explicit choleskyFactorization(const matrix & X);
+
+  /**
+   * @brief determinant - Returns the determinant of the factorized matrix, the squared product of
+   *                      the diagonal of L.
+   * @return            - Determinant of the factorized matrix, NaN if the factorization failed.
+   */
+  double determinant(void) const;
+
+  /**
+   * @brief factorize - Factorizes a symmetric positive definite matrix, X = L * L^T, replacing any
+   *                    previous factorization. Only the lower triangle of X is read.
+   * @param X         - Matrix to be factorized.
+   */
+  void factorize(const matrix & X);
+
+  /**
+   * @brief getFactor - Returns the lower triangular factor L, with zeros above the diagonal.
+   * @return          - The factor L.
+   */
+  const matrix & getFactor(void) const;
+
+  /**
+   * @brief getStatus - Returns whether the factorized matrix is positive definite, and its
+   *                    estimated conditioning. A matrix that is not positive definite is reported
+   *                    as singular, with the index of the first failed leading minor as the pivot.
+   * @return          - Status of the factorization.
+   */
+  matrixStatus getStatus(void) const;
+
+  /**
+   * @brief inverse - Returns the inverse of the factorized matrix.
+   * @return        - The inverse, NaN if the factorization failed.
+   */
+  matrix inverse(void) const;
+
+  /**
+   * @brief solve - Solves X * Z = B for Z with the factorized X.
+   * @param B     - Right-hand sides, one per column.
+   * @return      - The solution, of the size of B, NaN if the factorization failed.
+   */
+  matrix solve(const matrix & B) const;
+
+private:
+  /**
+   * @brief mFactor - To store the factor L.
+   */
+  matrix mFactor;
+
+  /**
+   * @brief mStatus - To store the status of the factorization.
+   */
+  matrixStatus mStatus;
+};
+
+#endif // MATRIXLIBRARYFACTORIZATION_H
@@ -0,0 +1,763 @@
+/*
+ * Copyright:   2021 Johnathon Leong
+ *
+ * License:     License under LGPL-3.0-or-later.
+ *              Please refer to https://www.gnu.org/licenses/lgpl-3.0.txt for more information on the
+ *              terms of LGPL-3.0 or relavent website for a later version of the LGPL.
+ *
+ * Disclaimer:  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY
+ *              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ *              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ *              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ *              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *              WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author:      Johnathon Leong
+ *
+ * Note:        Fixed size matrices of matrixlibrary. The size of a fixed matrix is a compile time
+ *              constant and its elements are stored inline, in row-major order, so that a fixed
+ *              matrix never allocates memory and every loop has a constant trip count that the
+ *              compiler fully unrolls. Intended for small matrices (2x2 to 8x8), such as transforms
+ *              and covariances. The inverse and determinant are computed in closed form up to 4x4.
+ *              A fixed matrix is a matrix expression, so that it can be assigned into a matrix or
+ *              a view, and evaluated from a matrix, a view or any matrix expression.
+ *              To be used together with matrixlibrary and matrixlibraryexpression.
+ *
+ * Version:     1.0.0
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Implemented first release version of matrixlibraryfixed.
+ */
+
+#ifndef MATRIXLIBRARYFIXED_H
+#define MATRIXLIBRARYFIXED_H
+
+#include "matrixlibrary.h"
+#include <math.h>
+
+template <unsigned long R, unsigned long C>
+class fixedMatrix : public matrixExpression<fixedMatrix<R, C> >
+{
+  static_assert((R > 0) && (C > 0), "The size of a fixed matrix must not be zero.");
+
+public:
+  /**
+   * @brief fixedMatrix - Default constructor. All the elements are cleared to zero.
+   */
+  fixedMatrix();
+
+  /**
+   * @brief fixedMatrix - Overloaded constructor to copy the elements from a row-major array.
+   * @param values      - Pointer to the R * C values, in row-major order.
+   */
+  explicit fixedMatrix(const double * values);
+
+  /**
+   * @brief fixedMatrix - Overloaded constructor to evaluate a matrix, a view or a matrix
+   *                      expression. Aborts when its size is not R x C.
+   * @param X           - Matrix expression to be evaluated.
+   */
+  template <typename E>
+  explicit fixedMatrix(const matrixExpression<E> & X);
+
+  /**
+   * @brief operator = - Overloaded operator to evaluate a matrix, a view or a matrix expression
+   *                     into itself. Aborts when its size is not R x C.
+   * @param X          - Matrix expression to be evaluated.
+   * @return           - Returns the fixed matrix reference of itself.
+   */
+  template <typename E>
+  fixedMatrix& operator=(const matrixExpression<E> & X);
+
+  /**
+   * @brief operator() - Return the value stored in the element defined by the input arguments.
+   * @param rowIndex   - Row index of the element.
+   * @param colIndex   - Column index of the element.
+   * @return           - Returns the stored value.
+   */
+  double& operator()(unsigned long rowIndex, unsigned long colIndex);
+
+  /**
+   * @brief operator() - Return the value stored in the element defined by the input arguments.
+   * @param rowIndex   - Row index of the element.
+   * @param colIndex   - Column index of the element.
+   * @return           - Returns the stored value.
+   */
+  const double& operator()(unsigned long rowIndex, unsigned long colIndex) const;
+
+  /**
+   * @brief evaluate - Returns the value of an element as a matrix expression.
+   * @param row      - Zero based row index.
+   * @param col      - Zero based column index.
+   * @return         - Value of the element.
+   */
+  double evaluate(unsigned long row, unsigned long col) const { return mMat[row * C + col]; }
+
+  /**
+   * @brief getColSize - Returns the column size of the fixed matrix.
+   * @return           - Column size of the fixed matrix.
+   */
+  unsigned long getColSize(void) const { return C; }
+
+  /**
+   * @brief getLd - Returns the leading dimension (row stride) of the fixed matrix.
+   * @return      - Leading dimension of the fixed matrix.
+   */
+  unsigned long getLd(void) const { return C; }
+
+  /**
+   * @brief getRowSize - Returns the row size of the fixed matrix.
+   * @return           - Row size of the fixed matrix.
+   */
+  unsigned long getRowSize(void) const { return R; }
+
+  /**
+   * @brief getSize - Returns the total number of elements in the fixed matrix.
+   * @return        - Size of the fixed matrix.
+   */
+  unsigned long getSize(void) const { return R * C; }
+
+  /**
+   * @brief view - Returns a view of the whole fixed matrix, to be used with the functions of the
+   *               other modules that work on views.
+   * @return     - Returns the view of the fixed matrix.
+   */
+  matrixView view(void) { return matrixView(mMat, R, C, C); }
+
+  /**
+   * @brief mMat - "double" type array to store the elements of the fixed matrix.
+   *               IMPORTANT NOTE: THIS ATTRIBUTE IS NOT "PRIVATE" FOR EFFICIENCY.
+   */
+  double mMat[R * C];
+};
+
+/**
+ * @brief fixedMatrixSquare - Determinant and inverse of a square fixed matrix. The general case
+ *                            uses Gaussian elimination with partial pivoting, and the sizes up to
+ *                            4x4 are specialised with closed form expressions. A singular
+ *                            matrix is not detected and gives non-finite elements.
+ */
+template <unsigned long N>
+struct fixedMatrixSquare {
+  static double determinant(const double * X);
+  static void inverse(const double * X, double * Z);
+};
+
+/**
+ * @brief operator + - Overloading of the addition operatior between two fixed matrices.
+ * @param X          - Main fixed matrix for addition.
+ * @param Y          - Addition fixed matrix.
+ * @return           - The resultant fixed matrix.
+ */
+template <unsigned long R, unsigned long C>
+fixedMatrix<R, C> operator+(const fixedMatrix<R, C> & X, const fixedMatrix<R, C> & Y);
+
+/**
+ * @brief operator - - Overloading of the subtraction operatior between two fixed matrices.
+ * @param X          - Main fixed matrix for subtraction.
+ * @param Y          - Subtraction fixed matrix.
+ * @return           - The resultant fixed matrix.
+ */
+template <unsigned long R, unsigned long C>
+fixedMatrix<R, C> operator-(const fixedMatrix<R, C> & X, const fixedMatrix<R, C> & Y);
+
+/**
+ * @brief operator * - Overloading of the multiplication operatior between two fixed matrices.
+ * @param X          - Main fixed matrix for multiplication.
+ * @param Y          - Multiplication fixed matrix.
+ * @return           - The resultant fixed matrix.
+ */
+template <unsigned long R, unsigned long K, unsigned long C>
+fixedMatrix<R, C> operator*(const fixedMatrix<R, K> & X, const fixedMatrix<K, C> & Y);
+
+/**
+ * @brief operator + - Overloading of the addition operatior between a fixed matrix and a double
+ *                     type value.
+ * @param X          - Main fixed matrix for addition.
+ * @param Y          - Addition value.
+ * @return           - The resultant fixed matrix.
+ */
+template <unsigned long R, unsigned long C>
+fixedMatrix<R, C> operator+(const fixedMatrix<R, C> & X, const double & Y);
+
+/**
+ * @brief operator - - Overloading of the subtraction operatior between a fixed matrix and a double
+ *                     type value.
+ * @param X          - Main fixed matrix for subtraction.
+ * @param Y          - Subtraction value.
+ * @return           - The resultant fixed matrix.
+ */
+template <unsigned long R, unsigned long C>
+fixedMatrix<R, C> operator-(const fixedMatrix<R, C> & X, const double & Y);
+
+/**
+ * @brief operator * - Overloading of the multiplication operatior between a fixed matrix and a
+ *                     double type value.
+ * @param X          - Main fixed matrix for multiplication.
+ * @param Y          - Multiplication value.
+ * @return           - The resultant fixed matrix.
+ */
+template <unsigned long R, unsigned long C>
+fixedMatrix<R, C> operator*(const fixedMatrix<R, C> & X, const double & Y);
+
+/**
+ * @brief operator / - Overloading of the division operatior between a fixed matrix and a double
+ *                     type value.
+ * @param X          - Main fixed matrix for division.
+ * @param Y          - Division value.
+ * @return           - The resultant fixed matrix.
+ */
+template <unsigned long R, unsigned long C>
+fixedMatrix<R, C> operator/(const fixedMatrix<R, C> & X, const double & Y);
+
+/**
+ * @brief operator += - Overloading of the addition equal operatior between two fixed matrices.
+ * @param X           - Main fixed matrix for addition.
+ * @param Y           - Addition fixed matrix.
+ */
+template <unsigned long R, unsigned long C>
+void operator+=(fixedMatrix<R, C> & X, const fixedMatrix<R, C> & Y);
+
+/**
+ * @brief operator -= - Overloading of the subtraction equal operatior between two fixed matrices.
+ * @param X           - Main fixed matrix for subtraction.
+ * @param Y           - Subtraction fixed matrix.
+ */
+template <unsigned long R, unsigned long C>
+void operator-=(fixedMatrix<R, C> & X, const fixedMatrix<R, C> & Y);
+
+/**
+ * @brief operator *= - Overloading of the multiplication operatior between a fixed matrix and a
+ *                      double type value.
+ * @param X           - Main fixed matrix for multiplication.
+ * @param Y           - Multiplication value.
+ */
+template <unsigned long R, unsigned long C>
+void operator*=(fixedMatrix<R, C> & X, const double & Y);
+
+/**
+ * @brief operator /= - Overloading of the division operatior between a fixed matrix and a double
+ *                      type value.
+ * @param X           - Main fixed matrix for division.
+ * @param Y           - Division value.
+ */
+template <unsigned long R, unsigned long C>
+void operator/=(fixedMatrix<R, C> & X, const double & Y);
+
+/**
+ * @brief matrixFixedDeterminant - Computes the determinant of a square fixed matrix.
+ * @param X                      - The square fixed matrix.
+ * @return                       - The determinant.
+ */
+template <unsigned long N>
+double matrixFixedDeterminant(const fixedMatrix<N, N> & X);
+
+/**
+ * @brief matrixFixedIdentity - Create a square fixed identity matrix.
+ * @return                    - The fixed identity matrix.
+ */
+template <unsigned long N>
+fixedMatrix<N, N> matrixFixedIdentity(void);
+
+/**
+ * @brief matrixInverse - Create an inverse copy of the input square fixed matrix.
+ * @param X             - The square fixed matrix to be inversed.
+ * @return              - The inversed fixed matrix.
+ */
+template <unsigned long N>
+fixedMatrix<N, N> matrixInverse(const fixedMatrix<N, N> & X);
+
+/**
+ * @brief matrixTranspose - Create a transpose copy of the input fixed matrix.
+ * @param X               - The fixed matrix to be transposed.
+ * @return                - The transposed fixed matrix.
+ */
+template <unsigned long R, unsigned long C>
+fixedMatrix<C, R> matrixTranspose(const fixedMatrix<R, C> & X);
+
+/// ================================================================================================
+/// TEMPLATE FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief matrixExpressionStore - Fixed matrices are held by reference in the expression tree.
+ */
+template <unsigned long R, unsigned long C>
+struct matrixExpressionStore<fixedMatrix<R, C> > {
+  typedef const fixedMatrix<R, C> & type;
+};
+
+/**
+ * @brief fixedMatrix - Default constructor. All the elements are cleared to zero.
+ */
+template <unsigned long R, unsigned long C>
+fixedMatrix<R, C>::fixedMatrix() {
+  for (unsigned long i = 0; i < R * C; i++)
+    mMat[i] = 0;
+} // fixedMatrix<R, C>::fixedMatrix() --------------------------------------------------------------
+
+/**
+ * @brief fixedMatrix - Overloaded constructor to copy the elements from a row-major array.
+ * @param values      - Pointer to the R * C values, in row-major order.
+ */
+template <unsigned long R, unsigned long C>
+fixedMatrix<R, C>::fixedMatrix(const double * values) {
+  for (unsigned long i = 0; i < R * C; i++)
+    mMat[i] = values[i];
+} // fixedMatrix<R, C>::fixedMatrix(const double * values) -----------------------------------------
+
+/**
+ * @brief fixedMatrix - Overloaded constructor to evaluate a matrix, a view or a matrix
+ *                      expression. Aborts when its size is not R x C.
+ * @param X           - Matrix expression to be evaluated.
+ */
+template <unsigned long R, unsigned long C>
+template <typename E>
+fixedMatrix<R, C>::fixedMatrix(const matrixExpression<E> & X) {
+  matrixExpressionEvaluate<matrixExpressionAssign>(mMat, R, C, C, X);
+} // fixedMatrix<R, C>::fixedMatrix(const matrixExpression<E> & X) ---------------------------------
+
+/**
+ * @brief operator = - Overloaded operator to evaluate a matrix, a view or a matrix expression
+ *                     into itself. Aborts when its size is not R x C.
+ * @param X          - Matrix expression to be evaluated.
+ * @return           - Returns the fixed matrix reference of itself.
+ */
+template <unsigned long R, unsigned long C>
+template <typename E>
+fixedMatrix<R, C>& fixedMatrix<R, C>::operator=(const matrixExpression<E> & X) {
+  matrixExpressionEvaluate<matrixExpressionAssign>(mMat, R, C, C, X);
+  return * this;
+} // fixedMatrix<R, C>& fixedMatrix<R, C>::operator=(const matrixExpression<E> & X) ----------------
+
+/**
+ * @brief operator() - Return the value stored in the element defined by the input arguments.
+ * @param rowIndex   - Row index of the element.
+ * @param colIndex   - Column index of the element.
+ * @return           - Returns the stored value.
+ */
+template <unsigned long R, unsigned long C>
+inline double& fixedMatrix<R, C>::operator()(unsigned long rowIndex, unsigned long colIndex) {
+  return mMat[--rowIndex * C + --colIndex];
+} // fixedMatrix<R, C>::operator()(unsigned long rowIndex, unsigned long colIndex) -----------------
+
+/**
+ * @brief operator() - Return the value stored in the element defined by the input arguments.
+ * @param rowIndex   - Row index of the element.
+ * @param colIndex   - Column index of the element.
+ * @return           - Returns the stored value.
+ */
+template <unsigned long R, unsigned long C>
+inline const double& fixedMatrix<R, C>::operator()(unsigned long rowIndex, unsigned long colIndex) const {
+  return mMat[--rowIndex * C + --colIndex];
+} // fixedMatrix<R, C>::operator()(unsigned long rowIndex, unsigned long colIndex) const -----------
+
+/**
+ * @brief determinant - Computes the determinant of a square matrix by Gaussian elimination with
+ *                      partial pivoting.
+ * @param X           - Pointer to the N * N row-major elements.
+ * @return            - The determinant.
+ */
+template <unsigned long N>
+double fixedMatrixSquare<N>::determinant(const double * X) {
+  double a[N * N];
+  for (unsigned long i = 0; i < N * N; i++)
+    a[i] = X[i];
+
+  double det = 1;
+  for (unsigned long k = 0; k < N; k++) {
+    unsigned long p = k;
+    for (unsigned long i = k + 1; i < N; i++) {
+      if (fabs(a[i * N + k]) > fabs(a[p * N + k]))
+        p = i;
+    }
+    if (a[p * N + k] == 0)
+      return 0;
+    if (p != k) {
+      for (unsigned long j = 0; j < N; j++) {
+        double t = a[k * N + j];
+        a[k * N + j] = a[p * N + j];
+        a[p * N + j] = t;
+      }
+      det = -det;
+    }
+    det *= a[k * N + k];
+    for (unsigned long i = k + 1; i < N; i++) {
+      double l = a[i * N + k] / a[k * N + k];
+      for (unsigned long j = k + 1; j < N; j++)
+        a[i * N + j] -= l * a[k * N + j];
+    }
+  }
+  return det;
+} // double fixedMatrixSquare<N>::determinant(const double * X) ------------------------------------
+
+/**
+ * @brief inverse - Computes the inverse of a square matrix by Gauss-Jordan elimination with
+ *                  partial pivoting.
+ * @param X       - Pointer to the N * N row-major elements.
+ * @param Z       - Pointer to the N * N row-major elements of the inverse.
+ */
+template <unsigned long N>
+void fixedMatrixSquare<N>::inverse(const double * X, double * Z) {
+  double a[N * N];
+  for (unsigned long i = 0; i < N * N; i++) {
+    a[i] = X[i];
+    Z[i] = 0;
+  }
+  for (unsigned long i = 0; i < N; i++)
+    Z[i * N + i] = 1;
+
+  for (unsigned long k = 0; k < N; k++) {
+    unsigned long p = k;
+    for (unsigned long i = k + 1; i < N; i++) {
+      if (fabs(a[i * N + k]) > fabs(a[p * N + k]))
+        p = i;
+    }
+    if (p != k) {
+      for (unsigned long j = 0; j < N; j++) {
+        double t = a[k * N + j];
+        a[k * N + j] = a[p * N + j];
+        a[p * N + j] = t;
+        t = Z[k * N + j];
+        Z[k * N + j] = Z[p * N + j];
+        Z[p * N + j] = t;
+      }
+    }
+    double divider = 1 / a[k * N + k];
+    for (unsigned long j = 0; j < N; j++) {
+      a[k * N + j] *= divider;
+      Z[k * N + j] *= divider;
+    }
+    for (unsigned long i = 0; i < N; i++) {
+      if (i != k) {
+        double l = a[i * N + k];
+        for (unsigned long j = 0; j < N; j++) {
+          a[i * N + j] -= l * a[k * N + j];
+          Z[i * N + j] -= l * Z[k * N + j];
+        }
+      }
+    }
+  }
+} // void fixedMatrixSquare<N>::inverse(const double * X, double * Z) ------------------------------
+
+/**
+ * @brief fixedMatrixSquare - Closed form determinant and inverse of a 1x1 matrix.
+ */
+template <>
+struct fixedMatrixSquare<1> {
+  static double determinant(const double * X) { return X[0]; }
+  static void inverse(const double * X, double * Z) { Z[0] = 1 / X[0]; }
+};
+
+/**
+ * @brief fixedMatrixSquare - Closed form determinant and inverse of a 2x2 matrix.
+ */
+template <>
+struct fixedMatrixSquare<2> {
+  static double determinant(const double * X) {
+    return X[0] * X[3] - X[1] * X[2];
+  }
+
+  static void inverse(const double * X, double * Z) {
+    double d = 1 / determinant(X);
+    double x0 = X[0];
+    Z[0] = X[3] * d;
+    Z[1] = -X[1] * d;
+    Z[2] = -X[2] * d;
+    Z[3] = x0 * d;
+  }
+};
+
+/**
+ * @brief fixedMatrixSquare - Closed form determinant and inverse of a 3x3 matrix, by the cofactors.
+ */
+template <>
+struct fixedMatrixSquare<3> {
+  static double determinant(const double * X) {
+    return X[0] * (X[4] * X[8] - X[5] * X[7]) -
+           X[1] * (X[3] * X[8] - X[5] * X[6]) +
+           X[2] * (X[3] * X[7] - X[4] * X[6]);
+  }
+
+  static void inverse(const double * X, double * Z) {
+    double c00 = X[4] * X[8] - X[5] * X[7];
+    double c01 = X[5] * X[6] - X[3] * X[8];
+    double c02 = X[3] * X[7] - X[4] * X[6];
+    double d = 1 / (X[0] * c00 + X[1] * c01 + X[2] * c02);
+    double z[9];
+    z[0] = c00 * d;
+    z[1] = (X[2] * X[7] - X[1] * X[8]) * d;
+    z[2] = (X[1] * X[5] - X[2] * X[4]) * d;
+    z[3] = c01 * d;
+    z[4] = (X[0] * X[8] - X[2] * X[6]) * d;
+    z[5] = (X[2] * X[3] - X[0] * X[5]) * d;
+    z[6] = c02 * d;
+    z[7] = (X[1] * X[6] - X[0] * X[7]) * d;
+    z[8] = (X[0] * X[4] - X[1] * X[3]) * d;
+    for (unsigned long i = 0; i < 9; i++)
+      Z[i] = z[i];
+  }
+};
+
+/**
+ * @brief fixedMatrixSquare - Closed form determinant and inverse of a 4x4 matrix, by the 2x2 minors
+ *                            of the upper and lower row pairs (Laplace expansion).
+ */
+template <>
+struct fixedMatrixSquare<4> {
+  static double determinant(const double * X) {
+    double s0 = X[0] * X[5] - X[4] * X[1];
+    double s1 = X[0] * X[6] - X[4] * X[2];
+    double s2 = X[0] * X[7] - X[4] * X[3];
+    double s3 = X[1] * X[6] - X[5] * X[2];
+    double s4 = X[1] * X[7] - X[5] * X[3];
+    double s5 = X[2] * X[7] - X[6] * X[3];
+    double c5 = X[10] * X[15] - X[14] * X[11];
+    double c4 = X[9] * X[15] - X[13] * X[11];
+    double c3 = X[9] * X[14] - X[13] * X[10];
+    double c2 = X[8] * X[15] - X[12] * X[11];
+    double c1 = X[8] * X[14] - X[12] * X[10];
+    double c0 = X[8] * X[13] - X[12] * X[9];
+    return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+  }
+
+  static void inverse(const double * X, double * Z) {
+    double s0 = X[0] * X[5] - X[4] * X[1];
+    double s1 = X[0] * X[6] - X[4] * X[2];
+    double s2 = X[0] * X[7] - X[4] * X[3];
+    double s3 = X[1] * X[6] - X[5] * X[2];
+    double s4 = X[1] * X[7] - X[5] * X[3];
+    double s5 = X[2] * X[7] - X[6] * X[3];
+    double c5 = X[10] * X[15] - X[14] * X[11];
+    double c4 = X[9] * X[15] - X[13] * X[11];
+    double c3 = X[9] * X[14] - X[13] * X[10];
+    double c2 = X[8] * X[15] - X[12] * X[11];
+    double c1 = X[8] * X[14] - X[12] * X[10];
+    double c0 = X[8] * X[13] - X[12] * X[9];
+    double d = 1 / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+    double z[16];
+    z[0] = (X[5] * c5 - X[6] * c4 + X[7] * c3) * d;
+    z[1] = (-X[1] * c5 + X[2] * c4 - X[3] * c3) * d;
+    z[2] = (X[13] * s5 - X[14] * s4 + X[15] * s3) * d;
+    z[3] = (-X[9] * s5 + X[10] * s4 - X[11] * s3) * d;
+    z[4] = (-X[4] * c5 + X[6] * c2 - X[7] * c1) * d;
+    z[5] = (X[0] * c5 - X[2] * c2 + X[3] * c1) * d;
+    z[6] = (-X[12] * s5 + X[14] * s2 - X[15] * s1) * d;
+    z[7] = (X[8] * s5 - X[10] * s2 + X[11] * s1) * d;
+    z[8] = (X[4] * c4 - X[5] * c2 + X[7] * c0) * d;
+    z[9] = (-X[0] * c4 + X[1] * c2 - X[3] * c0) * d;
+    z[10] = (X[12] * s4 - X[13] * s2 + X[15] * s0) * d;
+    z[11] = (-X[8] * s4 + X[9] * s2 - X[11] * s0) * d;
+    z[12] = (-X[4] * c3 + X[5] * c1 - X[6] * c0) * d;
+    z[13] = (X[0] * c3 - X[1] * c1 + X[2] * c0) * d;
+    z[14] = (-X[12] * s3 + X[13] * s1 - X[14] * s0) * d;
+    z[15] = (X[8] * s3 - X[9] * s1 + X[10] * s0) * d;
+    for (unsigned long i = 0; i < 16; i++)
+      Z[i] = z[i];
+  }
+};
+
+/**
+ * @brief operator + - Overloading of the addition operatior between two fixed matrices.
+ * @param X          - Main fixed matrix for addition.
+ * @param Y          - Addition fixed matrix.
+ * @return           - The resultant fixed matrix.
+ */
+template <unsigned long R, unsigned long C>
+fixedMatrix<R, C> operator+(const fixedMatrix<R, C> & X, const fixedMatrix<R, C> & Y) {
+  fixedMatrix<R, C> Z;
+  for (unsigned long i = 0; i < R * C; i++)
+    Z.mMat[i] = X.mMat[i] + Y.mMat[i];
+  return Z;
+} // operator+(const fixedMatrix<R, C> & X, const fixedMatrix<R, C> & Y) ---------------------------
+
+/**
+ * @brief operator - - Overloading of the subtraction operatior between two fixed matrices.
+ * @param X          - Main fixed matrix for subtraction.
+ * @param Y          - Subtraction fixed matrix.
+ * @return           - The resultant fixed matrix.
+ */
+template <unsigned long R, unsigned long C>
+fixedMatrix<R, C> operator-(const fixedMatrix<R, C> & X, const fixedMatrix<R, C> & Y) {
+  fixedMatrix<R, C> Z;
+  for (unsigned long i = 0; i < R * C; i++)
+    Z.mMat[i] = X.mMat[i] - Y.mMat[i];
+  return Z;
+} // operator-(const fixedMatrix<R, C> & X, const fixedMatrix<R, C> & Y) ---------------------------
+
+/**
+ * @brief operator * - Overloading of the multiplication operatior between two fixed matrices.
+ * @param X          - Main fixed matrix for multiplication.
+ * @param Y          - Multiplication fixed matrix.
+ * @return           - The resultant fixed matrix.
+ */
+template <unsigned long R, unsigned long K, unsigned long C>
+fixedMatrix<R, C> operator*(const fixedMatrix<R, K> & X, const fixedMatrix<K, C> & Y) {
+  fixedMatrix<R, C> Z;
+  for (unsigned long i = 0; i < R; i++) {
+    for (unsigned long k = 0; k < K; k++) {
+      double x = X.mMat[i * K + k];
+      for (unsigned long j = 0; j < C; j++)
+        Z.mMat[i * C + j] += x * Y.mMat[k * C + j];
+    }
+  }
+  return Z;
+} // operator*(const fixedMatrix<R, K> & X, const fixedMatrix<K, C> & Y) ---------------------------
+
+/**
+ * @brief operator + - Overloading of the addition operatior between a fixed matrix and a double
+ *                     type value.
+ * @param X          - Main fixed matrix for addition.
+ * @param Y          - Addition value.
+ * @return           - The resultant fixed matrix.
+ */
+template <unsigned long R, unsigned long C>
+fixedMatrix<R, C> operator+(const fixedMatrix<R, C> & X, const double & Y) {
+  fixedMatrix<R, C> Z;
+  for (unsigned long i = 0; i < R * C; i++)
+    Z.mMat[i] = X.mMat[i] + Y;
+  return Z;
+} // operator+(const fixedMatrix<R, C> & X, const double & Y) --------------------------------------
+
+/**
+ * @brief operator - - Overloading of the subtraction operatior between a fixed matrix and a double
+ *                     type value.
+ * @param X          - Main fixed matrix for subtraction.
+ * @param Y          - Subtraction value.
+ * @return           - The resultant fixed matrix.
+ */
+template <unsigned long R, unsigned long C>
+fixedMatrix<R, C> operator-(const fixedMatrix<R, C> & X, const double & Y) {
+  fixedMatrix<R, C> Z;
+  for (unsigned long i = 0; i < R * C; i++)
+    Z.mMat[i] = X.mMat[i] - Y;
+  return Z;
+} // operator-(const fixedMatrix<R, C> & X, const double & Y) --------------------------------------
+
+/**
+ * @brief operator * - Overloading of the multiplication operatior between a fixed matrix and a
+ *                     double type value.
+ * @param X          - Main fixed matrix for multiplication.
+ * @param Y          - Multiplication value.
+ * @return           - The resultant fixed matrix.
+ */
+template <unsigned long R, unsigned long C>
+fixedMatrix<R, C> operator*(const fixedMatrix<R, C> & X, const double & Y) {
+  fixedMatrix<R, C> Z;
+  for (unsigned long i = 0; i < R * C; i++)
+    Z.mMat[i] = X.mMat[i] * Y;
+  return Z;
+} // operator*(const fixedMatrix<R, C> & X, const double & Y) --------------------------------------
+
+/**
+ * @brief operator / - Overloading of the division operatior between a fixed matrix and a double
+ *                     type value.
+ * @param X          - Main fixed matrix for division.
+ * @param Y          - Division value.
+ * @return           - The resultant fixed matrix.
+ */
+template <unsigned long R, unsigned long C>
+fixedMatrix<R, C> operator/(const fixedMatrix<R, C> & X, const double & Y) {
+  fixedMatrix<R, C> Z;
+  for (unsigned long i = 0; i < R * C; i++)
+    Z.mMat[i] = X.mMat[i] / Y;
+  return Z;
+} // operator/(const fixedMatrix<R, C> & X, const double & Y) --------------------------------------
+
+/**
+ * @brief operator += - Overloading of the addition equal operatior between two fixed matrices.
+ * @param X           - Main fixed matrix for addition.
+ * @param Y           - Addition fixed matrix.
+ */
+template <unsigned long R, unsigned long C>
+void operator+=(fixedMatrix<R, C> & X, const fixedMatrix<R, C> & Y) {
+  for (unsigned long i = 0; i < R * C; i++)
+    X.mMat[i] += Y.mMat[i];
+} // operator+=(fixedMatrix<R, C> & X, const fixedMatrix<R, C> & Y) --------------------------------
+
+/**
+ * @brief operator -= - Overloading of the subtraction equal operatior between two fixed matrices.
+ * @param X           - Main fixed matrix for subtraction.
+ * @param Y           - Subtraction fixed matrix.
+ */
+template <unsigned long R, unsigned long C>
+void operator-=(fixedMatrix<R, C> & X, const fixedMatrix<R, C> & Y) {
+  for (unsigned long i = 0; i < R * C; i++)
+    X.mMat[i] -= Y.mMat[i];
+} // operator-=(fixedMatrix<R, C> & X, const fixedMatrix<R, C> & Y) --------------------------------
+
+/**
+ * @brief operator *= - Overloading of the multiplication operatior between a fixed matrix and a
+ *                      double type value.
+ * @param X           - Main fixed matrix for multiplication.
+ * @param Y           - Multiplication value.
+ */
+template <unsigned long R, unsigned long C>
+void operator*=(fixedMatrix<R, C> & X, const double & Y) {
+  for (unsigned long i = 0; i < R * C; i++)
+    X.mMat[i] *= Y;
+} // operator*=(fixedMatrix<R, C> & X, const double & Y) -------------------------------------------
+
+/**
+ * @brief operator /= - Overloading of the division operatior between a fixed matrix and a double
+ *                      type value.
+ * @param X           - Main fixed matrix for division.
+ * @param Y           - Division value.
+ */
+template <unsigned long R, unsigned long C>
+void operator/=(fixedMatrix<R, C> & X, const double & Y) {
+  for (unsigned long i = 0; i < R * C; i++)
+    X.mMat[i] /= Y;
+} // operator/=(fixedMatrix<R, C> & X, const double & Y) -------------------------------------------
+
+/**
+ * @brief matrixFixedDeterminant - Computes the determinant of a square fixed matrix.
+ * @param X                      - The square fixed matrix.
+ * @return                       - The determinant.
+ */
+template <unsigned long N>
+double matrixFixedDeterminant(const fixedMatrix<N, N> & X) {
+  return fixedMatrixSquare<N>::determinant(X.mMat);
+} // double matrixFixedDeterminant(const fixedMatrix<N, N> & X) ------------------------------------
+
+/**
+ * @brief matrixFixedIdentity - Create a square fixed identity matrix.
+ * @return                    - The fixed identity matrix.
+ */
+template <unsigned long N>
+fixedMatrix<N, N> matrixFixedIdentity(void) {
+  fixedMatrix<N, N> Z;
+  for (unsigned long i = 0; i < N; i++)
+    Z.mMat[i * N + i] = 1;
+  return Z;
+} // fixedMatrix<N, N> matrixFixedIdentity(void) ---------------------------------------------------
+
+/**
+ * @brief matrixInverse - Create an inverse copy of the input square fixed matrix.
+ * @param X             - The square fixed matrix to be inversed.
+ * @return              - The inversed fixed matrix.
+ */
+template <unsigned long N>
+fixedMatrix<N, N> matrixInverse(const fixedMatrix<N, N> & X) {
+  fixedMatrix<N, N> Z;
+  fixedMatrixSquare<N>::inverse(X.mMat, Z.mMat);
+  return Z;
+} // fixedMatrix<N, N> matrixInverse(const fixedMatrix<N, N> & X) ----------------------------------
+
+/**
+ * @brief matrixTranspose - Create a transpose copy of the input fixed matrix.
+ * @param X               - The fixed matrix to be transposed.
+ * @return                - The transposed fixed matrix.
+ */
+template <unsigned long R, unsigned long C>
+fixedMatrix<C, R> matrixTranspose(const fixedMatrix<R, C> & X) {
+  fixedMatrix<C, R> Z;
+  for (unsigned long i = 0; i < R; i++) {
+    for (unsigned long j = 0; j < C; j++)
+      Z.mMat[j * R + i] = X.mMat[i * C + j];
+  }
+  return Z;
+} // fixedMatrix<C, R> matrixTranspose(const fixedMatrix<R, C> & X) --------------------------------
+
+#endif // MATRIXLIBRARYFIXED_H
@@ -0,0 +1,340 @@
+/*
+ * Copyright:   2021 Johnathon Leong
+ *
+ * License:     License under LGPL-3.0-or-later.
+ *              Please refer to https://www.gnu.org/licenses/lgpl-3.0.txt for more information on the
+ *              terms of LGPL-3.0 or relavent website for a later version of the LGPL.
+ *
+ * Disclaimer:  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY
+ *              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ *              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ *              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ *              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *              WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author:      Johnathon Leong
+ *
+ * Note:        Single precision matrices of matrixlibrary. A "matrixFloat" stores its elements as
+ *              "float", halving the memory and the bandwidth of a "matrix" of the same size, with
+ *              the same alignment and leading dimension padding. The multiplication runs on the
+ *              shared blocked GEMM of matrixlibrarykernels with the single precision micro kernel
+ *              of the active SIMD kernel set. Reductions accumulate in double precision. The CSV
+ *              I/O and the decompositions are computed through the double precision functions,
+ *              and their results are rounded to single precision.
+ *              To be used together with matrixlibrary.
+ *
+ * Version:     1.0.2
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Moving a matrix whose memory comes from a "matrixAllocatorScope" into a matrix
+ *                 whose memory comes from an enclosing scope, or from no scope at all, now copies
+ *                 the elements, as for "matrix".
+ *
+ * Version:     1.0.1
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. "matrixTranspose()" now transposes tile by tile through
+ *                 "matrixKernelsTranspose()".
+ *
+ * Version:     1.0.0
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Implemented first release version of matrixlibraryfloat.
+ */
+
+#ifndef MATRIXLIBRARYFLOAT_H
+#define MATRIXLIBRARYFLOAT_H
+
+#include "matrixlibrary.h"
+
+class matrixFloat
+{
+public:
+  /**
+   * @brief matrixFloat - Default constructor.
+   */
+  explicit matrixFloat();
+
+  /**
+   * @brief matrixFloat - Overloaded constructor to instantiate a square matrix.
+   * @param size        - Size of the square matrix.
+   */
+  explicit matrixFloat(unsigned long size);
+
+  /**
+   * @brief matrixFloat - Overloaded constructor to instantiate a mxn matrix.
+   * @param rowSize     - Row size of the matrix.
+   * @param colSize     - Column size of the matrix.
+   */
+  explicit matrixFloat(unsigned long rowSize, unsigned long colSize);
+
+  /**
+   * @brief matrixFloat - Overloaded constructor to instantiate a mxn matrix without initialising
+   *                      the elements. To be used when every element is to be overwritten right
+   *                      after.
+   * @param rowSize     - Row size of the matrix.
+   * @param colSize     - Column size of the matrix.
+   */
+  explicit matrixFloat(unsigned long rowSize, unsigned long colSize, matrixUninitializedTag);
+
+  /**
+   * @brief matrixFloat - Overloaded constructor to convert a double precision matrix. Every
+   *                      element is rounded to single precision.
+   * @param X           - Matrix to be converted.
+   */
+  explicit matrixFloat(const matrix & X);
+
+  /**
+   * @brief matrixFloat - Overloaded copy constructor.
+   * @param X           - Matrix to be copied.
+   */
+  matrixFloat(const matrixFloat & X);
+
+  /**
+   * @brief matrixFloat - Overloaded move constructor. Takes over the memory of the input matrix
+   *                      without copying, leaving the input matrix empty. Memory from a scope
+   *                      deeper than the active one is copied instead.
+   * @param X           - Matrix to be moved.
+   */
+  matrixFloat(matrixFloat && X) noexcept;
+
+  /**
+   * @brief ~matrixFloat - Default destructor
+   */
+  virtual ~matrixFloat();
+
+  /**
+   * @brief operator = - Overloaded operator to assign a matrix to itself.
+   * @param X          - The matrix to copy from.
+   * @return           - Returns the matrix reference of itself.
+   */
+  matrixFloat& operator=(const matrixFloat & X);
+
+  /**
+   * @brief operator = - Overloaded operator to move a matrix into itself. The memory of the input
+   *                     matrix is taken over without copying, leaving the input matrix empty.
+   *                     Memory from an arena scope is copied instead, unless the memory of
+   *                     the matrix comes from the same scope or a deeper one.
+   * @param X          - The matrix to move from.
+   * @return           - Returns the matrix reference of itself.
+   */
+  matrixFloat& operator=(matrixFloat && X) noexcept;
+
+  /**
+   * @brief operator() - Return the value stored in the element defined by the input arguments.
+   * @param rowIndex   - Row index of the element.
+   * @param colIndex   - Column index of the element.
+   * @return           - Returns the stored value.
+   */
+  float& operator()(unsigned long rowIndex, unsigned long colIndex) const;
+
+  /**
+   * @brief clear - Clears all the matrix elements to zero.
+   */
+  void clear(void);
+
+  /**
+   * @brief getColSize - Returns the column size of the matrix.
+   * @return           - Column size of the matrix.
+   */
+  unsigned long getColSize(void) const;
+
+  /**
+   * @brief getLd - Returns the leading dimension (row stride) of the matrix.
+   * @return      - Leading dimension of the matrix.
+   */
+  unsigned long getLd(void) const;
+
+  /**
+   * @brief getRowSize - Returns the row size of the matrix.
+   * @return           - Row size of the matrix.
+   */
+  unsigned long getRowSize(void) const;
+
+  /**
+   * @brief getSize - Returns the size of the matrix.
+   * @return        - Size of the matrix.
+   */
+  unsigned long getSize(void) const;
+
+  /**
+   * @brief resizeClear - Resize the matrix to a new dimension with all existing elements cleared.
+   * @param row         - Row size of the resize matrix.
+   * @param col         - Column size of the resize matrix.
+   */
+  void resizeClear(unsigned long row, unsigned long col);
+
+  /**
+   * @brief mMat - "float" type pointer to the memory allocated for the matrix.
+   *               IMPORTANT NOTE: THIS ATTRIBUTE IS NOT "PRIVATE" FOR EFFICIENCY. DO NOT ACCESS AND
+   *                               CHANGE THE CONTENT OF THE POINTER. ANY CHANGES MAY RESULT IN
+   *                               CATASTROPHIC FAILURE OF THE MATRIX LIBRARY AND/OR THE SOFTWARE
+   *                               USING IT.
+   */
+  float * mMat;
+
+private:
+  /**
+   * @brief mRow - To store the row size of the matrix.
+   */
+  unsigned long mRow;
+
+  /**
+   * @brief mCol - To store the column size of the matrix.
+   */
+  unsigned long mCol;
+
+  /**
+   * @brief mSize - To store the size of the matrix.
+   */
+  unsigned long mSize;
+
+  /**
+   * @brief mLd - To store the leading dimension (row stride) of the matrix.
+   */
+  unsigned long mLd;
+
+  /**
+   * @brief allocate - Allocates the memory of a mxn matrix.
+   * @param row      - Row size of the matrix.
+   * @param col      - Column size of the matrix.
+   * @param zero     - 1 to clear the elements to zero, 0 to leave them uninitialised.
+   */
+  void allocate(unsigned long row, unsigned long col, unsigned char zero);
+
+  /**
+   * @brief copyOutside - Copies a matrix into itself, reusing its memory when the dimension is the
+   *                      same, otherwise allocating it outside of any arena scope.
+   * @param X           - The matrix to copy from.
+   */
+  void copyOutside(const matrixFloat & X);
+
+  /**
+   * @brief release - Free up the memory allocated for the matrix elements.
+   */
+  void release(void);
+};
+
+/**
+ * @brief operator + - Overloading of the addition operatior between two matrices.
+ * @param X          - Main matrix for addition.
+ * @param Y          - Addition matrix.
+ * @return           - The resultant matrix.
+ */
+matrixFloat operator+(const matrixFloat & X, const matrixFloat & Y);
+
+/**
+ * @brief operator - - Overloading of the subtraction operatior between two matrices.
+ * @param X          - Main matrix for subtraction.
+ * @param Y          - Subtraction matrix.
+ * @return           - The resultant matrix.
+ */
+matrixFloat operator-(const matrixFloat & X, const matrixFloat & Y);
+
+/**
+ * @brief operator * - Overloading of the multiplication operatior between a matrix and a float type
+ *                     value.
+ * @param X          - Main matrix for multiplication.
+ * @param Y          - Multiplication value.
+ * @return           - The resultant matrix.
+ */
+matrixFloat operator*(const matrixFloat & X, const float & Y);
+
+/**
+ * @brief operator * - Overloading of the multiplication operatior between two matrices.
+ * @param X          - Main matrix for multiplication.
+ * @param Y          - Multiplication matrix.
+ * @return           - The resultant matrix.
+ */
+matrixFloat operator*(const matrixFloat & X, const matrixFloat & Y);
+
+/**
+ * @brief operator / - Overloading of the division operatior between a matrix and a float type
+ *                     value.
+ * @param X          - Main matrix for division.
+ * @param Y          - Division value.
+ * @return           - The resultant matrix.
+ */
+matrixFloat operator/(const matrixFloat & X, const float & Y);
+
+/**
+ * @brief operator += - Overloading of the addition equal operatior between two matrices.
+ * @param X           - Main matrix for addition, where the result is stored.
+ * @param Y           - Addition matrix.
+ */
+void operator+=(matrixFloat & X, const matrixFloat & Y);
+
+/**
+ * @brief operator -= - Overloading of the subtraction equal operatior between two matrices.
+ * @param X           - Main matrix for subtraction, where the result is stored.
+ * @param Y           - Subtraction matrix.
+ */
+void operator-=(matrixFloat & X, const matrixFloat & Y);
+
+/**
+ * @brief matrixCsvReadFloat - Read a CSV file into a single precision matrix.
+ * @param filename           - Filename, including the path, of the CSV file.
+ * @return                   - The matrix data read from the CSV file.
+ */
+matrixFloat matrixCsvReadFloat(const char * filename);
+
+/**
+ * @brief matrixCsvWrite - Write a single precision matrix to a CSV file.
+ * @param filename       - Filename, including the path, of the CSV file
+ * @param X              - The matrix data to be written.
+ */
+void matrixCsvWrite(const char * filename, const matrixFloat & X);
+
+/**
+ * @brief matrixDecompositionLU - Performs the LU decomposition of a single precision matrix. The
+ *                                decomposition is computed in double precision.
+ * @param X                     - The matrix to be decomposed.
+ * @param L                     - The resultant lower triangular matrix.
+ * @param U                     - The resultant upper triangular matrix.
+ * @return                      - The permutation matrix.
+ */
+matrixFloat matrixDecompositionLU(const matrixFloat & X, matrixFloat & L, matrixFloat & U);
+
+/**
+ * @brief matrixDecompositionQR - Performs the QR decomposition of a single precision matrix. The
+ *                                decomposition is computed in double precision.
+ * @param X                     - The matrix to be decomposed.
+ * @param Q                     - The resultant orthogonal matrix.
+ * @param R                     - The resultant upper triangular matrix.
+ */
+void matrixDecompositionQR(const matrixFloat & X, matrixFloat & Q, matrixFloat & R);
+
+/**
+ * @brief matrixFloatConvert - Converts a single precision matrix into a double precision matrix.
+ * @param X                  - Matrix to be converted.
+ * @return                   - The double precision matrix.
+ */
+matrix matrixFloatConvert(const matrixFloat & X);
+
+/**
+ * @brief matrixMathsSum - Computes the sum for each of the vector of the matrix, accumulating in
+ *                         double precision. The vector direction is defined by the input argument.
+ * @param X              - The matrix whose sum is to be computed.
+ * @param direction      - Defines the direction of the vector;
+ *                         0 -> column vector
+ *                         1 -> row vector
+ * @return               - The resultant sum vector matrix.
+ */
+matrixFloat matrixMathsSum(const matrixFloat & X, unsigned char direction = 0);
+
+/**
+ * @brief matrixMathsVectorSum - Computes the sum of the input vector, accumulating in double
+ *                               precision. The input vector must be a [N x 1] matrix.
+ * @param X                    - The vector whose sum is to be computed.
+ * @return                     - The computed sum value.
+ */
+double matrixMathsVectorSum(const matrixFloat & X);
+
+/**
+ * @brief matrixTranspose - Transpose the input matrix.
+ * @param X               - The matrix to be transposed.
+ * @return                - The transposed matrix.
+ */
+matrixFloat matrixTranspose(const matrixFloat & X);
+
+#endif // MATRIXLIBRARYFLOAT_H
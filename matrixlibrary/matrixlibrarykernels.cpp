@@ -0,0 +1,1206 @@
+/*
+ * Copyright:   2021 Johnathon Leong
+ *
+ * License:     License under LGPL-3.0-or-later.
+ *              Please refer to https://www.gnu.org/licenses/lgpl-3.0.txt for more information on the
+ *              terms of LGPL-3.0 or relavent website for a later version of the LGPL.
+ *
+ * Disclaimer:  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY
+ *              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ *              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ *              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ *              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *              WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author:      Johnathon Leong
+ *
+ * Note:        Low level computational kernels used internally by matrixlibrary. The kernels work on
+ *              raw row-major buffers so that they can be shared by the matrix class and any of the
+ *              other modules.
+ *
+ * Version:     1.0.11
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the right-side triangular solve "matrixKernelsTrsmRight()".
+ *
+ * Version:     1.0.10
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. "matrixKernelsTrsm()" is now left-looking, and its diagonal blocks are solved in
+ *                 chunks of MATRIXKERNELS_TRSM_CHUNK columns through the SIMD vector-matrix kernel.
+ *
+ * Version:     1.0.9
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the blocked triangular solve "matrixKernelsTrsm()", whose off-diagonal
+ *                 updates run on "matrixKernelsGemm()".
+ *
+ * Version:     1.0.8
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the tiled "matrixKernelsTranspose()" kernels, parallel above
+ *                 MATRIXKERNELS_TRANSPOSE_PARALLEL elements, and the in-place
+ *                 "matrixKernelsTransposeSquare()".
+ *
+ * Version:     1.0.7
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the symmetric rank-k update "matrixKernelsSyrk()".
+ *
+ * Version:     1.0.6
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the matrix-vector "matrixKernelsGemv()" and vector-matrix
+ *                 "matrixKernelsGevm()" kernels, which "matrixKernelsGemm()" now uses for products
+ *                 with a single row or column.
+ *
+ * Version:     1.0.5
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Products of at least MATRIXKERNELS_GEMM_PARALLEL multiply-adds are split into
+ *                 2D tiles of C run on the thread pool of matrixlibrarythreads.
+ *
+ * Version:     1.0.4
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The GEMM blocking, packing and macro kernel are now templates shared by the
+ *                 scalar types.
+ *              2. Added the single precision "matrixKernelsGemm()" and "matrixKernelsCopy()".
+ *
+ * Version:     1.0.3
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The GEMM packing buffers are now allocated through matrixlibraryallocator.
+ *
+ * Version:     1.0.2
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the strided "matrixKernelsApply()", "matrixKernelsApplyScalar()" and
+ *                 "matrixKernelsCopy()" kernels.
+ *
+ * Version:     1.0.1
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The GEMM micro kernel and its register block size are now taken from the runtime
+ *                 dispatched kernel table of matrixlibrarysimd.
+ *
+ * Version:     1.0.0
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Implemented first release version of matrixlibrarykernels.
+ */
+
+#include "matrixlibrarykernels.h"
+#include "matrixlibraryallocator.h"
+#include "matrixlibrarysimd.h"
+#include "matrixlibrarythreads.h"
+#include <string.h>
+
+/**
+ * @brief matrixKernelsGemmTiles - Arguments of a parallel product shared by the tiles of C. The
+ *                                 members up to ldc are the arguments of
+ *                                 "matrixKernelsGemmDriver()" for the whole product.
+ */
+template <typename T>
+struct matrixKernelsGemmTiles {
+  unsigned long MR;
+  unsigned long NR;
+  void (*micro)(unsigned long, T, const T *, const T *, T, T *, unsigned long);
+  unsigned long m;
+  unsigned long n;
+  unsigned long k;
+  T alpha;
+  const T * A;
+  unsigned long rsA;
+  unsigned long csA;
+  const T * B;
+  unsigned long rsB;
+  unsigned long csB;
+  T beta;
+  T * C;
+  unsigned long ldc;
+
+  /**
+   * @brief tileM - Row size of the tiles.
+   */
+  unsigned long tileM;
+
+  /**
+   * @brief tileN - Column size of the tiles.
+   */
+  unsigned long tileN;
+
+  /**
+   * @brief tilesN - Number of tiles along the columns of C.
+   */
+  unsigned long tilesN;
+};
+
+/**
+ * @brief matrixKernelsGemvBlocks - Arguments of a parallel matrix-vector product shared by its
+ *                                  blocks. The members up to incy are the arguments of
+ *                                  "matrixKernelsGemv()" or "matrixKernelsGevm()", x being
+ *                                  contiguous for the former.
+ */
+struct matrixKernelsGemvBlocks {
+  unsigned long m;
+  unsigned long n;
+  double alpha;
+  const double * A;
+  unsigned long lda;
+  const double * x;
+  unsigned long incx;
+  double beta;
+  double * y;
+  unsigned long incy;
+
+  /**
+   * @brief block - Number of rows (GEMV) or columns (GEVM) of a block.
+   */
+  unsigned long block;
+};
+
+/**
+ * @brief matrixKernelsTransposeBands - Arguments of a parallel transpose shared by its bands. The
+ *                                      members up to ldz are the arguments of
+ *                                      "matrixKernelsTransposeBlock()" for the whole transpose.
+ */
+template <typename T>
+struct matrixKernelsTransposeBands {
+  unsigned long NB;
+  void (*micro)(const T *, unsigned long, T *, unsigned long);
+  unsigned long m;
+  unsigned long n;
+  const T * X;
+  unsigned long ldx;
+  T * Z;
+  unsigned long ldz;
+
+  /**
+   * @brief band - Number of rows (or columns if byRows is false) of X of a band.
+   */
+  unsigned long band;
+
+  /**
+   * @brief byRows - Whether the bands are bands of rows or of columns of X.
+   */
+  bool byRows;
+};
+
+/**
+ * @brief matrixKernelsTransposeSquares - Arguments of a parallel in-place transpose shared by its
+ *                                        bands of tiles.
+ */
+struct matrixKernelsTransposeSquares {
+  unsigned long n;
+  double * X;
+  unsigned long ldx;
+};
+
+/**
+ * @brief matrixKernelsTrsmBands - Arguments of a parallel triangular solve shared by its bands of
+ *                                 right-hand sides. The members up to ldb are the arguments of
+ *                                 "matrixKernelsTrsmBlock()" for the whole solve.
+ */
+struct matrixKernelsTrsmBands {
+  bool upper;
+  bool unit;
+  unsigned long m;
+  unsigned long n;
+  const double * T;
+  unsigned long rsT;
+  unsigned long csT;
+  double * B;
+  unsigned long ldb;
+
+  /**
+   * @brief band - Number of columns of B of a band.
+   */
+  unsigned long band;
+};
+
+/// ================================================================================================
+/// STATIC FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief matrixKernelsGemmScale - Scales a row-major block in place, C = beta * C. When beta is
+ *                                 zero, the block is cleared without being read.
+ * @param m                      - Row size of C.
+ * @param n                      - Column size of C.
+ * @param beta                   - Scaling of C.
+ * @param C                      - Pointer to the first element of C.
+ * @param ldc                    - Leading dimension of C.
+ */
+template <typename T>
+static void matrixKernelsGemmScale(unsigned long m, unsigned long n, T beta, T * C,
+                                   unsigned long ldc) {
+  if (beta == T(1))
+    return;
+  for (unsigned long i = 0; i < m; i++) {
+    T * c = C + i * ldc;
+    if (beta == T(0)) {
+      for (unsigned long j = 0; j < n; j++)
+        c[j] = T(0);
+    }
+    else {
+      for (unsigned long j = 0; j < n; j++)
+        c[j] *= beta;
+    }
+  }
+} // void matrixKernelsGemmScale(unsigned long m, unsigned long n, T beta, T * C, unsigned long ldc)
+
+/**
+ * @brief matrixKernelsGemmSmall - Unpacked product for tiny operands. The loop order keeps the
+ *                                 innermost access to B and C on unit stride when B is row-major.
+ *                                 The arguments are the same as "matrixKernelsGemm()".
+ */
+template <typename T>
+static void matrixKernelsGemmSmall(unsigned long m, unsigned long n, unsigned long k, T alpha,
+                                   const T * A, unsigned long rsA, unsigned long csA,
+                                   const T * B, unsigned long rsB, unsigned long csB,
+                                   T beta, T * C, unsigned long ldc) {
+  matrixKernelsGemmScale(m, n, beta, C, ldc);
+  for (unsigned long i = 0; i < m; i++) {
+    T * c = C + i * ldc;
+    for (unsigned long p = 0; p < k; p++) {
+      T a = alpha * A[i * rsA + p * csA];
+      const T * b = B + p * rsB;
+      if (csB == 1) {
+        for (unsigned long j = 0; j < n; j++)
+          c[j] += a * b[j];
+      }
+      else {
+        for (unsigned long j = 0; j < n; j++)
+          c[j] += a * b[j * csB];
+      }
+    }
+  }
+} // void matrixKernelsGemmSmall(unsigned long m, unsigned long n, unsigned long k, T alpha, const T * A, unsigned long rsA, unsigned long csA, const T * B, unsigned long rsB, unsigned long csB, T beta, T * C, unsigned long ldc)
+
+/**
+ * @brief matrixKernelsGemmPackA - Packs a (mc x kc) block of A into consecutive micro panels of MR
+ *                                 rows. Each micro panel is stored column by column so that the
+ *                                 micro kernel reads it with unit stride. Rows beyond mc are padded
+ *                                 with zeros.
+ * @param MR                     - Row size of the micro panels.
+ * @param mc                     - Row size of the block.
+ * @param kc                     - Column size of the block.
+ * @param A                      - Pointer to the first element of the block.
+ * @param rsA                    - Row stride of A.
+ * @param csA                    - Column stride of A.
+ * @param Ap                     - Packing buffer of at least roundup(mc, MR) * kc elements.
+ */
+template <typename T>
+static void matrixKernelsGemmPackA(unsigned long MR, unsigned long mc, unsigned long kc,
+                                   const T * A, unsigned long rsA, unsigned long csA,
+                                   T * Ap) {
+  for (unsigned long ir = 0; ir < mc; ir += MR) {
+    unsigned long mr = (mc - ir) < MR ? (mc - ir) : MR;
+    const T * a = A + ir * rsA;
+    for (unsigned long p = 0; p < kc; p++) {
+      unsigned long i = 0;
+      for (; i < mr; i++)
+        Ap[i] = a[i * rsA + p * csA];
+      for (; i < MR; i++)
+        Ap[i] = T(0);
+      Ap += MR;
+    }
+  }
+} // void matrixKernelsGemmPackA(unsigned long MR, unsigned long mc, unsigned long kc, const T * A, unsigned long rsA, unsigned long csA, T * Ap)
+
+/**
+ * @brief matrixKernelsGemmPackB - Packs a (kc x nc) block of B into consecutive micro panels of NR
+ *                                 columns. Each micro panel is stored row by row so that the micro
+ *                                 kernel reads it with unit stride. Columns beyond nc are padded
+ *                                 with zeros.
+ * @param NR                     - Column size of the micro panels.
+ * @param kc                     - Row size of the block.
+ * @param nc                     - Column size of the block.
+ * @param B                      - Pointer to the first element of the block.
+ * @param rsB                    - Row stride of B.
+ * @param csB                    - Column stride of B.
+ * @param Bp                     - Packing buffer of at least kc * roundup(nc, NR) elements.
+ */
+template <typename T>
+static void matrixKernelsGemmPackB(unsigned long NR, unsigned long kc, unsigned long nc,
+                                   const T * B, unsigned long rsB, unsigned long csB,
+                                   T * Bp) {
+  for (unsigned long jr = 0; jr < nc; jr += NR) {
+    unsigned long nr = (nc - jr) < NR ? (nc - jr) : NR;
+    const T * b = B + jr * csB;
+    for (unsigned long p = 0; p < kc; p++) {
+      const T * bp = b + p * rsB;
+      unsigned long j = 0;
+      if (csB == 1) {
+        for (; j < nr; j++)
+          Bp[j] = bp[j];
+      }
+      else {
+        for (; j < nr; j++)
+          Bp[j] = bp[j * csB];
+      }
+      for (; j < NR; j++)
+        Bp[j] = T(0);
+      Bp += NR;
+    }
+  }
+} // void matrixKernelsGemmPackB(unsigned long NR, unsigned long kc, unsigned long nc, const T * B, unsigned long rsB, unsigned long csB, T * Bp)
+
+/**
+ * @brief matrixKernelsGemmMacro - Multiplies a packed (mc x kc) block of A with a packed (kc x nc)
+ *                                 block of B by sweeping the micro kernel over the block of C.
+ *                                 Partial tiles on the bottom and right edges are computed into a
+ *                                 local tile and then copied into C.
+ * @param MR                     - Row size of the micro kernel.
+ * @param NR                     - Column size of the micro kernel.
+ * @param micro                  - The micro kernel.
+ * @param mc                     - Row size of the block of C.
+ * @param nc                     - Column size of the block of C.
+ * @param kc                     - Inner size of the packed blocks.
+ * @param alpha                  - Scaling of the product.
+ * @param Ap                     - Packed block of A.
+ * @param Bp                     - Packed block of B.
+ * @param beta                   - Scaling of C. C is not read when beta is zero.
+ * @param C                      - Pointer to the first element of the block of C.
+ * @param ldc                    - Leading dimension of C.
+ */
+template <typename T>
+static void matrixKernelsGemmMacro(unsigned long MR, unsigned long NR,
+                                   void (*micro)(unsigned long, T, const T *, const T *, T, T *,
+                                                 unsigned long),
+                                   unsigned long mc, unsigned long nc, unsigned long kc, T alpha,
+                                   const T * Ap, const T * Bp, T beta, T * C, unsigned long ldc) {
+  T tile[MATRIXSIMD_GEMM_MR_MAX * MATRIXSIMD_GEMM_NR_MAX];
+
+  for (unsigned long jr = 0; jr < nc; jr += NR) {
+    unsigned long nr = (nc - jr) < NR ? (nc - jr) : NR;
+    const T * b = Bp + jr * kc;
+
+    for (unsigned long ir = 0; ir < mc; ir += MR) {
+      unsigned long mr = (mc - ir) < MR ? (mc - ir) : MR;
+      const T * a = Ap + ir * kc;
+      T * c = C + ir * ldc + jr;
+
+      if ((mr == MR) && (nr == NR)) {
+        micro(kc, alpha, a, b, beta, c, ldc);
+      }
+      else {
+        micro(kc, alpha, a, b, T(0), tile, NR);
+        for (unsigned long i = 0; i < mr; i++) {
+          for (unsigned long j = 0; j < nr; j++) {
+            if (beta == T(0))
+              c[i * ldc + j] = tile[i * NR + j];
+            else
+              c[i * ldc + j] = beta * c[i * ldc + j] + tile[i * NR + j];
+          }
+        }
+      }
+    }
+  }
+} // void matrixKernelsGemmMacro(unsigned long MR, unsigned long NR, void (*micro)(unsigned long, T, const T *, const T *, T, T *, unsigned long), unsigned long mc, unsigned long nc, unsigned long kc, T alpha, const T * Ap, const T * Bp, T beta, T * C, unsigned long ldc)
+
+/**
+ * @brief matrixKernelsGemmDriver - Blocked GEMM shared by every scalar type. The operands are packed
+ *                                  block by block and multiplied by the given micro kernel. The
+ *                                  remaining arguments are the same as "matrixKernelsGemm()".
+ * @param MR                      - Row size of the micro kernel.
+ * @param NR                      - Column size of the micro kernel.
+ * @param micro                   - The micro kernel.
+ */
+template <typename T>
+static void matrixKernelsGemmDriver(unsigned long MR, unsigned long NR,
+                                    void (*micro)(unsigned long, T, const T *, const T *, T, T *,
+                                                  unsigned long),
+                                    unsigned long m, unsigned long n, unsigned long k, T alpha,
+                                    const T * A, unsigned long rsA, unsigned long csA,
+                                    const T * B, unsigned long rsB, unsigned long csB,
+                                    T beta, T * C, unsigned long ldc) {
+  if ((m == 0) || (n == 0))
+    return;
+
+  if ((k == 0) || (alpha == T(0))) {
+    matrixKernelsGemmScale(m, n, beta, C, ldc);
+    return;
+  }
+
+  if (m * n * k < MATRIXKERNELS_GEMM_SMALL) {
+    matrixKernelsGemmSmall(m, n, k, alpha, A, rsA, csA, B, rsB, csB, beta, C, ldc);
+    return;
+  }
+
+  // size the packing buffers to the largest blocks actually used by this product
+  unsigned long mcMax = m < MATRIXKERNELS_GEMM_MC ? m : MATRIXKERNELS_GEMM_MC;
+  unsigned long ncMax = n < MATRIXKERNELS_GEMM_NC ? n : MATRIXKERNELS_GEMM_NC;
+  unsigned long kcMax = k < MATRIXKERNELS_GEMM_KC ? k : MATRIXKERNELS_GEMM_KC;
+  mcMax = (mcMax + MR - 1) / MR * MR;
+  ncMax = (ncMax + NR - 1) / NR * NR;
+
+  T * Ap = (T *)matrixAllocatorMalloc(sizeof(T) * mcMax * kcMax);
+  T * Bp = (T *)matrixAllocatorMalloc(sizeof(T) * kcMax * ncMax);
+
+  for (unsigned long jc = 0; jc < n; jc += MATRIXKERNELS_GEMM_NC) {
+    unsigned long nc = (n - jc) < MATRIXKERNELS_GEMM_NC ? (n - jc) : MATRIXKERNELS_GEMM_NC;
+
+    for (unsigned long pc = 0; pc < k; pc += MATRIXKERNELS_GEMM_KC) {
+      unsigned long kc = (k - pc) < MATRIXKERNELS_GEMM_KC ? (k - pc) : MATRIXKERNELS_GEMM_KC;
+      // beta only applies to the first rank-kc update, the rest accumulate onto C
+      T betaBlock = (pc == 0) ? beta : T(1);
+
+      matrixKernelsGemmPackB(NR, kc, nc, B + pc * rsB + jc * csB, rsB, csB, Bp);
+
+      for (unsigned long ic = 0; ic < m; ic += MATRIXKERNELS_GEMM_MC) {
+        unsigned long mc = (m - ic) < MATRIXKERNELS_GEMM_MC ? (m - ic) : MATRIXKERNELS_GEMM_MC;
+
+        matrixKernelsGemmPackA(MR, mc, kc, A + ic * rsA + pc * csA, rsA, csA, Ap);
+        matrixKernelsGemmMacro(MR, NR, micro, mc, nc, kc, alpha, Ap, Bp, betaBlock,
+                               C + ic * ldc + jc, ldc);
+      }
+    }
+  }
+
+  matrixAllocatorFree((double *)Bp);
+  matrixAllocatorFree((double *)Ap);
+} // void matrixKernelsGemmDriver(unsigned long MR, unsigned long NR, void (*micro)(unsigned long, T, const T *, const T *, T, T *, unsigned long), unsigned long m, unsigned long n, unsigned long k, T alpha, const T * A, unsigned long rsA, unsigned long csA, const T * B, unsigned long rsB, unsigned long csB, T beta, T * C, unsigned long ldc)
+
+/**
+ * @brief matrixKernelsGemmTile - Computes a tile of C of a parallel product. Every tile packs its
+ *                                own blocks, so that the tiles are independent of each other.
+ * @param context               - The matrixKernelsGemmTiles of the product.
+ * @param index                 - Index of the tile, in row-major order.
+ */
+template <typename T>
+static void matrixKernelsGemmTile(void * context, unsigned long index) {
+  const matrixKernelsGemmTiles<T> & t = *(const matrixKernelsGemmTiles<T> *)context;
+  unsigned long ic = index / t.tilesN * t.tileM;
+  unsigned long jc = index % t.tilesN * t.tileN;
+  unsigned long mc = (t.m - ic) < t.tileM ? (t.m - ic) : t.tileM;
+  unsigned long nc = (t.n - jc) < t.tileN ? (t.n - jc) : t.tileN;
+
+  matrixKernelsGemmDriver(t.MR, t.NR, t.micro, mc, nc, t.k, t.alpha, t.A + ic * t.rsA, t.rsA, t.csA,
+                          t.B + jc * t.csB, t.rsB, t.csB, t.beta, t.C + ic * t.ldc + jc, t.ldc);
+} // void matrixKernelsGemmTile(void * context, unsigned long index) -------------------------------
+
+/**
+ * @brief matrixKernelsGemmParallel - Splits a product into 2D tiles of C run on the thread pool.
+ *                                    Products below MATRIXKERNELS_GEMM_PARALLEL, or too narrow to
+ *                                    give more than one tile, run on the calling thread. The
+ *                                    arguments are the same as "matrixKernelsGemmDriver()".
+ */
+template <typename T>
+static void matrixKernelsGemmParallel(unsigned long MR, unsigned long NR,
+                                      void (*micro)(unsigned long, T, const T *, const T *, T, T *,
+                                                    unsigned long),
+                                      unsigned long m, unsigned long n, unsigned long k, T alpha,
+                                      const T * A, unsigned long rsA, unsigned long csA,
+                                      const T * B, unsigned long rsB, unsigned long csB,
+                                      T beta, T * C, unsigned long ldc) {
+  // the tiling below divides by the number of blocks of C, which is zero for an empty C
+  if ((m == 0) || (n == 0))
+    return;
+
+  if ((k == 0) || (alpha == T(0))) {
+    matrixKernelsGemmScale(m, n, beta, C, ldc);
+    return;
+  }
+
+  unsigned long threads = 1;
+  if ((m * n * k >= MATRIXKERNELS_GEMM_PARALLEL) && (alpha != T(0)))
+    threads = matrixThreadsGetCount();
+
+  // every tile packs its own blocks of A and B, whose cost is amortised over the columns and the
+  // rows of the tile respectively, so the larger side of the tiles is halved until there are a few
+  // tiles per thread for the pool to balance
+  unsigned long maxM = (m + MATRIXKERNELS_GEMM_MC - 1) / MATRIXKERNELS_GEMM_MC;
+  unsigned long maxN = (n + MATRIXKERNELS_GEMM_TILE_N - 1) / MATRIXKERNELS_GEMM_TILE_N;
+  unsigned long tilesM = 1;
+  unsigned long tilesN = 1;
+  while (tilesM * tilesN < MATRIXKERNELS_GEMM_TILES * threads) {
+    bool splitM = (m / tilesM >= n / tilesN) ? (tilesM < maxM) : (tilesN == maxN);
+    if (splitM && (tilesM < maxM))
+      tilesM = (2 * tilesM < maxM) ? 2 * tilesM : maxM;
+    else if (!splitM && (tilesN < maxN))
+      tilesN = (2 * tilesN < maxN) ? 2 * tilesN : maxN;
+    else
+      break;
+  }
+
+  // round the tiles to whole packed blocks of A and micro panels of B
+  unsigned long tileM = (maxM + tilesM - 1) / tilesM * MATRIXKERNELS_GEMM_MC;
+  unsigned long tileN = ((n + tilesN - 1) / tilesN + NR - 1) / NR * NR;
+  tilesM = (m + tileM - 1) / tileM;
+  tilesN = (n + tileN - 1) / tileN;
+
+  if ((threads == 1) || (tilesM * tilesN == 1)) {
+    matrixKernelsGemmDriver(MR, NR, micro, m, n, k, alpha, A, rsA, csA, B, rsB, csB, beta, C, ldc);
+    return;
+  }
+
+  matrixKernelsGemmTiles<T> t = {MR, NR, micro, m, n, k, alpha, A, rsA, csA, B, rsB, csB, beta, C,
+                                 ldc, tileM, tileN, tilesN};
+  matrixThreadsParallelFor(tilesM * tilesN, matrixKernelsGemmTile<T>, &t);
+} // void matrixKernelsGemmParallel(unsigned long MR, unsigned long NR, void (*micro)(unsigned long, T, const T *, const T *, T, T *, unsigned long), unsigned long m, unsigned long n, unsigned long k, T alpha, const T * A, unsigned long rsA, unsigned long csA, const T * B, unsigned long rsB, unsigned long csB, T beta, T * C, unsigned long ldc)
+
+/**
+ * @brief matrixKernelsGemvSplit - Splits a matrix-vector product into blocks for the thread pool.
+ * @param size                   - Number of rows (GEMV) or columns (GEVM) to be split.
+ * @param elements               - Number of elements of the matrix.
+ * @return                       - Size of the blocks, equal to size when the product should run
+ *                                 on the calling thread.
+ */
+static unsigned long matrixKernelsGemvSplit(unsigned long size, unsigned long elements) {
+  if (elements < MATRIXKERNELS_GEMV_PARALLEL)
+    return size;
+
+  unsigned long blocks = matrixThreadsGetCount() * MATRIXKERNELS_GEMM_TILES;
+  unsigned long block = (size + blocks - 1) / blocks;
+  block = (block + MATRIXKERNELS_GEMV_BLOCK - 1) / MATRIXKERNELS_GEMV_BLOCK;
+  block *= MATRIXKERNELS_GEMV_BLOCK;
+  return block < size ? block : size;
+} // unsigned long matrixKernelsGemvSplit(unsigned long size, unsigned long elements) --------------
+
+/**
+ * @brief matrixKernelsGemvBlock - Computes a block of rows of a parallel matrix-vector product.
+ * @param context                - The matrixKernelsGemvBlocks of the product.
+ * @param index                  - Index of the block.
+ */
+static void matrixKernelsGemvBlock(void * context, unsigned long index) {
+  const matrixKernelsGemvBlocks & t = *(const matrixKernelsGemvBlocks *)context;
+  unsigned long i = index * t.block;
+  unsigned long mb = (t.m - i) < t.block ? (t.m - i) : t.block;
+  matrixSimd().gemv(mb, t.n, t.alpha, t.A + i * t.lda, t.lda, t.x, t.beta, t.y + i * t.incy,
+                    t.incy);
+} // void matrixKernelsGemvBlock(void * context, unsigned long index) ------------------------------
+
+/**
+ * @brief matrixKernelsGevmBlock - Computes a block of columns of a parallel vector-matrix product.
+ * @param context                - The matrixKernelsGemvBlocks of the product.
+ * @param index                  - Index of the block.
+ */
+static void matrixKernelsGevmBlock(void * context, unsigned long index) {
+  const matrixKernelsGemvBlocks & t = *(const matrixKernelsGemvBlocks *)context;
+  unsigned long j = index * t.block;
+  unsigned long nb = (t.n - j) < t.block ? (t.n - j) : t.block;
+  matrixKernelsGemmScale(1, nb, t.beta, t.y + j, nb);
+  matrixSimd().gevm(t.m, nb, t.alpha, t.A + j, t.lda, t.x, t.incx, t.y + j);
+} // void matrixKernelsGevmBlock(void * context, unsigned long index) ------------------------------
+
+/**
+ * @brief matrixKernelsTransposeTile - Transposes a tile of at most MATRIXKERNELS_TRANSPOSE_TILE
+ *                                     square, Z = X^T. The whole blocks of the micro kernel are
+ *                                     transposed in registers and the edges element by element.
+ * @param NB                         - Block size of the micro kernel.
+ * @param micro                      - Micro kernel, or NULL to transpose element by element.
+ * @param m                          - Row size of X and column size of Z.
+ * @param n                          - Column size of X and row size of Z.
+ * @param X                          - Pointer to the first element of X.
+ * @param ldx                        - Leading dimension of X.
+ * @param Z                          - Pointer to the first element of Z.
+ * @param ldz                        - Leading dimension of Z.
+ */
+template <typename T>
+static void matrixKernelsTransposeTile(unsigned long NB,
+                                       void (*micro)(const T *, unsigned long, T *, unsigned long),
+                                       unsigned long m, unsigned long n, const T * X,
+                                       unsigned long ldx, T * Z, unsigned long ldz) {
+  unsigned long mb = 0;
+  unsigned long nb = 0;
+  if (micro) {
+    mb = m - m % NB;
+    nb = n - n % NB;
+    for (unsigned long i = 0; i < mb; i += NB)
+      for (unsigned long j = 0; j < nb; j += NB)
+        micro(X + i * ldx + j, ldx, Z + j * ldz + i, ldz);
+  }
+
+  for (unsigned long i = 0; i < mb; i++)
+    for (unsigned long j = nb; j < n; j++)
+      Z[j * ldz + i] = X[i * ldx + j];
+  for (unsigned long i = mb; i < m; i++)
+    for (unsigned long j = 0; j < n; j++)
+      Z[j * ldz + i] = X[i * ldx + j];
+} // void matrixKernelsTransposeTile(unsigned long NB, void (*micro)(const T *, unsigned long, T *, unsigned long), unsigned long m, unsigned long n, const T * X, unsigned long ldx, T * Z, unsigned long ldz)
+
+/**
+ * @brief matrixKernelsTransposeBlock - Transposes a block tile by tile, Z = X^T, so that the rows
+ *                                      read from X and written to Z by a tile stay in the L1
+ *                                      cache. The arguments are the same as
+ *                                      "matrixKernelsTransposeTile()", without the size limit.
+ */
+template <typename T>
+static void matrixKernelsTransposeBlock(unsigned long NB,
+                                        void (*micro)(const T *, unsigned long, T *, unsigned long),
+                                        unsigned long m, unsigned long n, const T * X,
+                                        unsigned long ldx, T * Z, unsigned long ldz) {
+  const unsigned long tile = MATRIXKERNELS_TRANSPOSE_TILE;
+  for (unsigned long ib = 0; ib < m; ib += tile) {
+    unsigned long mb = (m - ib) < tile ? (m - ib) : tile;
+    for (unsigned long jb = 0; jb < n; jb += tile) {
+      unsigned long nb = (n - jb) < tile ? (n - jb) : tile;
+      matrixKernelsTransposeTile(NB, micro, mb, nb, X + ib * ldx + jb, ldx, Z + jb * ldz + ib,
+                                 ldz);
+    }
+  }
+} // void matrixKernelsTransposeBlock(unsigned long NB, void (*micro)(const T *, unsigned long, T *, unsigned long), unsigned long m, unsigned long n, const T * X, unsigned long ldx, T * Z, unsigned long ldz)
+
+/**
+ * @brief matrixKernelsTransposeBand - Transposes a band of a parallel transpose.
+ * @param context                    - The matrixKernelsTransposeBands of the transpose.
+ * @param index                      - Index of the band.
+ */
+template <typename T>
+static void matrixKernelsTransposeBand(void * context, unsigned long index) {
+  const matrixKernelsTransposeBands<T> & t = *(const matrixKernelsTransposeBands<T> *)context;
+  unsigned long b = index * t.band;
+  if (t.byRows) {
+    unsigned long mb = (t.m - b) < t.band ? (t.m - b) : t.band;
+    matrixKernelsTransposeBlock(t.NB, t.micro, mb, t.n, t.X + b * t.ldx, t.ldx, t.Z + b, t.ldz);
+  } else {
+    unsigned long nb = (t.n - b) < t.band ? (t.n - b) : t.band;
+    matrixKernelsTransposeBlock(t.NB, t.micro, t.m, nb, t.X + b, t.ldx, t.Z + b * t.ldz, t.ldz);
+  }
+} // void matrixKernelsTransposeBand(void * context, unsigned long index) --------------------------
+
+/**
+ * @brief matrixKernelsTransposeParallel - Splits a transpose into bands along the larger side of X
+ *                                         run on the thread pool. Transposes below
+ *                                         MATRIXKERNELS_TRANSPOSE_PARALLEL elements run on the
+ *                                         calling thread. The arguments are the same as
+ *                                         "matrixKernelsTransposeBlock()".
+ */
+template <typename T>
+static void matrixKernelsTransposeParallel(unsigned long NB,
+                                           void (*micro)(const T *, unsigned long, T *,
+                                                         unsigned long),
+                                           unsigned long m, unsigned long n, const T * X,
+                                           unsigned long ldx, T * Z, unsigned long ldz) {
+  if ((m == 0) || (n == 0))
+    return;
+
+  // bands are whole tiles wide, so that no two threads write to the same tile of Z
+  const unsigned long tile = MATRIXKERNELS_TRANSPOSE_TILE;
+  bool byRows = m >= n;
+  unsigned long size = byRows ? m : n;
+  unsigned long band = size;
+  if (m * n >= MATRIXKERNELS_TRANSPOSE_PARALLEL) {
+    unsigned long bands = matrixThreadsGetCount() * MATRIXKERNELS_GEMM_TILES;
+    band = ((size + bands - 1) / bands + tile - 1) / tile * tile;
+  }
+
+  if (band >= size) {
+    matrixKernelsTransposeBlock(NB, micro, m, n, X, ldx, Z, ldz);
+    return;
+  }
+
+  matrixKernelsTransposeBands<T> t = {NB, micro, m, n, X, ldx, Z, ldz, band, byRows};
+  matrixThreadsParallelFor((size + band - 1) / band, matrixKernelsTransposeBand<T>, &t);
+} // void matrixKernelsTransposeParallel(unsigned long NB, void (*micro)(const T *, unsigned long, T *, unsigned long), unsigned long m, unsigned long n, const T * X, unsigned long ldx, T * Z, unsigned long ldz)
+
+/**
+ * @brief matrixKernelsTransposeSquareBand - Transposes in place the band of tile row ib of a
+ *                                           square block, that is the tiles right of and on the
+ *                                           diagonal, swapped with the tiles below the diagonal.
+ *                                           The bands of different tile rows touch disjoint
+ *                                           tiles. Each pair of tiles goes through a buffer on
+ *                                           the stack.
+ * @param context                          - The matrixKernelsTransposeSquares of the transpose.
+ * @param index                            - Index of the tile row.
+ */
+static void matrixKernelsTransposeSquareBand(void * context, unsigned long index) {
+  const matrixKernelsTransposeSquares & t = *(const matrixKernelsTransposeSquares *)context;
+  const matrixSimdKernels & simd = matrixSimd();
+  const unsigned long tile = MATRIXKERNELS_TRANSPOSE_TILE;
+  double buffer[MATRIXKERNELS_TRANSPOSE_TILE * MATRIXKERNELS_TRANSPOSE_TILE];
+
+  unsigned long ib = index * tile;
+  unsigned long mb = (t.n - ib) < tile ? (t.n - ib) : tile;
+  for (unsigned long jb = ib; jb < t.n; jb += tile) {
+    unsigned long nb = (t.n - jb) < tile ? (t.n - jb) : tile;
+    double * upper = t.X + ib * t.ldx + jb;
+    double * lower = t.X + jb * t.ldx + ib;
+
+    // upper^T into the buffer, lower^T into upper, then the buffer into lower
+    matrixKernelsTransposeTile(simd.transposeNB, simd.transposeMicro, mb, nb, upper, t.ldx,
+                               buffer, tile);
+    if (jb != ib)
+      matrixKernelsTransposeTile(simd.transposeNB, simd.transposeMicro, nb, mb, lower, t.ldx,
+                                 upper, t.ldx);
+    matrixKernelsCopy(nb, mb, buffer, tile, lower, t.ldx);
+  }
+} // void matrixKernelsTransposeSquareBand(void * context, unsigned long index) --------------------
+
+/**
+ * @brief matrixKernelsTrsmDiagonal - Solves a diagonal block of a triangular solve row by row. Each
+ *                                    row of B is updated with the rows of X already solved by a
+ *                                    vector-matrix product, then divided by the diagonal. The
+ *                                    columns of B are solved in chunks, so that the rows of a chunk
+ *                                    stay in the L1 cache. The arguments are the same as
+ *                                    "matrixKernelsTrsm()".
+ */
+static void matrixKernelsTrsmDiagonal(bool upper, bool unit, unsigned long m, unsigned long n,
+                                      const double * T, unsigned long rsT, unsigned long csT,
+                                      double * B, unsigned long ldb) {
+  const matrixSimdKernels & simd = matrixSimd();
+  const unsigned long chunk = MATRIXKERNELS_TRSM_CHUNK;
+  for (unsigned long jb = 0; jb < n; jb += chunk) {
+    unsigned long nb = (n - jb) < chunk ? (n - jb) : chunk;
+    for (unsigned long s = 0; s < m; s++) {
+      unsigned long i = upper ? m - 1 - s : s;
+      double * b = B + i * ldb + jb;
+      unsigned long begin = upper ? i + 1 : 0;
+      unsigned long end = upper ? m : i;
+      if (end > begin)
+        simd.gevm(end - begin, nb, -1.0, B + begin * ldb + jb, ldb, T + i * rsT + begin * csT, csT,
+                  b);
+      if (!unit)
+        simd.multiplyScalar(nb, b, 1.0 / T[i * rsT + i * csT], b);
+    }
+  }
+} // void matrixKernelsTrsmDiagonal(bool upper, bool unit, unsigned long m, unsigned long n, const double * T, unsigned long rsT, unsigned long csT, double * B, unsigned long ldb)
+
+/**
+ * @brief matrixKernelsTrsmBlock - Blocked triangular solve on the calling thread. The solve is
+ *                                 left-looking: each block row of MATRIXKERNELS_TRSM_NB rows of B
+ *                                 is updated with all the rows of X already solved by a single
+ *                                 GEMM, so that B is read and written once, and its diagonal block
+ *                                 is then solved. The arguments are the same as
+ *                                 "matrixKernelsTrsm()".
+ */
+static void matrixKernelsTrsmBlock(bool upper, bool unit, unsigned long m, unsigned long n,
+                                   const double * T, unsigned long rsT, unsigned long csT,
+                                   double * B, unsigned long ldb) {
+  const unsigned long nb = MATRIXKERNELS_TRSM_NB;
+  unsigned long blocks = (m + nb - 1) / nb;
+  for (unsigned long s = 0; s < blocks; s++) {
+    unsigned long kb = (upper ? blocks - 1 - s : s) * nb;
+    unsigned long ke = (m - kb) < nb ? m : kb + nb;
+
+    // solved rows below the block for an upper T, above it for a lower T
+    if (upper && (ke < m))
+      matrixKernelsGemm(ke - kb, n, m - ke, -1.0, T + kb * rsT + ke * csT, rsT, csT, B + ke * ldb,
+                        ldb, 1, 1.0, B + kb * ldb, ldb);
+    else if (!upper && (kb > 0))
+      matrixKernelsGemm(ke - kb, n, kb, -1.0, T + kb * rsT, rsT, csT, B, ldb, 1, 1.0, B + kb * ldb,
+                        ldb);
+    matrixKernelsTrsmDiagonal(upper, unit, ke - kb, n, T + kb * (rsT + csT), rsT, csT, B + kb * ldb,
+                              ldb);
+  }
+} // void matrixKernelsTrsmBlock(bool upper, bool unit, unsigned long m, unsigned long n, const double * T, unsigned long rsT, unsigned long csT, double * B, unsigned long ldb)
+
+/**
+ * @brief matrixKernelsTrsmBand - Solves a band of right-hand sides of a parallel triangular solve.
+ * @param context               - The matrixKernelsTrsmBands of the solve.
+ * @param index                 - Index of the band.
+ */
+static void matrixKernelsTrsmBand(void * context, unsigned long index) {
+  const matrixKernelsTrsmBands & t = *(const matrixKernelsTrsmBands *)context;
+  unsigned long j = index * t.band;
+  unsigned long nb = (t.n - j) < t.band ? (t.n - j) : t.band;
+  matrixKernelsTrsmBlock(t.upper, t.unit, t.m, nb, t.T, t.rsT, t.csT, t.B + j, t.ldb);
+} // void matrixKernelsTrsmBand(void * context, unsigned long index) -------------------------------
+
+/// ================================================================================================
+/// EXTERNAL FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief matrixKernelsApply - Applies an element wise kernel between two row-major blocks,
+ *                             Z = kernel(X, Y), row by row. Blocks whose rows are stored
+ *                             back-to-back are processed in a single call of the kernel.
+ * @param kernel             - Element wise kernel processing n consecutive elements.
+ * @param m                  - Row size of the blocks.
+ * @param n                  - Column size of the blocks.
+ * @param X                  - Pointer to the first element of X.
+ * @param ldx                - Leading dimension of X.
+ * @param Y                  - Pointer to the first element of Y.
+ * @param ldy                - Leading dimension of Y.
+ * @param Z                  - Pointer to the first element of Z.
+ * @param ldz                - Leading dimension of Z.
+ */
+void matrixKernelsApply(void (*kernel)(unsigned long, const double *, const double *, double *),
+                        unsigned long m, unsigned long n, const double * X, unsigned long ldx,
+                        const double * Y, unsigned long ldy, double * Z, unsigned long ldz) {
+  if ((m == 1) || ((ldx == n) && (ldy == n) && (ldz == n))) {
+    kernel(m * n, X, Y, Z);
+    return;
+  }
+  for (unsigned long i = 0; i < m; i++)
+    kernel(n, X + i * ldx, Y + i * ldy, Z + i * ldz);
+} // void matrixKernelsApply(void (*kernel)(unsigned long, const double *, const double *, double *), unsigned long m, unsigned long n, const double * X, unsigned long ldx, const double * Y, unsigned long ldy, double * Z, unsigned long ldz)
+
+/**
+ * @brief matrixKernelsApplyScalar - Applies an element wise kernel between a row-major block and a
+ *                                   value, Z = kernel(X, Y), row by row. Blocks whose rows are
+ *                                   stored back-to-back are processed in a single call of the
+ *                                   kernel.
+ * @param kernel                   - Element wise kernel processing n consecutive elements.
+ * @param m                        - Row size of the blocks.
+ * @param n                        - Column size of the blocks.
+ * @param X                        - Pointer to the first element of X.
+ * @param ldx                      - Leading dimension of X.
+ * @param Y                        - The value.
+ * @param Z                        - Pointer to the first element of Z.
+ * @param ldz                      - Leading dimension of Z.
+ */
+void matrixKernelsApplyScalar(void (*kernel)(unsigned long, const double *, double, double *),
+                              unsigned long m, unsigned long n, const double * X, unsigned long ldx,
+                              double Y, double * Z, unsigned long ldz) {
+  if ((m == 1) || ((ldx == n) && (ldz == n))) {
+    kernel(m * n, X, Y, Z);
+    return;
+  }
+  for (unsigned long i = 0; i < m; i++)
+    kernel(n, X + i * ldx, Y, Z + i * ldz);
+} // void matrixKernelsApplyScalar(void (*kernel)(unsigned long, const double *, double, double *), unsigned long m, unsigned long n, const double * X, unsigned long ldx, double Y, double * Z, unsigned long ldz)
+
+/**
+ * @brief matrixKernelsCopy - Copies a row-major block, Z = X. The blocks must not overlap.
+ * @param m                 - Row size of the blocks.
+ * @param n                 - Column size of the blocks.
+ * @param X                 - Pointer to the first element of X.
+ * @param ldx               - Leading dimension of X.
+ * @param Z                 - Pointer to the first element of Z.
+ * @param ldz               - Leading dimension of Z.
+ */
+void matrixKernelsCopy(unsigned long m, unsigned long n, const double * X, unsigned long ldx,
+                       double * Z, unsigned long ldz) {
+  if ((m == 0) || (n == 0))
+    return;
+  if ((m == 1) || ((ldx == n) && (ldz == n))) {
+    memcpy(Z, X, sizeof(double) * m * n);
+    return;
+  }
+  for (unsigned long i = 0; i < m; i++)
+    memcpy(Z + i * ldz, X + i * ldx, sizeof(double) * n);
+} // void matrixKernelsCopy(unsigned long m, unsigned long n, const double * X, unsigned long ldx, double * Z, unsigned long ldz)
+
+/**
+ * @brief matrixKernelsCopy - Copies a single precision row-major block, Z = X. The blocks must not overlap.
+ * @param m                 - Row size of the blocks.
+ * @param n                 - Column size of the blocks.
+ * @param X                 - Pointer to the first element of X.
+ * @param ldx               - Leading dimension of X.
+ * @param Z                 - Pointer to the first element of Z.
+ * @param ldz               - Leading dimension of Z.
+ */
+void matrixKernelsCopy(unsigned long m, unsigned long n, const float * X, unsigned long ldx,
+                       float * Z, unsigned long ldz) {
+  if ((m == 0) || (n == 0))
+    return;
+  if ((m == 1) || ((ldx == n) && (ldz == n))) {
+    memcpy(Z, X, sizeof(float) * m * n);
+    return;
+  }
+  for (unsigned long i = 0; i < m; i++)
+    memcpy(Z + i * ldz, X + i * ldx, sizeof(float) * n);
+} // void matrixKernelsCopy(unsigned long m, unsigned long n, const float * X, unsigned long ldx, float * Z, unsigned long ldz)
+
+/**
+ * @brief matrixKernelsGemm - General matrix multiplication, C = alpha * A * B + beta * C.
+ *                            Large products are split into tiles of C computed in parallel on the
+ *                            threads of matrixlibrarythreads, and products where C is a single row
+ *                            or column run on "matrixKernelsGemv()" or "matrixKernelsGevm()".
+ *                            Element (i, p) of A is read from A[i * rsA + p * csA] and element
+ *                            (p, j) of B is read from B[p * rsB + j * csB], which allows the
+ *                            operands to be read in place from transposed or strided storage.
+ *                            When beta is zero, C is not read.
+ * @param m                 - Row size of A and C.
+ * @param n                 - Column size of B and C.
+ * @param k                 - Column size of A and row size of B.
+ * @param alpha             - Scaling of the product A * B.
+ * @param A                 - Pointer to the first element of A.
+ * @param rsA               - Row stride of A.
+ * @param csA               - Column stride of A.
+ * @param B                 - Pointer to the first element of B.
+ * @param rsB               - Row stride of B.
+ * @param csB               - Column stride of B.
+ * @param beta              - Scaling of C.
+ * @param C                 - Pointer to the first element of the row-major C.
+ * @param ldc               - Leading dimension (row stride) of C.
+ */
+void matrixKernelsGemm(unsigned long m, unsigned long n, unsigned long k, double alpha,
+                       const double * A, unsigned long rsA, unsigned long csA,
+                       const double * B, unsigned long rsB, unsigned long csB,
+                       double beta, double * C, unsigned long ldc) {
+  // a single row or column of C is a matrix-vector product, whichever operand is transposed
+  if ((m > 0) && (n > 0) && (k > 0) && (alpha != 0.0)) {
+    if ((n == 1) && (csA == 1)) {
+      matrixKernelsGemv(m, k, alpha, A, rsA, B, rsB, beta, C, ldc);
+      return;
+    }
+    if ((n == 1) && (rsA == 1) && (ldc == 1)) {
+      matrixKernelsGevm(k, m, alpha, A, csA, B, rsB, beta, C);
+      return;
+    }
+    if ((m == 1) && (csB == 1)) {
+      matrixKernelsGevm(k, n, alpha, B, rsB, A, csA, beta, C);
+      return;
+    }
+    if ((m == 1) && (rsB == 1)) {
+      matrixKernelsGemv(n, k, alpha, B, csB, A, csA, beta, C, 1);
+      return;
+    }
+  }
+
+  const matrixSimdKernels & simd = matrixSimd();
+  matrixKernelsGemmParallel(simd.gemmMR, simd.gemmNR, simd.gemmMicro, m, n, k, alpha, A, rsA, csA,
+                            B, rsB, csB, beta, C, ldc);
+} // void matrixKernelsGemm(unsigned long m, unsigned long n, unsigned long k, double alpha, const double * A, unsigned long rsA, unsigned long csA, const double * B, unsigned long rsB, unsigned long csB, double beta, double * C, unsigned long ldc)
+
+/**
+ * @brief matrixKernelsGemm - Single precision general matrix multiplication, C = alpha * A * B + beta * C.
+ *                            Element (i, p) of A is read from A[i * rsA + p * csA] and element
+ *                            (p, j) of B is read from B[p * rsB + j * csB], which allows the
+ *                            operands to be read in place from transposed or strided storage.
+ *                            When beta is zero, C is not read.
+ * @param m                 - Row size of A and C.
+ * @param n                 - Column size of B and C.
+ * @param k                 - Column size of A and row size of B.
+ * @param alpha             - Scaling of the product A * B.
+ * @param A                 - Pointer to the first element of A.
+ * @param rsA               - Row stride of A.
+ * @param csA               - Column stride of A.
+ * @param B                 - Pointer to the first element of B.
+ * @param rsB               - Row stride of B.
+ * @param csB               - Column stride of B.
+ * @param beta              - Scaling of C.
+ * @param C                 - Pointer to the first element of the row-major C.
+ * @param ldc               - Leading dimension (row stride) of C.
+ */
+void matrixKernelsGemm(unsigned long m, unsigned long n, unsigned long k, float alpha,
+                       const float * A, unsigned long rsA, unsigned long csA,
+                       const float * B, unsigned long rsB, unsigned long csB,
+                       float beta, float * C, unsigned long ldc) {
+  const matrixSimdKernels & simd = matrixSimd();
+  matrixKernelsGemmParallel(simd.gemmMRFloat, simd.gemmNRFloat, simd.gemmMicroFloat, m, n, k,
+                            alpha, A, rsA, csA, B, rsB, csB, beta, C, ldc);
+} // void matrixKernelsGemm(unsigned long m, unsigned long n, unsigned long k, float alpha, const float * A, unsigned long rsA, unsigned long csA, const float * B, unsigned long rsB, unsigned long csB, float beta, float * C, unsigned long ldc)
+
+/**
+ * @brief matrixKernelsGemv - Matrix-vector multiplication, y = alpha * A * x + beta * y, where A
+ *                            is a row-major (m x n) block. The rows of large matrices are split
+ *                            across the threads of matrixlibrarythreads. When beta is zero, y is
+ *                            not read.
+ * @param m                 - Row size of A and size of y.
+ * @param n                 - Column size of A and size of x.
+ * @param alpha             - Scaling of the product A * x.
+ * @param A                 - Pointer to the first element of A.
+ * @param lda               - Leading dimension of A.
+ * @param x                 - Pointer to the first element of x.
+ * @param incx              - Distance between the elements of x.
+ * @param beta              - Scaling of y.
+ * @param y                 - Pointer to the first element of y.
+ * @param incy              - Distance between the elements of y.
+ */
+void matrixKernelsGemv(unsigned long m, unsigned long n, double alpha, const double * A,
+                       unsigned long lda, const double * x, unsigned long incx, double beta,
+                       double * y, unsigned long incy) {
+  if (m == 0)
+    return;
+
+  // the kernels stream x along every row of A, so a strided x is gathered once up front
+  double * xp = NULL;
+  if ((incx != 1) && (n > 1)) {
+    xp = matrixAllocatorMalloc(sizeof(double) * n);
+    for (unsigned long j = 0; j < n; j++)
+      xp[j] = x[j * incx];
+    x = xp;
+  }
+
+  matrixKernelsGemvBlocks t = {m, n, alpha, A, lda, x, 1, beta, y, incy,
+                               matrixKernelsGemvSplit(m, m * n)};
+  if (t.block == m)
+    matrixKernelsGemvBlock(&t, 0);
+  else
+    matrixThreadsParallelFor((m + t.block - 1) / t.block, matrixKernelsGemvBlock, &t);
+
+  if (xp != NULL)
+    matrixAllocatorFree(xp);
+} // void matrixKernelsGemv(unsigned long m, unsigned long n, double alpha, const double * A, unsigned long lda, const double * x, unsigned long incx, double beta, double * y, unsigned long incy)
+
+/**
+ * @brief matrixKernelsGevm - Vector-matrix multiplication, y = alpha * x * A + beta * y, where A is
+ *                            a row-major (m x n) block and y is contiguous. The columns of large
+ *                            matrices are split across the threads of matrixlibrarythreads. When
+ *                            beta is zero, y is not read.
+ * @param m                 - Row size of A and size of x.
+ * @param n                 - Column size of A and size of y.
+ * @param alpha             - Scaling of the product x * A.
+ * @param A                 - Pointer to the first element of A.
+ * @param lda               - Leading dimension of A.
+ * @param x                 - Pointer to the first element of x.
+ * @param incx              - Distance between the elements of x.
+ * @param beta              - Scaling of y.
+ * @param y                 - Pointer to the first element of y.
+ */
+void matrixKernelsGevm(unsigned long m, unsigned long n, double alpha, const double * A,
+                       unsigned long lda, const double * x, unsigned long incx, double beta,
+                       double * y) {
+  if (n == 0)
+    return;
+
+  matrixKernelsGemvBlocks t = {m, n, alpha, A, lda, x, incx, beta, y, 1,
+                               matrixKernelsGemvSplit(n, m * n)};
+  if (t.block == n)
+    matrixKernelsGevmBlock(&t, 0);
+  else
+    matrixThreadsParallelFor((n + t.block - 1) / t.block, matrixKernelsGevmBlock, &t);
+} // void matrixKernelsGevm(unsigned long m, unsigned long n, double alpha, const double * A, unsigned long lda, const double * x, unsigned long incx, double beta, double * y)
+
+/**
+ * @brief matrixKernelsSyrk - Symmetric rank-k update, C = alpha * A * A^T + beta * C, where C is
+ *                            (n x n) and A is (n x k). Only the lower triangle is computed, with
+ *                            about half the flops of the general product, and it is then mirrored
+ *                            into the upper triangle, which is overwritten so that only the
+ *                            lower triangle of C needs to hold its input. When beta is zero, C is
+ *                            not read.
+ * @param n                 - Row size of A and size of C.
+ * @param k                 - Column size of A.
+ * @param alpha             - Scaling of the product A * A^T.
+ * @param A                 - Pointer to the first element of A.
+ * @param rsA               - Row stride of A.
+ * @param csA               - Column stride of A.
+ * @param beta              - Scaling of C.
+ * @param C                 - Pointer to the first element of the row-major C.
+ * @param ldc               - Leading dimension (row stride) of C.
+ */
+void matrixKernelsSyrk(unsigned long n, unsigned long k, double alpha,
+                       const double * A, unsigned long rsA, unsigned long csA,
+                       double beta, double * C, unsigned long ldc) {
+  // block row i of the lower triangle is rows [i, i + nb) of A times the first i + nb rows of A,
+  // read in place as the transposed operand
+  for (unsigned long i = 0; i < n; i += MATRIXKERNELS_SYRK_NB) {
+    unsigned long nb = (n - i) < MATRIXKERNELS_SYRK_NB ? (n - i) : MATRIXKERNELS_SYRK_NB;
+    matrixKernelsGemm(nb, i + nb, k, alpha, A + i * rsA, rsA, csA, A, csA, rsA,
+                      beta, C + i * ldc, ldc);
+  }
+
+  // mirror the lower triangle tile by tile, so that both sides of a tile stay in cache
+  const unsigned long tile = MATRIXKERNELS_TRANSPOSE_TILE;
+  for (unsigned long ib = 0; ib < n; ib += tile) {
+    unsigned long ie = (n - ib) < tile ? n : ib + tile;
+    for (unsigned long jb = ib; jb < n; jb += tile) {
+      unsigned long je = (n - jb) < tile ? n : jb + tile;
+      for (unsigned long r = ib; r < ie; r++)
+        for (unsigned long c = (jb > r + 1) ? jb : r + 1; c < je; c++)
+          C[r * ldc + c] = C[c * ldc + r];
+    }
+  }
+} // void matrixKernelsSyrk(unsigned long n, unsigned long k, double alpha, const double * A, unsigned long rsA, unsigned long csA, double beta, double * C, unsigned long ldc)
+
+/**
+ * @brief matrixKernelsTranspose - Transposes a row-major block, Z = X^T, tile by tile with the
+ *                                 transpose micro kernel of the active SIMD kernel set. Large
+ *                                 blocks are split into bands transposed in parallel on the
+ *                                 threads of matrixlibrarythreads. The blocks must not overlap.
+ * @param m                      - Row size of X and column size of Z.
+ * @param n                      - Column size of X and row size of Z.
+ * @param X                      - Pointer to the first element of X.
+ * @param ldx                    - Leading dimension of X.
+ * @param Z                      - Pointer to the first element of Z.
+ * @param ldz                    - Leading dimension of Z.
+ */
+void matrixKernelsTranspose(unsigned long m, unsigned long n, const double * X, unsigned long ldx,
+                            double * Z, unsigned long ldz) {
+  const matrixSimdKernels & simd = matrixSimd();
+  matrixKernelsTransposeParallel(simd.transposeNB, simd.transposeMicro, m, n, X, ldx, Z, ldz);
+} // void matrixKernelsTranspose(unsigned long m, unsigned long n, const double * X, unsigned long ldx, double * Z, unsigned long ldz)
+
+/**
+ * @brief matrixKernelsTranspose - Transposes a single precision row-major block, Z = X^T, tile by
+ *                                 tile. Large blocks are split into bands transposed in parallel
+ *                                 on the threads of matrixlibrarythreads. The blocks must not
+ *                                 overlap.
+ * @param m                      - Row size of X and column size of Z.
+ * @param n                      - Column size of X and row size of Z.
+ * @param X                      - Pointer to the first element of X.
+ * @param ldx                    - Leading dimension of X.
+ * @param Z                      - Pointer to the first element of Z.
+ * @param ldz                    - Leading dimension of Z.
+ */
+void matrixKernelsTranspose(unsigned long m, unsigned long n, const float * X, unsigned long ldx,
+                            float * Z, unsigned long ldz) {
+  matrixKernelsTransposeParallel<float>(0, NULL, m, n, X, ldx, Z, ldz);
+} // void matrixKernelsTranspose(unsigned long m, unsigned long n, const float * X, unsigned long ldx, float * Z, unsigned long ldz)
+
+/**
+ * @brief matrixKernelsTransposeSquare - Transposes a square row-major block in place, X = X^T,
+ *                                       swapping pairs of tiles across the diagonal. Large blocks
+ *                                       are transposed in parallel by bands of tile rows on the
+ *                                       threads of matrixlibrarythreads.
+ * @param n                            - Row and column size of X.
+ * @param X                            - Pointer to the first element of X.
+ * @param ldx                          - Leading dimension of X.
+ */
+void matrixKernelsTransposeSquare(unsigned long n, double * X, unsigned long ldx) {
+  if (n < 2)
+    return;
+
+  matrixKernelsTransposeSquares t = {n, X, ldx};
+  unsigned long bands = (n + MATRIXKERNELS_TRANSPOSE_TILE - 1) / MATRIXKERNELS_TRANSPOSE_TILE;
+  if (n * n < MATRIXKERNELS_TRANSPOSE_PARALLEL) {
+    for (unsigned long i = 0; i < bands; i++)
+      matrixKernelsTransposeSquareBand(&t, i);
+    return;
+  }
+  matrixThreadsParallelFor(bands, matrixKernelsTransposeSquareBand, &t);
+} // void matrixKernelsTransposeSquare(unsigned long n, double * X, unsigned long ldx) -------------
+
+/**
+ * @brief matrixKernelsTrsm - Triangular solve with multiple right-hand sides, T * X = B, where T is
+ *                            (m x m) triangular and B is (m x n). B is overwritten by X. Only the
+ *                            triangle of T selected by upper is read, and its diagonal is taken as
+ *                            ones when unit is true. Element (i, p) of T is read from
+ *                            T[i * rsT + p * csT], which allows T^T to be used in place. The
+ *                            right-hand sides are independent, so large solves with many of them
+ *                            are split into bands of columns of B solved in parallel, while the
+ *                            others parallelise within their GEMM updates.
+ * @param upper             - Whether T is upper or lower triangular.
+ * @param unit              - Whether T has a unit diagonal.
+ * @param m                 - Size of T and row size of B.
+ * @param n                 - Column size of B, the number of right-hand sides.
+ * @param T                 - Pointer to the first element of T.
+ * @param rsT               - Row stride of T.
+ * @param csT               - Column stride of T.
+ * @param B                 - Pointer to the first element of the row-major B.
+ * @param ldb               - Leading dimension (row stride) of B.
+ */
+void matrixKernelsTrsm(bool upper, bool unit, unsigned long m, unsigned long n,
+                       const double * T, unsigned long rsT, unsigned long csT,
+                       double * B, unsigned long ldb) {
+  if ((m == 0) || (n == 0))
+    return;
+
+  unsigned long band = n;
+  if (m * m * n >= MATRIXKERNELS_GEMM_PARALLEL) {
+    unsigned long bands = matrixThreadsGetCount() * MATRIXKERNELS_GEMM_TILES;
+    band = ((n + bands - 1) / bands + MATRIXKERNELS_GEMM_TILE_N - 1) / MATRIXKERNELS_GEMM_TILE_N;
+    band *= MATRIXKERNELS_GEMM_TILE_N;
+  }
+
+  if (band >= n) {
+    matrixKernelsTrsmBlock(upper, unit, m, n, T, rsT, csT, B, ldb);
+    return;
+  }
+
+  matrixKernelsTrsmBands t = {upper, unit, m, n, T, rsT, csT, B, ldb, band};
+  matrixThreadsParallelFor((n + band - 1) / band, matrixKernelsTrsmBand, &t);
+} // void matrixKernelsTrsm(bool upper, bool unit, unsigned long m, unsigned long n, const double * T, unsigned long rsT, unsigned long csT, double * B, unsigned long ldb)
+
+/**
+ * @brief matrixKernelsTrsmRight - Right-side triangular solve, X * T = B, where T is (n x n)
+ *                                 triangular and B is (m x n). B is overwritten by X. The solve is
+ *                                 done as T^T * X^T = B^T by "matrixKernelsTrsm()" on a transposed
+ *                                 copy of B, reading T^T in place through swapped strides, so that
+ *                                 the rows of B are solved as contiguous right-hand sides.
+ * @param upper                  - Whether T is upper or lower triangular.
+ * @param unit                   - Whether T has a unit diagonal.
+ * @param m                      - Row size of B, the number of right-hand sides.
+ * @param n                      - Size of T and column size of B.
+ * @param T                      - Pointer to the first element of T.
+ * @param rsT                    - Row stride of T.
+ * @param csT                    - Column stride of T.
+ * @param B                      - Pointer to the first element of the row-major B.
+ * @param ldb                    - Leading dimension (row stride) of B.
+ */
+void matrixKernelsTrsmRight(bool upper, bool unit, unsigned long m, unsigned long n,
+                            const double * T, unsigned long rsT, unsigned long csT,
+                            double * B, unsigned long ldb) {
+  if ((m == 0) || (n == 0))
+    return;
+
+  double * Bt = matrixAllocatorMalloc(sizeof(double) * n * m);
+  matrixKernelsTranspose(m, n, B, ldb, Bt, m);
+  matrixKernelsTrsm(!upper, unit, n, m, T, csT, rsT, Bt, m);
+  matrixKernelsTranspose(n, m, Bt, m, B, ldb);
+  matrixAllocatorFree(Bt);
+} // void matrixKernelsTrsmRight(bool upper, bool unit, unsigned long m, unsigned long n, const double * T, unsigned long rsT, unsigned long csT, double * B, unsigned long ldb)
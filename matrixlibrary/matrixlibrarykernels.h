@@ -0,0 +1,391 @@
+/*
+ * Copyright:   2021 Johnathon Leong
+ *
+ * License:     License under LGPL-3.0-or-later.
+ *              Please refer to https://www.gnu.org/licenses/lgpl-3.0.txt for more information on the
+ *              terms of LGPL-3.0 or relavent website for a later version of the LGPL.
+ *
+ * Disclaimer:  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY
+ *              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ *              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ *              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ *              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *              WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author:      Johnathon Leong
+ *
+ * Note:        Low level computational kernels used internally by matrixlibrary. The kernels work on
+ *              raw row-major buffers so that they can be shared by the matrix class and any of the
+ *              other modules.
+ *
+ * Version:     1.0.11
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the right-side triangular solve "matrixKernelsTrsmRight()".
+ *
+ * Version:     1.0.10
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. "matrixKernelsTrsm()" is now left-looking, and its diagonal blocks are solved in
+ *                 chunks of MATRIXKERNELS_TRSM_CHUNK columns through the SIMD vector-matrix kernel.
+ *
+ * Version:     1.0.9
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the blocked triangular solve "matrixKernelsTrsm()", whose off-diagonal
+ *                 updates run on "matrixKernelsGemm()".
+ *
+ * Version:     1.0.8
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the tiled "matrixKernelsTranspose()" kernels, parallel above
+ *                 MATRIXKERNELS_TRANSPOSE_PARALLEL elements, and the in-place
+ *                 "matrixKernelsTransposeSquare()".
+ *
+ * Version:     1.0.7
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the symmetric rank-k update "matrixKernelsSyrk()".
+ *
+ * Version:     1.0.6
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the matrix-vector "matrixKernelsGemv()" and vector-matrix
+ *                 "matrixKernelsGevm()" kernels, which "matrixKernelsGemm()" now uses for products
+ *                 with a single row or column.
+ *
+ * Version:     1.0.5
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Products of at least MATRIXKERNELS_GEMM_PARALLEL multiply-adds are split into
+ *                 2D tiles of C run on the thread pool of matrixlibrarythreads.
+ *
+ * Version:     1.0.4
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The GEMM blocking, packing and macro kernel are now templates shared by the
+ *                 scalar types.
+ *              2. Added the single precision "matrixKernelsGemm()" and "matrixKernelsCopy()".
+ *
+ * Version:     1.0.3
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The GEMM packing buffers are now allocated through matrixlibraryallocator.
+ *
+ * Version:     1.0.2
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the strided "matrixKernelsApply()", "matrixKernelsApplyScalar()" and
+ *                 "matrixKernelsCopy()" kernels.
+ *
+ * Version:     1.0.1
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The GEMM micro kernel and its register block size are now taken from the runtime
+ *                 dispatched kernel table of matrixlibrarysimd.
+ *
+ * Version:     1.0.0
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Implemented first release version of matrixlibrarykernels.
+ */
+
+#ifndef MATRIXLIBRARYKERNELS_H
+#define MATRIXLIBRARYKERNELS_H
+
+/**
+ * @brief MATRIXKERNELS_GEMM_MC - Row size of the packed block of A. The packed block (MC x KC) is
+ *                                sized to stay resident in the L2 cache.
+ */
+#define MATRIXKERNELS_GEMM_MC 96
+
+/**
+ * @brief MATRIXKERNELS_GEMM_KC - Inner size of the packed blocks. A packed micro panel of B
+ *                                (KC x NR) is sized to stay resident in the L1 cache. The register
+ *                                block (MR x NR) is defined by the active SIMD kernel set, and MC
+ *                                and NC are multiples of every MR and NR in use.
+ */
+#define MATRIXKERNELS_GEMM_KC 256
+
+/**
+ * @brief MATRIXKERNELS_GEMM_NC - Column size of the packed block of B. The packed block (KC x NC)
+ *                                is sized to stay resident in the L3 cache.
+ */
+#define MATRIXKERNELS_GEMM_NC 2048
+
+/**
+ * @brief MATRIXKERNELS_GEMM_SMALL - Products with m * n * k below this value skip the packing
+ *                                   stage as its overhead outweighs the gain for tiny matrices.
+ */
+#define MATRIXKERNELS_GEMM_SMALL 32768
+
+/**
+ * @brief MATRIXKERNELS_GEMM_PARALLEL - Products with m * n * k below this value run on the calling
+ *                                      thread only, as splitting them across the thread pool costs
+ *                                      more than it saves.
+ */
+#define MATRIXKERNELS_GEMM_PARALLEL 2097152
+
+/**
+ * @brief MATRIXKERNELS_GEMM_TILES - Number of tiles of C per thread aimed at by a parallel product,
+ *                                   so that the threads finishing early can steal the remaining
+ *                                   tiles of the others.
+ */
+#define MATRIXKERNELS_GEMM_TILES 2
+
+/**
+ * @brief MATRIXKERNELS_GEMM_TILE_N - Smallest column size of the tiles of C of a parallel product.
+ *                                    The smallest row size is MATRIXKERNELS_GEMM_MC.
+ */
+#define MATRIXKERNELS_GEMM_TILE_N 128
+
+/**
+ * @brief MATRIXKERNELS_SYRK_NB - Size of the diagonal blocks of a symmetric rank-k update. Each
+ *                                block row of the lower triangle is a single GEMM whose only
+ *                                wasted work is the upper half of its diagonal block.
+ */
+#define MATRIXKERNELS_SYRK_NB 192
+
+/**
+ * @brief MATRIXKERNELS_TRANSPOSE_TILE - Size of the square tiles in which blocks are transposed, so
+ *                                       that the rows read and the rows written by a tile both stay
+ *                                       in the L1 cache.
+ */
+#define MATRIXKERNELS_TRANSPOSE_TILE 32
+
+/**
+ * @brief MATRIXKERNELS_TRANSPOSE_PARALLEL - Transposes of blocks with fewer elements than this run
+ *                                           on the calling thread only.
+ */
+#define MATRIXKERNELS_TRANSPOSE_PARALLEL 1048576
+
+/**
+ * @brief MATRIXKERNELS_TRSM_NB - Size of the diagonal blocks of a triangular solve. The diagonal
+ *                                blocks are solved row by row and the rest of the solve is done by
+ *                                one GEMM update per block row.
+ */
+#define MATRIXKERNELS_TRSM_NB 128
+
+/**
+ * @brief MATRIXKERNELS_TRSM_CHUNK - Number of columns of B solved at a time within a diagonal block.
+ */
+#define MATRIXKERNELS_TRSM_CHUNK 128
+
+/**
+ * @brief MATRIXKERNELS_GEMV_PARALLEL - Matrix-vector products over matrices with fewer elements than
+ *                                      this run on the calling thread only.
+ */
+#define MATRIXKERNELS_GEMV_PARALLEL 262144
+
+/**
+ * @brief MATRIXKERNELS_GEMV_BLOCK - Granularity of the blocks of rows (GEMV) or columns (GEVM) given
+ *                                   to the threads of a parallel matrix-vector product.
+ */
+#define MATRIXKERNELS_GEMV_BLOCK 64
+
+/**
+ * @brief matrixKernelsApply - Applies an element wise kernel between two row-major blocks,
+ *                             Z = kernel(X, Y), row by row. Blocks whose rows are stored
+ *                             back-to-back are processed in a single call of the kernel.
+ * @param kernel             - Element wise kernel processing n consecutive elements.
+ * @param m                  - Row size of the blocks.
+ * @param n                  - Column size of the blocks.
+ * @param X                  - Pointer to the first element of X.
+ * @param ldx                - Leading dimension of X.
+ * @param Y                  - Pointer to the first element of Y.
+ * @param ldy                - Leading dimension of Y.
+ * @param Z                  - Pointer to the first element of Z.
+ * @param ldz                - Leading dimension of Z.
+ */
+void matrixKernelsApply(void (*kernel)(unsigned long, const double *, const double *, double *),
+                        unsigned long m, unsigned long n, const double * X, unsigned long ldx,
+                        const double * Y, unsigned long ldy, double * Z, unsigned long ldz);
+
+/**
+ * @brief matrixKernelsApplyScalar - Applies an element wise kernel between a row-major block and a
+ *                                   value, Z = kernel(X, Y), row by row. Blocks whose rows are
+ *                                   stored back-to-back are processed in a single call of the
+ *                                   kernel.
+ * @param kernel                   - Element wise kernel processing n consecutive elements.
+ * @param m                        - Row size of the blocks.
+ * @param n                        - Column size of the blocks.
+ * @param X                        - Pointer to the first element of X.
+ * @param ldx                      - Leading dimension of X.
+ * @param Y                        - The value.
+ * @param Z                        - Pointer to the first element of Z.
+ * @param ldz                      - Leading dimension of Z.
+ */
+void matrixKernelsApplyScalar(void (*kernel)(unsigned long, const double *, double, double *),
+                              unsigned long m, unsigned long n, const double * X, unsigned long ldx,
+                              double Y, double * Z, unsigned long ldz);
+
+/**
+ * @brief matrixKernelsCopy - Copies a row-major block, Z = X. The blocks must not overlap.
+ * @param m                 - Row size of the blocks.
+ * @param n                 - Column size of the blocks.
+ * @param X                 - Pointer to the first element of X.
+ * @param ldx               - Leading dimension of X.
+ * @param Z                 - Pointer to the first element of Z.
+ * @param ldz               - Leading dimension of Z.
+ */
+void matrixKernelsCopy(unsigned long m, unsigned long n, const double * X, unsigned long ldx,
+                       double * Z, unsigned long ldz);
+
+/**
+ * @brief matrixKernelsCopy - Copies a single precision row-major block, Z = X. The blocks must not
+ *                            overlap. The arguments are the same as the double precision version.
+ */
+void matrixKernelsCopy(unsigned long m, unsigned long n, const float * X, unsigned long ldx,
+                       float * Z, unsigned long ldz);
+
+/**
+ * @brief matrixKernelsGemm - General matrix multiplication, C = alpha * A * B + beta * C.
+ *                            Large products are split into tiles of C computed in parallel on the
+ *                            threads of matrixlibrarythreads, and products where C is a single row
+ *                            or column run on "matrixKernelsGemv()" or "matrixKernelsGevm()".
+ *                            Element (i, p) of A is read from A[i * rsA + p * csA] and element
+ *                            (p, j) of B is read from B[p * rsB + j * csB], which allows the
+ *                            operands to be read in place from transposed or strided storage.
+ *                            When beta is zero, C is not read.
+ * @param m                 - Row size of A and C.
+ * @param n                 - Column size of B and C.
+ * @param k                 - Column size of A and row size of B.
+ * @param alpha             - Scaling of the product A * B.
+ * @param A                 - Pointer to the first element of A.
+ * @param rsA               - Row stride of A.
+ * @param csA               - Column stride of A.
+ * @param B                 - Pointer to the first element of B.
+ * @param rsB               - Row stride of B.
+ * @param csB               - Column stride of B.
+ * @param beta              - Scaling of C.
+ * @param C                 - Pointer to the first element of the row-major C.
+ * @param ldc               - Leading dimension (row stride) of C.
+ */
+void matrixKernelsGemm(unsigned long m, unsigned long n, unsigned long k, double alpha,
+                       const double * A, unsigned long rsA, unsigned long csA,
+                       const double * B, unsigned long rsB, unsigned long csB,
+                       double beta, double * C, unsigned long ldc);
+
+/**
+ * @brief matrixKernelsGemm - Single precision general matrix multiplication,
+ *                            C = alpha * A * B + beta * C, sharing the blocking of the double
+ *                            precision version with the single precision micro kernel of the
+ *                            active SIMD kernel set. The arguments are the same as the double
+ *                            precision version.
+ */
+void matrixKernelsGemm(unsigned long m, unsigned long n, unsigned long k, float alpha,
+                       const float * A, unsigned long rsA, unsigned long csA,
+                       const float * B, unsigned long rsB, unsigned long csB,
+                       float beta, float * C, unsigned long ldc);
+
+/**
+ * @brief matrixKernelsGemv - Matrix-vector multiplication, y = alpha * A * x + beta * y, where A
+ *                            is a row-major (m x n) block. The rows of large matrices are split
+ *                            across the threads of matrixlibrarythreads. When beta is zero, y is
+ *                            not read.
+ * @param m                 - Row size of A and size of y.
+ * @param n                 - Column size of A and size of x.
+ * @param alpha             - Scaling of the product A * x.
+ * @param A                 - Pointer to the first element of A.
+ * @param lda               - Leading dimension of A.
+ * @param x                 - Pointer to the first element of x.
+ * @param incx              - Distance between the elements of x.
+ * @param beta              - Scaling of y.
+ * @param y                 - Pointer to the first element of y.
+ * @param incy              - Distance between the elements of y.
+ */
+void matrixKernelsGemv(unsigned long m, unsigned long n, double alpha, const double * A,
+                       unsigned long lda, const double * x, unsigned long incx, double beta,
+                       double * y, unsigned long incy);
+
+/**
+ * @brief matrixKernelsGevm - Vector-matrix multiplication, y = alpha * x * A + beta * y, where A is
+ *                            a row-major (m x n) block and y is contiguous. The columns of large
+ *                            matrices are split across the threads of matrixlibrarythreads. When
+ *                            beta is zero, y is not read.
+ * @param m                 - Row size of A and size of x.
+ * @param n                 - Column size of A and size of y.
+ * @param alpha             - Scaling of the product x * A.
+ * @param A                 - Pointer to the first element of A.
+ * @param lda               - Leading dimension of A.
+ * @param x                 - Pointer to the first element of x.
+ * @param incx              - Distance between the elements of x.
+ * @param beta              - Scaling of y.
+ * @param y                 - Pointer to the first element of y.
+ */
+void matrixKernelsGevm(unsigned long m, unsigned long n, double alpha, const double * A,
+                       unsigned long lda, const double * x, unsigned long incx, double beta,
+                       double * y);
+
+/**
+ * @brief matrixKernelsSyrk - Symmetric rank-k update, C = alpha * A * A^T + beta * C, where C is
+ *                            (n x n) and A is (n x k). Only the lower triangle is computed, with
+ *                            about half the flops of the general product, and it is then mirrored
+ *                            into the upper triangle, which is overwritten so that only the
+ *                            lower triangle of C needs to hold its input. When beta is zero, C is
+ *                            not read.
+ * @param n                 - Row size of A and size of C.
+ * @param k                 - Column size of A.
+ * @param alpha             - Scaling of the product A * A^T.
+ * @param A                 - Pointer to the first element of A.
+ * @param rsA               - Row stride of A.
+ * @param csA               - Column stride of A.
+ * @param beta              - Scaling of C.
+ * @param C                 - Pointer to the first element of the row-major C.
+ * @param ldc               - Leading dimension (row stride) of C.
+ */
+void matrixKernelsSyrk(unsigned long n, unsigned long k, double alpha,
+                       const double * A, unsigned long rsA, unsigned long csA,
+                       double beta, double * C, unsigned long ldc);
+
+/**
+ * @brief matrixKernelsTranspose - Transposes a row-major block, Z = X^T, tile by tile with the
+ *                                 transpose micro kernel of the active SIMD kernel set. Large
+ *                                 blocks are transposed in parallel. The blocks must not overlap.
+ * @param m                      - Row size of X and column size of Z.
+ * @param n                      - Column size of X and row size of Z.
+ * @param X                      - Pointer to the first element of X.
+ * @param ldx                    - Leading dimension of X.
+ * @param Z                      - Pointer to the first element of Z.
+ * @param ldz                    - Leading dimension of Z.
+ */
+void matrixKernelsTranspose(unsigned long m, unsigned long n, const double * X, unsigned long ldx,
+                            double * Z, unsigned long ldz);
+
+/**
+ * @brief matrixKernelsTranspose - Transposes a single precision row-major block, Z = X^T. The
+ *                                 blocks must not overlap. The arguments are the same as the
+ *                                 double precision version.
+ */
+void matrixKernelsTranspose(unsigned long m, unsigned long n, const float * X, unsigned long ldx,
+                            float * Z, unsigned long ldz);
+
+/**
+ * @brief matrixKernelsTransposeSquare - Transposes a square row-major block in place, X = X^T.
+ * @param n                            - Row and column size of X.
+ * @param X                            - Pointer to the first element of X.
+ * @param ldx                          - Leading dimension of X.
+ */
+void matrixKernelsTransposeSquare(unsigned long n, double * X, unsigned long ldx);
+
+/**
+ * @brief matrixKernelsTrsm - Triangular solve with multiple right-hand sides, T * X = B, where T is
+ *                            (m x m) triangular and B is (m x n). B is overwritten by X. Only the
+ *                            triangle of T selected by upper is read, and its diagonal is taken as
+ *                            ones when unit is true. Element (i, p) of T is read from
+ *                            T[i * rsT + p * csT], which allows T^T to be used in place.
+ * @param upper             - Whether T is upper or lower triangular.
+ * @param unit              - Whether T has a unit diagonal.
+ * @param m                 - Size of T and row size of B.
+ * @param n                 - Column size of B, the number of right-hand sides.
+ * @param T                 - Pointer to the first element of T.
+ * @param rsT               - Row stride of T.
+ * @param csT               - Column stride of T.
+ * @param B                 - Pointer to the first element of the row-major B.
+ * @param ldb               - Leading dimension (row stride) of B.
+ */
+void matrixKernelsTrsm(bool upper, bool unit, unsigned long m, unsigned long n,
+                       const double * T, unsigned long rsT, unsigned long csT,
+                       double * B, unsigned long ldb);
+
+/**
+ * @brief matrixKernelsTrsmRight - Right-side triangular solve, X * T = B, where T is (n x n)
+ *                                 triangular and B is (m x n). B is overwritten by X. The arguments
+ *                                 are the same as "matrixKernelsTrsm()", with T on the right.
+ */
+void matrixKernelsTrsmRight(bool upper, bool unit, unsigned long m, unsigned long n,
+                            const double * T, unsigned long rsT, unsigned long csT,
+                            double * B, unsigned long ldb);
+
+#endif // MATRIXLIBRARYKERNELS_H
@@ -0,0 +1,1227 @@
+/*
+ * Copyright:   2021 Johnathon Leong
+ *
+ * License:     License under LGPL-3.0-or-later.
+ *              Please refer to https://www.gnu.org/licenses/lgpl-3.0.txt for more information on the
+ *              terms of LGPL-3.0 or relavent website for a later version of the LGPL.
+ *
+ * Disclaimer:  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY
+ *              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ *              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ *              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ *              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *              WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author:      Johnathon Leong
+ *
+ * Note:        LAPACK style factorizations and solvers of matrixlibrary. The routines work in place
+ *              on raw row-major buffers and are blocked, so that most of their flops are done by the
+ *              GEMM and TRSM kernels of matrixlibrarykernels, in parallel for large matrices. The LU
+ *              and QR factorizations are split into the tasks of their column blocks, which run as
+ *              soon as their dependencies are done, and the tall and skinny QR into row blocks
+ *              merged in a reduction tree. Pivot vectors are zero based: row i was
+ *              interchanged with row ipiv[i] at step i.
+ *
+ * Version:     1.0.6
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the tall and skinny QR factorization "matrixLapackTsqr()", which factorizes
+ *                 row blocks on separate threads and merges their R in a reduction tree, applying
+ *                 Q^T to a right-hand side without forming Q.
+ *
+ * Version:     1.0.5
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. "matrixLapackPotrf()" is now blocked and runs by column blocks as a graph of
+ *                 panel and update tasks, like the LU and QR factorizations, with the trailing
+ *                 updates done by GEMM calls.
+ *
+ * Version:     1.0.4
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The reflectors of each panel of "matrixLapackGeqrf()" are accumulated into a
+ *                 compact WY block reflector I - V * T * V^T, which the trailing column blocks and
+ *                 "matrixLapackOrmqr()" apply by GEMMs instead of one reflector at a time.
+ *
+ * Version:     1.0.3
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. "matrixLapackGetrf()" and "matrixLapackGeqrf()" now run by column blocks as a
+ *                 graph of panel and update tasks on matrixlibrarythreads, with a lookahead that
+ *                 factorizes the next panel while the current trailing update is still running.
+ *
+ * Version:     1.0.2
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the Householder QR factorization "matrixLapackGeqrf()" and the application
+ *                 of its Q by "matrixLapackOrmqr()".
+ *              2. Added the Cholesky factorization "matrixLapackPotrf()" and its solver
+ *                 "matrixLapackPotrs()".
+ *              3. The condition number estimator is shared by "matrixLapackGecon()" and the new
+ *                 "matrixLapackPocon()" and "matrixLapackTrcon()".
+ *
+ * Version:     1.0.1
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. "matrixLapackGetrs()" can solve with the transpose of the factorized matrix.
+ *              2. Added the condition number estimator "matrixLapackGecon()".
+ *
+ * Version:     1.0.0
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Implemented first release version of matrixlibrarylapack.
+ */
+
+#include "matrixlibrarylapack.h"
+#include "matrixlibraryallocator.h"
+#include "matrixlibrarykernels.h"
+#include "matrixlibrarythreads.h"
+#include <algorithm>
+#include <math.h>
+#include <vector>
+
+/**
+ * @brief matrixLapackConditionSystem - Factorized system of a condition number estimate. The
+ *                                      estimator only sees the system through its solve function.
+ */
+struct matrixLapackConditionSystem {
+  /**
+   * @brief solve - Solves A * x = b, or A^T * x = b when trans is true, in place in x.
+   */
+  void (*solve)(const matrixLapackConditionSystem & system, bool trans, double * x);
+
+  /**
+   * @brief n - Size of A.
+   */
+  unsigned long n;
+
+  /**
+   * @brief F - Pointer to the first element of the factorization.
+   */
+  const double * F;
+
+  /**
+   * @brief ldf - Leading dimension (row stride) of the factorization.
+   */
+  unsigned long ldf;
+
+  /**
+   * @brief ipiv - Pivot vector of the factorization, if any.
+   */
+  const unsigned long * ipiv;
+
+  /**
+   * @brief upper - Whether a triangular factor is upper triangular.
+   */
+  bool upper;
+};
+
+/**
+ * @brief matrixLapackTiles - Column blocks of a factorization run as a graph of tasks. The task of
+ *                            index t applies the panel of column block step[t] to column block
+ *                            column[t], or factorizes the panel when both are equal. The tasks of
+ *                            a column block are ordered by step, and the column blocks from left
+ *                            to right, so that the next panel always comes before the wide
+ *                            trailing updates of the current step. This ordering is the lookahead
+ *                            of the factorization: a panel is factorized as soon as its column
+ *                            block is updated, while the other threads still update the columns on
+ *                            its right.
+ */
+struct matrixLapackTiles {
+  /**
+   * @brief m - Row size of A.
+   */
+  unsigned long m;
+
+  /**
+   * @brief n - Column size of A.
+   */
+  unsigned long n;
+
+  /**
+   * @brief k - Number of columns to factorize, min(m, n).
+   */
+  unsigned long k;
+
+  /**
+   * @brief nb - Column size of a block.
+   */
+  unsigned long nb;
+
+  /**
+   * @brief A - Pointer to the first element of the row-major A.
+   */
+  double * A;
+
+  /**
+   * @brief lda - Leading dimension (row stride) of A.
+   */
+  unsigned long lda;
+
+  /**
+   * @brief ipiv - Pivot vector of an LU factorization.
+   */
+  unsigned long * ipiv;
+
+  /**
+   * @brief tau - Scalar factors of the reflectors of a QR factorization.
+   */
+  double * tau;
+
+  /**
+   * @brief blocks - Explicit unit lower triangular top Y and triangular factor T of the block
+   *                 reflector of each panel of a QR factorization, 2 * nb * nb elements per panel.
+   */
+  double * blocks;
+
+  /**
+   * @brief info - One based index of the first zero pivot of an LU factorization, or of the first
+   *              leading minor of a Cholesky factorization that is not positive definite, or zero.
+   */
+  unsigned long info;
+
+  /**
+   * @brief step - Step, that is the panel, of each task.
+   */
+  std::vector<unsigned long> step;
+
+  /**
+   * @brief column - Column block of each task.
+   */
+  std::vector<unsigned long> column;
+};
+
+/**
+ * @brief matrixLapackTsqrBlocks - Row blocks of a tall and skinny QR factorization. Each row block
+ *                                 owns a workspace W of rows + n rows and n + nrhs columns, whose
+ *                                 top n rows hold its current R on the left and its part of
+ *                                 Q^T * B on the right, followed by its scalar factors tau.
+ */
+struct matrixLapackTsqrBlocks {
+  /**
+   * @brief m - Row size of A.
+   */
+  unsigned long m;
+
+  /**
+   * @brief n - Column size of A.
+   */
+  unsigned long n;
+
+  /**
+   * @brief nrhs - Column size of B.
+   */
+  unsigned long nrhs;
+
+  /**
+   * @brief rows - Number of rows of A loaded into a workspace at a time.
+   */
+  unsigned long rows;
+
+  /**
+   * @brief blocks - Number of row blocks.
+   */
+  unsigned long blocks;
+
+  /**
+   * @brief A - Pointer to the first element of the row-major A.
+   */
+  const double * A;
+
+  /**
+   * @brief lda - Leading dimension (row stride) of A.
+   */
+  unsigned long lda;
+
+  /**
+   * @brief B - Pointer to the first element of the row-major B.
+   */
+  const double * B;
+
+  /**
+   * @brief ldb - Leading dimension (row stride) of B.
+   */
+  unsigned long ldb;
+
+  /**
+   * @brief W - Workspaces of the row blocks, one after the other.
+   */
+  double * W;
+
+  /**
+   * @brief size - Number of elements of a workspace, including tau.
+   */
+  unsigned long size;
+
+  /**
+   * @brief distance - Distance between the row blocks merged by a level of the reduction tree.
+   */
+  unsigned long distance;
+};
+
+/// ================================================================================================
+/// STATIC FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief matrixLapackGeconSolve - Solve function of the condition number estimate of an LU
+ *                                 factorization.
+ * @param system                 - The factorized system.
+ * @param trans                  - Solves with A^T when true.
+ * @param x                      - Right-hand side on input and the solution on output.
+ */
+static void matrixLapackGeconSolve(const matrixLapackConditionSystem & system, bool trans,
+                                   double * x) {
+  matrixLapackGetrs(trans, system.n, 1, system.F, system.ldf, system.ipiv, x, 1);
+} // void matrixLapackGeconSolve(const matrixLapackConditionSystem & system, bool trans, double * x)
+
+/**
+ * @brief matrixLapackGetrfPanel - Factorizes the panel of columns jb to je - 1 of an LU
+ *                                 factorization column by column. Pivot rows are only interchanged
+ *                                 within the panel, the other column blocks follow the same
+ *                                 interchanges in their own tasks.
+ * @param m                      - Row size of A.
+ * @param jb                     - First column of the panel.
+ * @param je                     - One past the last column of the panel.
+ * @param A                      - Pointer to the first element of the row-major A.
+ * @param lda                    - Leading dimension (row stride) of A.
+ * @param ipiv                   - Pivot vector of the factorization.
+ * @return                       - Zero if every pivot of the panel is nonzero, otherwise the one
+ *                                 based index of the first exactly zero pivot.
+ */
+static unsigned long matrixLapackGetrfPanel(unsigned long m, unsigned long jb, unsigned long je,
+                                            double * A, unsigned long lda, unsigned long * ipiv) {
+  unsigned long info = 0;
+  for (unsigned long j = jb; j < je; j++) {
+    unsigned long p = j;
+    double largest = fabs(A[j * lda + j]);
+    for (unsigned long i = j + 1; i < m; i++) {
+      double value = fabs(A[i * lda + j]);
+      if (value > largest) {
+        largest = value;
+        p = i;
+      }
+    }
+    ipiv[j] = p;
+    if (largest == 0.0) {
+      if (info == 0)
+        info = j + 1;
+      continue;
+    }
+    if (p != j)
+      std::swap_ranges(A + j * lda + jb, A + j * lda + je, A + p * lda + jb);
+
+    // multipliers of column j, and rank-1 update of the rest of the panel
+    const double * u = A + j * lda;
+    const double r = 1.0 / u[j];
+    for (unsigned long i = j + 1; i < m; i++) {
+      double * a = A + i * lda;
+      const double l = a[j] * r;
+      a[j] = l;
+      for (unsigned long c = j + 1; c < je; c++)
+        a[c] -= l * u[c];
+    }
+  }
+  return info;
+} // unsigned long matrixLapackGetrfPanel(unsigned long m, unsigned long jb, unsigned long je, double * A, unsigned long lda, unsigned long * ipiv)
+
+/**
+ * @brief matrixLapackLacon - Estimates ||A^-1||_1 with the iterative estimator of Hager and Higham
+ *                            used by LAPACK. ||A^-1||_1 is the largest ||A^-1 * x||_1 over the
+ *                            vectors with ||x||_1 = 1, which is climbed from x = (1 / n, ...) by
+ *                            following the gradient sign(A^-1 * x) * A^-1 to a unit vector, for at
+ *                            most five iterations. An alternating test vector guards against the
+ *                            estimate stalling. Each iteration solves with A and A^T for a single
+ *                            vector, so the estimate costs O(n^2).
+ * @param system            - The factorized system, of a nonzero size.
+ * @return                  - The estimate of ||A^-1||_1, which is never larger than the exact
+ *                            value.
+ */
+static double matrixLapackLacon(const matrixLapackConditionSystem & system) {
+  unsigned long n = system.n;
+  double * x = matrixAllocatorMalloc(sizeof(double) * 2 * n);
+  double * z = x + n;
+  std::fill(x, x + n, 1.0 / n);
+  double estimate = 0.0;
+  unsigned long last = n;
+  for (unsigned long iteration = 0; iteration < 5; iteration++) {
+    system.solve(system, false, x);
+    double sum = 0.0;
+    for (unsigned long i = 0; i < n; i++)
+      sum += fabs(x[i]);
+    if ((iteration > 0) && (sum <= estimate))
+      break;
+    estimate = sum;
+
+    for (unsigned long i = 0; i < n; i++)
+      z[i] = (x[i] >= 0.0) ? 1.0 : -1.0;
+    system.solve(system, true, z);
+    unsigned long j = 0;
+    for (unsigned long i = 1; i < n; i++) {
+      if (fabs(z[i]) > fabs(z[j]))
+        j = i;
+    }
+    if (j == last)
+      break;
+    last = j;
+    std::fill(x, x + n, 0.0);
+    x[j] = 1.0;
+  }
+
+  for (unsigned long i = 0; i < n; i++)
+    x[i] = ((i % 2 == 0) ? 1.0 : -1.0) * (1.0 + ((n > 1) ? double(i) / (n - 1) : 0.0));
+  system.solve(system, false, x);
+  double sum = 0.0;
+  for (unsigned long i = 0; i < n; i++)
+    sum += fabs(x[i]);
+  sum = 2.0 * sum / (3.0 * n);
+  if (sum > estimate)
+    estimate = sum;
+  matrixAllocatorFree(x);
+  return estimate;
+} // double matrixLapackLacon(const matrixLapackConditionSystem & system)
+
+/**
+ * @brief matrixLapackLarf - Applies a Householder reflector H = I - tau * v * v^T from the left to
+ *                           a row-major block, C = H * C, where v = (1, v(1), ..., v(m - 1)). The
+ *                           product w = v^T * C is accumulated by a GEVM and C is then updated by
+ *                           a rank-1 GEMM.
+ * @param m                - Row size of C and size of v.
+ * @param n                - Column size of C.
+ * @param v                - Pointer to the implicit first element of v, which is not read.
+ * @param incv             - Distance between the elements of v.
+ * @param tau              - Scalar factor of the reflector.
+ * @param C                - Pointer to the first element of C.
+ * @param ldc              - Leading dimension (row stride) of C.
+ * @param w                - Workspace of n elements.
+ */
+static void matrixLapackLarf(unsigned long m, unsigned long n, const double * v, unsigned long incv,
+                             double tau, double * C, unsigned long ldc, double * w) {
+  if ((tau == 0.0) || (n == 0))
+    return;
+
+  std::copy(C, C + n, w);
+  if (m > 1)
+    matrixKernelsGevm(m - 1, n, 1.0, C + ldc, ldc, v + incv, incv, 1.0, w);
+  for (unsigned long j = 0; j < n; j++)
+    C[j] -= tau * w[j];
+  if (m > 1)
+    matrixKernelsGemm(m - 1, n, 1, -tau, v + incv, incv, 1, w, n, 1, 1.0, C + ldc, ldc);
+} // void matrixLapackLarf(unsigned long m, unsigned long n, const double * v, unsigned long incv, double tau, double * C, unsigned long ldc, double * w)
+
+/**
+ * @brief matrixLapackLarfb - Applies a block reflector H = I - V * T * V^T, or its transpose, from
+ *                            the left to a row-major block, C = H * C or C = H^T * C. V is the
+ *                            (m x k) block of Householder vectors of a panel, whose unit lower
+ *                            triangular top (k x k) is read from the explicit copy Y made by
+ *                            "matrixLapackLarft()", and whose rows below are read in place. The
+ *                            update is W = V^T * C, W = T * W or T^T * W, and C = C - V * W, five
+ *                            GEMMs of inner size k, instead of k rank-1 updates of C.
+ * @param trans             - Applies H^T when true.
+ * @param m                 - Row size of C and of V.
+ * @param n                 - Column size of C.
+ * @param k                 - Number of reflectors, the column size of V.
+ * @param V                 - Pointer to the first element of V.
+ * @param ldv               - Leading dimension (row stride) of V.
+ * @param Y                 - Explicit unit lower triangular top of V, with zeros above the
+ *                            diagonal.
+ * @param T                 - Upper triangular factor of the block reflector, with zeros below the
+ *                            diagonal.
+ * @param ldt               - Leading dimension (row stride) of Y and T.
+ * @param C                 - Pointer to the first element of C.
+ * @param ldc               - Leading dimension (row stride) of C.
+ * @param W                 - Workspace of 2 * k * n elements.
+ */
+static void matrixLapackLarfb(bool trans, unsigned long m, unsigned long n, unsigned long k,
+                              const double * V, unsigned long ldv, const double * Y,
+                              const double * T, unsigned long ldt, double * C, unsigned long ldc,
+                              double * W) {
+  if ((k == 0) || (n == 0))
+    return;
+
+  double * Z = W + k * n;
+  const double * V2 = V + k * ldv;
+  double * C2 = C + k * ldc;
+  matrixKernelsGemm(k, n, k, 1.0, Y, 1, ldt, C, ldc, 1, 0.0, W, n);
+  if (m > k)
+    matrixKernelsGemm(k, n, m - k, 1.0, V2, 1, ldv, C2, ldc, 1, 1.0, W, n);
+  if (trans)
+    matrixKernelsGemm(k, n, k, 1.0, T, 1, ldt, W, n, 1, 0.0, Z, n);
+  else
+    matrixKernelsGemm(k, n, k, 1.0, T, ldt, 1, W, n, 1, 0.0, Z, n);
+  matrixKernelsGemm(k, n, k, -1.0, Y, ldt, 1, Z, n, 1, 1.0, C, ldc);
+  if (m > k)
+    matrixKernelsGemm(m - k, n, k, -1.0, V2, ldv, 1, Z, n, 1, 1.0, C2, ldc);
+} // void matrixLapackLarfb(bool trans, unsigned long m, unsigned long n, unsigned long k, const double * V, unsigned long ldv, const double * Y, const double * T, unsigned long ldt, double * C, unsigned long ldc, double * W)
+
+/**
+ * @brief matrixLapackLarfg - Generates the Householder reflector H = I - tau * v * v^T that maps a
+ *                            vector x onto beta * e(1), with the conventions of LAPACK, v(0) = 1
+ *                            and beta = -sign(x(0)) * ||x||. The reflector is the identity, with
+ *                            tau = 0, when x(1:n) is zero.
+ * @param n                 - Size of x.
+ * @param x                 - Pointer to the first element of x, overwritten by beta and then by
+ *                            v(1:n).
+ * @param incx              - Distance between the elements of x.
+ * @return                  - The scalar factor tau.
+ */
+static double matrixLapackLarfg(unsigned long n, double * x, unsigned long incx) {
+  double alpha = x[0];
+  double norm = 0.0;
+  for (unsigned long i = 1; i < n; i++)
+    norm = hypot(norm, x[i * incx]);
+  if (norm == 0.0)
+    return 0.0;
+
+  double beta = -copysign(hypot(alpha, norm), alpha);
+  const double scale = 1.0 / (alpha - beta);
+  for (unsigned long i = 1; i < n; i++)
+    x[i * incx] *= scale;
+  x[0] = beta;
+  return (beta - alpha) / beta;
+} // double matrixLapackLarfg(unsigned long n, double * x, unsigned long incx)
+
+/**
+ * @brief matrixLapackLarft - Forms the compact WY representation H(0) * ... * H(k - 1) =
+ *                            I - V * T * V^T of the reflectors of a panel, where T is upper
+ *                            triangular, with the recurrence of LAPACK: T(i, i) = tau[i] and
+ *                            T(0:i, i) = -tau[i] * T(0:i, 0:i) * V(:, 0:i)^T * v(i). The unit
+ *                            lower triangular top of V is also copied to Y with its implicit
+ *                            ones and zeros, so that "matrixLapackLarfb()" can read it by GEMM.
+ * @param m                 - Row size of V, at least k.
+ * @param k                 - Number of reflectors, the column size of V.
+ * @param V                 - Pointer to the first element of V, the diagonal element of the first
+ *                            reflector of the panel.
+ * @param ldv               - Leading dimension (row stride) of V.
+ * @param tau               - Scalar factors of the reflectors.
+ * @param Y                 - Output explicit top (k x k) of V.
+ * @param T                 - Output triangular factor (k x k).
+ * @param ldt               - Leading dimension (row stride) of Y and T.
+ * @param w                 - Workspace of k elements.
+ */
+static void matrixLapackLarft(unsigned long m, unsigned long k, const double * V,
+                              unsigned long ldv, const double * tau, double * Y, double * T,
+                              unsigned long ldt, double * w) {
+  for (unsigned long r = 0; r < k; r++) {
+    std::copy(V + r * ldv, V + r * ldv + r, Y + r * ldt);
+    std::fill(Y + r * ldt + r, Y + r * ldt + k, 0.0);
+    Y[r * ldt + r] = 1.0;
+    std::fill(T + r * ldt, T + r * ldt + k, 0.0);
+  }
+
+  const double * V2 = V + k * ldv;
+  for (unsigned long i = 0; i < k; i++) {
+    T[i * ldt + i] = tau[i];
+    if ((i == 0) || (tau[i] == 0.0))
+      continue;
+
+    // w = V(:, 0:i)^T * v(i), where v(i) is zero above row i
+    for (unsigned long c = 0; c < i; c++) {
+      double sum = 0.0;
+      for (unsigned long r = i; r < k; r++)
+        sum += Y[r * ldt + c] * Y[r * ldt + i];
+      w[c] = sum;
+    }
+    if (m > k)
+      matrixKernelsGevm(m - k, i, 1.0, V2, ldv, V2 + i, ldv, 1.0, w);
+
+    for (unsigned long r = 0; r < i; r++) {
+      double sum = 0.0;
+      for (unsigned long c = r; c < i; c++)
+        sum += T[r * ldt + c] * w[c];
+      T[r * ldt + i] = -tau[i] * sum;
+    }
+  }
+} // void matrixLapackLarft(unsigned long m, unsigned long k, const double * V, unsigned long ldv, const double * tau, double * Y, double * T, unsigned long ldt, double * w)
+
+/**
+ * @brief matrixLapackLaswp - Applies the row interchanges of a pivot vector to a row-major block,
+ *                            in the order they were made, or in the reverse order to undo them.
+ * @param k                 - Number of interchanges to apply.
+ * @param n                 - Column size of A.
+ * @param A                 - Pointer to the first element of A.
+ * @param lda               - Leading dimension (row stride) of A.
+ * @param ipiv              - Pivot vector.
+ * @param reverse           - Applies the interchanges in the reverse order when true.
+ */
+static void matrixLapackLaswp(unsigned long k, unsigned long n, double * A, unsigned long lda,
+                              const unsigned long * ipiv, bool reverse) {
+  for (unsigned long s = 0; s < k; s++) {
+    unsigned long i = reverse ? k - 1 - s : s;
+    if (ipiv[i] != i)
+      std::swap_ranges(A + i * lda, A + i * lda + n, A + ipiv[i] * lda);
+  }
+} // void matrixLapackLaswp(unsigned long k, unsigned long n, double * A, unsigned long lda, const unsigned long * ipiv, bool reverse)
+
+/**
+ * @brief matrixLapackGeqrfTask - Task of the QR factorization. The panel task generates the
+ *                                reflectors of its columns, applying each of them to the rest of
+ *                                the panel only, and then forms their block reflector with
+ *                                "matrixLapackLarft()" in the blocks of the panel. An update task
+ *                                applies the block reflector of a panel to a column block on its
+ *                                right by GEMMs, see "matrixLapackLarfb()".
+ * @param context               - The column blocks of the factorization.
+ * @param t                     - Index of the task.
+ */
+static void matrixLapackGeqrfTask(void * context, unsigned long t) {
+  matrixLapackTiles & tiles = * (matrixLapackTiles *)context;
+  unsigned long s = tiles.step[t];
+  unsigned long nb = tiles.nb;
+  unsigned long jb = s * nb;
+  unsigned long je = std::min(jb + nb, tiles.k);
+  unsigned long cb = tiles.column[t] * nb;
+  unsigned long ce = std::min(cb + nb, tiles.n);
+  double * A = tiles.A;
+  unsigned long lda = tiles.lda;
+  double * V = A + jb * lda + jb;
+  double * Y = tiles.blocks + s * 2 * nb * nb;
+  double * T = Y + nb * nb;
+
+  double * w = matrixAllocatorMalloc(sizeof(double) * 2 * nb * nb);
+  if (cb == jb) {
+    for (unsigned long i = jb; i < je; i++) {
+      double * a = A + i * lda + i;
+      tiles.tau[i] = matrixLapackLarfg(tiles.m - i, a, lda);
+      matrixLapackLarf(tiles.m - i, je - i - 1, a, lda, tiles.tau[i], a + 1, lda, w);
+    }
+    matrixLapackLarft(tiles.m - jb, je - jb, V, lda, tiles.tau + jb, Y, T, nb, w);
+
+    // the last panel of a wide matrix is narrower than its column block
+    cb = je;
+  }
+  matrixLapackLarfb(true, tiles.m - jb, ce - cb, je - jb, V, lda, Y, T, nb,
+                    A + jb * lda + cb, lda, w);
+  matrixAllocatorFree(w);
+} // void matrixLapackGeqrfTask(void * context, unsigned long t)
+
+/**
+ * @brief matrixLapackGetrfSwapLeft - Applies the row interchanges of the later panels of an LU
+ *                                    factorization to the columns of L of a panel. It runs once
+ *                                    the whole factorization is done.
+ * @param context                   - The column blocks of the factorization.
+ * @param s                         - Index of the panel.
+ */
+static void matrixLapackGetrfSwapLeft(void * context, unsigned long s) {
+  matrixLapackTiles & tiles = * (matrixLapackTiles *)context;
+  unsigned long jb = s * tiles.nb;
+  unsigned long je = std::min(jb + tiles.nb, tiles.k);
+  double * A = tiles.A;
+  unsigned long lda = tiles.lda;
+  for (unsigned long i = je; i < tiles.k; i++) {
+    if (tiles.ipiv[i] != i)
+      std::swap_ranges(A + i * lda + jb, A + i * lda + je, A + tiles.ipiv[i] * lda + jb);
+  }
+} // void matrixLapackGetrfSwapLeft(void * context, unsigned long s)
+
+/**
+ * @brief matrixLapackGetrfUpdate - Applies a factorized panel of an LU factorization to the
+ *                                  columns cb to ce - 1 on its right: their rows are interchanged
+ *                                  as in the panel, their rows of U are solved by a TRSM, and
+ *                                  the rows below are updated by a GEMM.
+ * @param tiles                   - The column blocks of the factorization.
+ * @param s                       - Index of the panel.
+ * @param cb                      - First column to update.
+ * @param ce                      - One past the last column to update.
+ */
+static void matrixLapackGetrfUpdate(matrixLapackTiles & tiles, unsigned long s, unsigned long cb,
+                                    unsigned long ce) {
+  unsigned long jb = s * tiles.nb;
+  unsigned long je = std::min(jb + tiles.nb, tiles.k);
+  double * A = tiles.A;
+  unsigned long lda = tiles.lda;
+  if (cb >= ce)
+    return;
+
+  for (unsigned long i = jb; i < je; i++) {
+    if (tiles.ipiv[i] != i)
+      std::swap_ranges(A + i * lda + cb, A + i * lda + ce, A + tiles.ipiv[i] * lda + cb);
+  }
+
+  // U12 = L11^-1 * A12, then A22 = A22 - L21 * U12
+  matrixKernelsTrsm(false, true, je - jb, ce - cb, A + jb * lda + jb, lda, 1, A + jb * lda + cb,
+                    lda);
+  if (je < tiles.m)
+    matrixKernelsGemm(tiles.m - je, ce - cb, je - jb, -1.0, A + je * lda + jb, lda, 1,
+                      A + jb * lda + cb, lda, 1, 1.0, A + je * lda + cb, lda);
+} // void matrixLapackGetrfUpdate(matrixLapackTiles & tiles, unsigned long s, unsigned long cb, unsigned long ce)
+
+/**
+ * @brief matrixLapackGetrfTask - Task of the LU factorization. The panel task factorizes its
+ *                                columns, and applies them to the rest of its column block when
+ *                                the block is wider than the panel. An update task applies a
+ *                                panel to a column block on its right.
+ * @param context               - The column blocks of the factorization.
+ * @param t                     - Index of the task.
+ */
+static void matrixLapackGetrfTask(void * context, unsigned long t) {
+  matrixLapackTiles & tiles = * (matrixLapackTiles *)context;
+  unsigned long s = tiles.step[t];
+  unsigned long cb = tiles.column[t] * tiles.nb;
+  unsigned long ce = std::min(cb + tiles.nb, tiles.n);
+  if (s != tiles.column[t]) {
+    matrixLapackGetrfUpdate(tiles, s, cb, ce);
+    return;
+  }
+
+  unsigned long je = std::min(cb + tiles.nb, tiles.k);
+  unsigned long info = matrixLapackGetrfPanel(tiles.m, cb, je, tiles.A, tiles.lda, tiles.ipiv);
+  if (tiles.info == 0)
+    tiles.info = info;
+  matrixLapackGetrfUpdate(tiles, s, je, ce);
+} // void matrixLapackGetrfTask(void * context, unsigned long t)
+
+/**
+ * @brief matrixLapackPoconSolve - Solve function of the condition number estimate of a Cholesky
+ *                                 factorization. A is symmetric, so trans makes no difference.
+ * @param system                 - The factorized system.
+ * @param trans                  - Unused.
+ * @param x                      - Right-hand side on input and the solution on output.
+ */
+static void matrixLapackPoconSolve(const matrixLapackConditionSystem & system, bool trans,
+                                   double * x) {
+  (void)trans;
+  matrixLapackPotrs(system.n, 1, system.F, system.ldf, x, 1);
+} // void matrixLapackPoconSolve(const matrixLapackConditionSystem & system, bool trans, double * x)
+
+/**
+ * @brief matrixLapackPotf2 - Unblocked Cholesky factorization of a diagonal block, left-looking
+ *                            one column at a time: the column below the diagonal is updated with
+ *                            the columns already computed by a GEMV over the contiguous rows of
+ *                            L. Only the lower triangle of A is read and written.
+ * @param n                 - Size of A.
+ * @param A                 - Pointer to the first element of the row-major A.
+ * @param lda               - Leading dimension (row stride) of A.
+ * @return                  - Zero on success, otherwise the one based index of the first leading
+ *                            minor that is not positive definite, at which the factorization
+ *                            stopped.
+ */
+static unsigned long matrixLapackPotf2(unsigned long n, double * A, unsigned long lda) {
+  for (unsigned long j = 0; j < n; j++) {
+    double * l = A + j * lda;
+    double diagonal = l[j];
+    for (unsigned long p = 0; p < j; p++)
+      diagonal -= l[p] * l[p];
+    if (!(diagonal > 0.0))
+      return j + 1;
+    diagonal = sqrt(diagonal);
+    l[j] = diagonal;
+    if (j + 1 == n)
+      continue;
+
+    // L(j+1:n, j) = (A(j+1:n, j) - L(j+1:n, 0:j) * L(j, 0:j)^T) / L(j, j)
+    if (j > 0)
+      matrixKernelsGemv(n - j - 1, j, -1.0, l + lda, lda, l, 1, 1.0, l + lda + j, lda);
+    const double r = 1.0 / diagonal;
+    for (unsigned long i = j + 1; i < n; i++)
+      A[i * lda + j] *= r;
+  }
+  return 0;
+} // unsigned long matrixLapackPotf2(unsigned long n, double * A, unsigned long lda)
+
+/**
+ * @brief matrixLapackPotrfTask - Task of the Cholesky factorization. The panel task factorizes its
+ *                                diagonal block by "matrixLapackPotf2()" and solves the rows of
+ *                                L below it by a TRSM with L^T on the right. An update task
+ *                                subtracts the product of the panel with its own rows,
+ *                                L(cb:n, panel) * L(cb:ce, panel)^T, from a column block on its
+ *                                right by a GEMM. The diagonal block of the column block goes
+ *                                through a workspace, so that its upper triangle is not written.
+ *                                Once a panel fails, the later panels are not factorized.
+ * @param context               - The column blocks of the factorization.
+ * @param t                     - Index of the task.
+ */
+static void matrixLapackPotrfTask(void * context, unsigned long t) {
+  matrixLapackTiles & tiles = * (matrixLapackTiles *)context;
+  unsigned long n = tiles.n;
+  unsigned long jb = tiles.step[t] * tiles.nb;
+  unsigned long je = std::min(jb + tiles.nb, n);
+  double * A = tiles.A;
+  unsigned long lda = tiles.lda;
+  double * L = A + jb * lda + jb;
+
+  if (tiles.step[t] == tiles.column[t]) {
+    if (tiles.info != 0)
+      return;
+    unsigned long info = matrixLapackPotf2(je - jb, L, lda);
+    if (info != 0) {
+      tiles.info = jb + info;
+      return;
+    }
+    if (je < n)
+      matrixKernelsTrsmRight(true, false, n - je, je - jb, L, 1, lda, A + je * lda + jb, lda);
+    return;
+  }
+
+  unsigned long cb = tiles.column[t] * tiles.nb;
+  unsigned long ce = std::min(cb + tiles.nb, n);
+  unsigned long kb = je - jb;
+  unsigned long nc = ce - cb;
+  const double * Lc = A + cb * lda + jb;
+  double * W = matrixAllocatorMalloc(sizeof(double) * nc * nc);
+  matrixKernelsGemm(nc, nc, kb, 1.0, Lc, lda, 1, Lc, 1, lda, 0.0, W, nc);
+  for (unsigned long i = 0; i < nc; i++) {
+    double * a = A + (cb + i) * lda + cb;
+    for (unsigned long j = 0; j <= i; j++)
+      a[j] -= W[i * nc + j];
+  }
+  matrixAllocatorFree(W);
+  if (ce < n)
+    matrixKernelsGemm(n - ce, nc, kb, -1.0, A + ce * lda + jb, lda, 1, Lc, 1, lda, 1.0,
+                      A + ce * lda + cb, lda);
+} // void matrixLapackPotrfTask(void * context, unsigned long t)
+
+/**
+ * @brief matrixLapackTileGraph - Lists the tasks of a factorization by column blocks, see
+ *                                "matrixLapackTiles", and builds their graph. Each task waits for
+ *                                the previous task of its column block and for the panel it
+ *                                applies.
+ * @param tiles                 - The column blocks of the factorization, whose tasks are listed.
+ * @return                      - The graph of the tasks.
+ */
+static matrixThreadsGraph matrixLapackTileGraph(matrixLapackTiles & tiles) {
+  unsigned long blocks = (tiles.n + tiles.nb - 1) / tiles.nb;
+  unsigned long panels = (tiles.k + tiles.nb - 1) / tiles.nb;
+  std::vector<unsigned long> panel(panels);
+  tiles.step.clear();
+  tiles.column.clear();
+  for (unsigned long j = 0; j < blocks; j++) {
+    for (unsigned long s = 0; s < std::min(j, panels); s++) {
+      tiles.step.push_back(s);
+      tiles.column.push_back(j);
+    }
+    if (j < panels) {
+      panel[j] = tiles.step.size();
+      tiles.step.push_back(j);
+      tiles.column.push_back(j);
+    }
+  }
+
+  matrixThreadsGraph graph(tiles.step.size());
+  for (unsigned long t = 0; t < tiles.step.size(); t++) {
+    if ((t > 0) && (tiles.column[t - 1] == tiles.column[t]))
+      graph.addDependency(t - 1, t);
+    if (tiles.step[t] != tiles.column[t])
+      graph.addDependency(panel[tiles.step[t]], t);
+  }
+  return graph;
+} // matrixThreadsGraph matrixLapackTileGraph(matrixLapackTiles & tiles)
+
+/**
+ * @brief matrixLapackTrconSolve - Solve function of the condition number estimate of a triangular
+ *                                 matrix. T^T is read in place through swapped strides.
+ * @param system                 - The triangular system.
+ * @param trans                  - Solves with T^T when true.
+ * @param x                      - Right-hand side on input and the solution on output.
+ */
+static void matrixLapackTrconSolve(const matrixLapackConditionSystem & system, bool trans,
+                                   double * x) {
+  if (trans)
+    matrixKernelsTrsm(!system.upper, false, system.n, 1, system.F, 1, system.ldf, x, 1);
+  else
+    matrixKernelsTrsm(system.upper, false, system.n, 1, system.F, system.ldf, 1, x, 1);
+} // void matrixLapackTrconSolve(const matrixLapackConditionSystem & system, bool trans, double * x)
+
+/**
+ * @brief matrixLapackTsqrFactorize - Factorizes the h rows of a workspace of a tall and skinny QR
+ *                                    factorization, applies Q^T to its right-hand side columns,
+ *                                    and clears the Householder vectors from its top n rows, which
+ *                                    are left holding R and the matching rows of Q^T * B.
+ * @param blocks                    - The row blocks of the factorization.
+ * @param W                         - The workspace.
+ * @param h                         - Number of rows to factorize, at least n.
+ */
+static void matrixLapackTsqrFactorize(const matrixLapackTsqrBlocks & blocks, double * W,
+                                      unsigned long h) {
+  unsigned long n = blocks.n;
+  unsigned long ldw = n + blocks.nrhs;
+  double * tau = W + (blocks.rows + n) * ldw;
+  matrixLapackGeqrf(h, n, W, ldw, tau);
+  matrixLapackOrmqr(true, h, blocks.nrhs, n, W, ldw, tau, W + n, ldw);
+  for (unsigned long i = 1; i < n; i++)
+    std::fill(W + i * ldw, W + i * ldw + i, 0.0);
+} // void matrixLapackTsqrFactorize(const matrixLapackTsqrBlocks & blocks, double * W, unsigned long h)
+
+/**
+ * @brief matrixLapackTsqrLeaf - Task of a row block of a tall and skinny QR factorization. The
+ *                               rows of the block are loaded into its workspace a few at a time,
+ *                               below the R of the rows already seen, and the stack is factorized
+ *                               again, so that the workspace does not grow with the row size.
+ * @param context              - The row blocks of the factorization.
+ * @param b                    - Index of the row block.
+ */
+static void matrixLapackTsqrLeaf(void * context, unsigned long b) {
+  const matrixLapackTsqrBlocks & blocks = * (const matrixLapackTsqrBlocks *)context;
+  unsigned long n = blocks.n;
+  unsigned long nrhs = blocks.nrhs;
+  unsigned long ldw = n + nrhs;
+  double * W = blocks.W + b * blocks.size;
+  unsigned long re = blocks.m * (b + 1) / blocks.blocks;
+  unsigned long top = 0;
+  for (unsigned long r = blocks.m * b / blocks.blocks; r < re; ) {
+    unsigned long count = std::min(blocks.rows, re - r);
+    for (unsigned long i = 0; i < count; i++) {
+      double * w = W + (top + i) * ldw;
+      const double * a = blocks.A + (r + i) * blocks.lda;
+      std::copy(a, a + n, w);
+      if (nrhs > 0) {
+        const double * c = blocks.B + (r + i) * blocks.ldb;
+        std::copy(c, c + nrhs, w + n);
+      }
+    }
+    matrixLapackTsqrFactorize(blocks, W, top + count);
+    top = n;
+    r += count;
+  }
+} // void matrixLapackTsqrLeaf(void * context, unsigned long b)
+
+/**
+ * @brief matrixLapackTsqrMerge - Task of a node of the reduction tree of a tall and skinny QR
+ *                                factorization. The R of a row block is stacked below the R of
+ *                                the row block blocks.distance before it, with their parts of
+ *                                Q^T * B, and the stack of 2 * n rows is factorized again.
+ * @param context               - The row blocks of the factorization.
+ * @param p                     - Index of the pair of row blocks of the level.
+ */
+static void matrixLapackTsqrMerge(void * context, unsigned long p) {
+  const matrixLapackTsqrBlocks & blocks = * (const matrixLapackTsqrBlocks *)context;
+  unsigned long b = 2 * p * blocks.distance;
+  unsigned long n = blocks.n;
+  unsigned long ldw = n + blocks.nrhs;
+  double * W = blocks.W + b * blocks.size;
+  const double * V = blocks.W + (b + blocks.distance) * blocks.size;
+  std::copy(V, V + n * ldw, W + n * ldw);
+  matrixLapackTsqrFactorize(blocks, W, 2 * n);
+} // void matrixLapackTsqrMerge(void * context, unsigned long p)
+
+/// ================================================================================================
+/// EXTERNAL FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief matrixLapackGecon - Estimates the reciprocal of the condition number in the 1-norm of a
+ *                            square matrix from its LU factorization, with the iterative
+ *                            estimator of Hager and Higham used by LAPACK, see
+ *                            "matrixLapackLacon()".
+ * @param n                 - Size of A.
+ * @param LU                - Pointer to the first element of the factorization.
+ * @param ldlu              - Leading dimension (row stride) of the factorization.
+ * @param ipiv              - Pivot vector of the factorization.
+ * @param norm              - The 1-norm of A, see "matrixLapackNorm1()".
+ * @return                  - The estimate of 1 / (||A||_1 * ||A^-1||_1), zero if A is singular.
+ */
+double matrixLapackGecon(unsigned long n, const double * LU, unsigned long ldlu,
+                         const unsigned long * ipiv, double norm) {
+  if (n == 0)
+    return 1.0;
+  if (norm == 0.0)
+    return 0.0;
+  for (unsigned long i = 0; i < n; i++) {
+    if (LU[i * ldlu + i] == 0.0)
+      return 0.0;
+  }
+
+  matrixLapackConditionSystem system = {matrixLapackGeconSolve, n, LU, ldlu, ipiv, false};
+  return 1.0 / (norm * matrixLapackLacon(system));
+} // double matrixLapackGecon(unsigned long n, const double * LU, unsigned long ldlu, const unsigned long * ipiv, double norm)
+
+/**
+ * @brief matrixLapackGeqrf - Householder QR factorization, A = Q * R, where A is (m x n). A is
+ *                            overwritten by R on and above the diagonal, and by the Householder
+ *                            vectors below it. The factorization runs by column blocks of
+ *                            MATRIXLAPACK_GEQRF_NB columns as a graph of tasks, see
+ *                            "matrixLapackTiles": each panel generates its reflectors and forms
+ *                            their compact WY block reflector, which the column blocks on its
+ *                            right apply in parallel by GEMMs.
+ * @param m                 - Row size of A.
+ * @param n                 - Column size of A.
+ * @param A                 - Pointer to the first element of the row-major A.
+ * @param lda               - Leading dimension (row stride) of A.
+ * @param tau               - Scalar factors of the min(m, n) reflectors, filled by the
+ *                            factorization.
+ */
+void matrixLapackGeqrf(unsigned long m, unsigned long n, double * A, unsigned long lda,
+                       double * tau) {
+  unsigned long k = m < n ? m : n;
+  if (k == 0)
+    return;
+
+  const unsigned long nb = MATRIXLAPACK_GEQRF_NB;
+  double * blocks = matrixAllocatorMalloc(sizeof(double) * 2 * nb * nb * ((k + nb - 1) / nb));
+  matrixLapackTiles tiles = {m, n, k, nb, A, lda, NULL, tau, blocks, 0,
+                             std::vector<unsigned long>(), std::vector<unsigned long>()};
+  matrixLapackTileGraph(tiles).run(matrixLapackGeqrfTask, &tiles);
+  matrixAllocatorFree(blocks);
+} // void matrixLapackGeqrf(unsigned long m, unsigned long n, double * A, unsigned long lda, double * tau)
+
+/**
+ * @brief matrixLapackGetrf - LU factorization with partial pivoting, P * A = L * U, where A is
+ *                            (m x n), L is unit lower triangular (trapezoidal if m > n) and U is
+ *                            upper triangular (trapezoidal if m < n). A is overwritten by L and U,
+ *                            without the unit diagonal of L. The factorization is right-looking
+ *                            by column blocks of MATRIXLAPACK_GETRF_NB columns, run as a graph of
+ *                            tasks, see "matrixLapackTiles": each panel is factorized, and every
+ *                            column block on its right then follows its row interchanges, solves
+ *                            its rows of U by a TRSM and updates the rows below by a GEMM, in
+ *                            parallel with the other blocks and with the next panel. The
+ *                            interchanges of the later panels are applied to the columns of L at
+ *                            the end.
+ * @param m                 - Row size of A.
+ * @param n                 - Column size of A.
+ * @param A                 - Pointer to the first element of the row-major A.
+ * @param lda               - Leading dimension (row stride) of A.
+ * @param ipiv              - Pivot vector of min(m, n) elements, filled by the factorization.
+ * @return                  - Zero if every pivot is nonzero, otherwise the one based index of the
+ *                            first exactly zero pivot, in which case U is singular. The
+ *                            factorization is still completed.
+ */
+unsigned long matrixLapackGetrf(unsigned long m, unsigned long n, double * A, unsigned long lda,
+                                unsigned long * ipiv) {
+  unsigned long k = m < n ? m : n;
+  if (k == 0)
+    return 0;
+
+  matrixLapackTiles tiles = {m, n, k, MATRIXLAPACK_GETRF_NB, A, lda, ipiv, NULL, NULL, 0,
+                             std::vector<unsigned long>(), std::vector<unsigned long>()};
+  matrixLapackTileGraph(tiles).run(matrixLapackGetrfTask, &tiles);
+  unsigned long panels = (k + tiles.nb - 1) / tiles.nb;
+  if (panels > 1)
+    matrixThreadsParallelFor(panels - 1, matrixLapackGetrfSwapLeft, &tiles);
+  return tiles.info;
+} // unsigned long matrixLapackGetrf(unsigned long m, unsigned long n, double * A, unsigned long lda, unsigned long * ipiv)
+
+/**
+ * @brief matrixLapackGetrs - Solves A * X = B, or A^T * X = B, from the LU factorization of
+ *                            "matrixLapackGetrf()", where A is (n x n) and B is (n x nrhs). B is
+ *                            overwritten by X. All the right-hand sides are solved together by
+ *                            blocked triangular solves, which read L and U in place for A^T.
+ * @param trans             - Solves with A^T when true.
+ * @param n                 - Size of A and row size of B.
+ * @param nrhs              - Column size of B, the number of right-hand sides.
+ * @param LU                - Pointer to the first element of the factorization.
+ * @param ldlu              - Leading dimension (row stride) of the factorization.
+ * @param ipiv              - Pivot vector of the factorization.
+ * @param B                 - Pointer to the first element of the row-major B.
+ * @param ldb               - Leading dimension (row stride) of B.
+ */
+void matrixLapackGetrs(bool trans, unsigned long n, unsigned long nrhs, const double * LU,
+                       unsigned long ldlu, const unsigned long * ipiv, double * B,
+                       unsigned long ldb) {
+  if (!trans) {
+    // L * U * X = P * B
+    matrixLapackLaswp(n, nrhs, B, ldb, ipiv, false);
+    matrixKernelsTrsm(false, true, n, nrhs, LU, ldlu, 1, B, ldb);
+    matrixKernelsTrsm(true, false, n, nrhs, LU, ldlu, 1, B, ldb);
+    return;
+  }
+
+  // U^T * L^T * (P * X) = B, with U^T and L^T read in place through swapped strides
+  matrixKernelsTrsm(false, false, n, nrhs, LU, 1, ldlu, B, ldb);
+  matrixKernelsTrsm(true, true, n, nrhs, LU, 1, ldlu, B, ldb);
+  matrixLapackLaswp(n, nrhs, B, ldb, ipiv, true);
+} // void matrixLapackGetrs(bool trans, unsigned long n, unsigned long nrhs, const double * LU, unsigned long ldlu, const unsigned long * ipiv, double * B, unsigned long ldb)
+
+/**
+ * @brief matrixLapackNorm1 - Computes the 1-norm of a row-major block, that is its largest
+ *                            absolute column sum. The column sums are accumulated row by row.
+ * @param m                 - Row size of A.
+ * @param n                 - Column size of A.
+ * @param A                 - Pointer to the first element of A.
+ * @param lda               - Leading dimension (row stride) of A.
+ * @return                  - The 1-norm of A.
+ */
+double matrixLapackNorm1(unsigned long m, unsigned long n, const double * A, unsigned long lda) {
+  if ((m == 0) || (n == 0))
+    return 0.0;
+
+  double * sum = matrixAllocatorMalloc(sizeof(double) * n);
+  std::fill(sum, sum + n, 0.0);
+  for (unsigned long i = 0; i < m; i++) {
+    const double * a = A + i * lda;
+    for (unsigned long j = 0; j < n; j++)
+      sum[j] += fabs(a[j]);
+  }
+  double norm = * std::max_element(sum, sum + n);
+  matrixAllocatorFree(sum);
+  return norm;
+} // double matrixLapackNorm1(unsigned long m, unsigned long n, const double * A, unsigned long lda)
+
+/**
+ * @brief matrixLapackOrmqr - Multiplies a block by the Q of "matrixLapackGeqrf()" from the left,
+ *                            C = Q * C or C = Q^T * C, without forming Q. The reflectors are
+ *                            applied by panels of MATRIXLAPACK_GEQRF_NB as block reflectors, see
+ *                            "matrixLapackLarfb()": Q^T applies the panels in the order they were
+ *                            generated, and Q in the reverse order.
+ * @param trans             - Multiplies by Q^T when true.
+ * @param m                 - Row size of C and of the factorized matrix.
+ * @param nrhs              - Column size of C.
+ * @param k                 - Number of reflectors of Q.
+ * @param A                 - Pointer to the first element of the factorization.
+ * @param lda               - Leading dimension (row stride) of the factorization.
+ * @param tau               - Scalar factors of the reflectors.
+ * @param C                 - Pointer to the first element of the row-major C.
+ * @param ldc               - Leading dimension (row stride) of C.
+ */
+void matrixLapackOrmqr(bool trans, unsigned long m, unsigned long nrhs, unsigned long k,
+                       const double * A, unsigned long lda, const double * tau, double * C,
+                       unsigned long ldc) {
+  if ((k == 0) || (nrhs == 0))
+    return;
+
+  const unsigned long nb = MATRIXLAPACK_GEQRF_NB;
+  unsigned long panels = (k + nb - 1) / nb;
+  double * Y = matrixAllocatorMalloc(sizeof(double) * (2 * nb * nb + nb + 2 * nb * nrhs));
+  double * T = Y + nb * nb;
+  double * w = T + nb * nb;
+  double * W = w + nb;
+  for (unsigned long p = 0; p < panels; p++) {
+    unsigned long s = trans ? p : panels - 1 - p;
+    unsigned long jb = s * nb;
+    unsigned long kb = std::min(nb, k - jb);
+    const double * V = A + jb * lda + jb;
+    matrixLapackLarft(m - jb, kb, V, lda, tau + jb, Y, T, nb, w);
+    matrixLapackLarfb(trans, m - jb, nrhs, kb, V, lda, Y, T, nb, C + jb * ldc, ldc, W);
+  }
+  matrixAllocatorFree(Y);
+} // void matrixLapackOrmqr(bool trans, unsigned long m, unsigned long nrhs, unsigned long k, const double * A, unsigned long lda, const double * tau, double * C, unsigned long ldc)
+
+/**
+ * @brief matrixLapackPocon - Estimates the reciprocal of the condition number in the 1-norm of a
+ *                            symmetric positive definite matrix from its Cholesky factorization,
+ *                            see "matrixLapackLacon()".
+ * @param n                 - Size of A.
+ * @param L                 - Pointer to the first element of the factorization.
+ * @param ldl               - Leading dimension (row stride) of the factorization.
+ * @param norm              - The 1-norm of A, see "matrixLapackNorm1()".
+ * @return                  - The estimate of 1 / (||A||_1 * ||A^-1||_1).
+ */
+double matrixLapackPocon(unsigned long n, const double * L, unsigned long ldl, double norm) {
+  if (n == 0)
+    return 1.0;
+  if (norm == 0.0)
+    return 0.0;
+
+  matrixLapackConditionSystem system = {matrixLapackPoconSolve, n, L, ldl, NULL, false};
+  return 1.0 / (norm * matrixLapackLacon(system));
+} // double matrixLapackPocon(unsigned long n, const double * L, unsigned long ldl, double norm)
+
+/**
+ * @brief matrixLapackPotrf - Cholesky factorization, A = L * L^T, of a symmetric positive definite
+ *                            (n x n) matrix. Only the lower triangle of A is read, and it is
+ *                            overwritten by L. The factorization is right-looking by column
+ *                            blocks of MATRIXLAPACK_POTRF_NB columns, run as a graph of tasks, see
+ *                            "matrixLapackTiles": each diagonal block is factorized and the rows
+ *                            of L below it are solved by a TRSM, and every column block on its
+ *                            right is then updated by a GEMM, in parallel with the other blocks
+ *                            and with the next panel.
+ * @param n                 - Size of A.
+ * @param A                 - Pointer to the first element of the row-major A.
+ * @param lda               - Leading dimension (row stride) of A.
+ * @return                  - Zero on success, otherwise the one based index of the first leading
+ *                            minor that is not positive definite, at which the factorization
+ *                            stopped. The lower triangle of A after that column is then left
+ *                            partially updated.
+ */
+unsigned long matrixLapackPotrf(unsigned long n, double * A, unsigned long lda) {
+  if (n == 0)
+    return 0;
+
+  matrixLapackTiles tiles = {n, n, n, MATRIXLAPACK_POTRF_NB, A, lda, NULL, NULL, NULL, 0,
+                             std::vector<unsigned long>(), std::vector<unsigned long>()};
+  matrixLapackTileGraph(tiles).run(matrixLapackPotrfTask, &tiles);
+  return tiles.info;
+} // unsigned long matrixLapackPotrf(unsigned long n, double * A, unsigned long lda)
+
+/**
+ * @brief matrixLapackPotrs - Solves A * X = B from the Cholesky factorization of
+ *                            "matrixLapackPotrf()", where A is (n x n) and B is (n x nrhs). B is
+ *                            overwritten by X. L is solved first, and L^T is then read in place
+ *                            through swapped strides.
+ * @param n                 - Size of A and row size of B.
+ * @param nrhs              - Column size of B, the number of right-hand sides.
+ * @param L                 - Pointer to the first element of the factorization.
+ * @param ldl               - Leading dimension (row stride) of the factorization.
+ * @param B                 - Pointer to the first element of the row-major B.
+ * @param ldb               - Leading dimension (row stride) of B.
+ */
+void matrixLapackPotrs(unsigned long n, unsigned long nrhs, const double * L, unsigned long ldl,
+                       double * B, unsigned long ldb) {
+  matrixKernelsTrsm(false, false, n, nrhs, L, ldl, 1, B, ldb);
+  matrixKernelsTrsm(true, false, n, nrhs, L, 1, ldl, B, ldb);
+} // void matrixLapackPotrs(unsigned long n, unsigned long nrhs, const double * L, unsigned long ldl, double * B, unsigned long ldb)
+
+/**
+ * @brief matrixLapackTrcon - Estimates the reciprocal of the condition number in the 1-norm of a
+ *                            triangular matrix, such as the R of a QR factorization, see
+ *                            "matrixLapackLacon()". Only the triangle selected by upper is read.
+ * @param upper             - Whether T is upper or lower triangular.
+ * @param n                 - Size of T.
+ * @param T                 - Pointer to the first element of T.
+ * @param ldt               - Leading dimension (row stride) of T.
+ * @return                  - The estimate of 1 / (||T||_1 * ||T^-1||_1), zero if T is singular.
+ */
+double matrixLapackTrcon(bool upper, unsigned long n, const double * T, unsigned long ldt) {
+  if (n == 0)
+    return 1.0;
+
+  double * sum = matrixAllocatorMalloc(sizeof(double) * n);
+  std::fill(sum, sum + n, 0.0);
+  bool singular = false;
+  for (unsigned long i = 0; i < n; i++) {
+    const double * t = T + i * ldt;
+    singular = singular || (t[i] == 0.0);
+    for (unsigned long j = upper ? i : 0; j < (upper ? n : i + 1); j++)
+      sum[j] += fabs(t[j]);
+  }
+  double norm = * std::max_element(sum, sum + n);
+  matrixAllocatorFree(sum);
+  if (singular)
+    return 0.0;
+
+  matrixLapackConditionSystem system = {matrixLapackTrconSolve, n, T, ldt, NULL, upper};
+  return 1.0 / (norm * matrixLapackLacon(system));
+} // double matrixLapackTrcon(bool upper, unsigned long n, const double * T, unsigned long ldt)
+
+/**
+ * @brief matrixLapackTsqr - Tall and skinny QR factorization, A = Q * R, where A is (m x n) with
+ *                           m >= n, returning R and Q^T * B without forming Q. The rows of A are
+ *                           split into one row block per thread, each factorized on its own
+ *                           thread, and their R are merged pairwise in a binary reduction tree.
+ *                           A row block streams its rows through a workspace of
+ *                           MATRIXLAPACK_TSQR_ROWS + n rows, so that the memory used is
+ *                           O(n * (n + nrhs)) per thread, independent of m, and A and B are only
+ *                           read. Q^T is applied to B along the way, and only the first n rows of
+ *                           Q^T * B are kept, which is what a least squares solve needs. The
+ *                           signs of R follow the Householder reflectors, as in
+ *                           "matrixLapackGeqrf()".
+ * @param m                 - Row size of A and B.
+ * @param n                 - Column size of A.
+ * @param nrhs              - Column size of B, possibly zero.
+ * @param A                 - Pointer to the first element of the row-major A.
+ * @param lda               - Leading dimension (row stride) of A.
+ * @param B                 - Pointer to the first element of the row-major B.
+ * @param ldb               - Leading dimension (row stride) of B.
+ * @param R                 - Pointer to the first element of the (n x n) R, filled with zeros
+ *                            below the diagonal.
+ * @param ldr               - Leading dimension (row stride) of R.
+ * @param C                 - Pointer to the first element of the (n x nrhs) first rows of
+ *                            Q^T * B.
+ * @param ldc               - Leading dimension (row stride) of C.
+ */
+void matrixLapackTsqr(unsigned long m, unsigned long n, unsigned long nrhs, const double * A,
+                      unsigned long lda, const double * B, unsigned long ldb, double * R,
+                      unsigned long ldr, double * C, unsigned long ldc) {
+  if (n == 0)
+    return;
+
+  unsigned long rows = std::max((unsigned long)MATRIXLAPACK_TSQR_ROWS, n);
+  unsigned long ldw = n + nrhs;
+  unsigned long count = std::max(1UL, std::min(matrixThreadsGetCount(), m / rows));
+  unsigned long size = (rows + n) * ldw + n;
+  double * W = matrixAllocatorMalloc(sizeof(double) * size * count);
+  matrixLapackTsqrBlocks blocks = {m, n, nrhs, rows, count, A, lda, B, ldb, W, size, 1};
+  matrixThreadsParallelFor(count, matrixLapackTsqrLeaf, &blocks);
+  for (; blocks.distance < count; blocks.distance *= 2)
+    matrixThreadsParallelFor((count - blocks.distance + 2 * blocks.distance - 1) /
+                             (2 * blocks.distance), matrixLapackTsqrMerge, &blocks);
+
+  for (unsigned long i = 0; i < n; i++) {
+    std::copy(W + i * ldw, W + i * ldw + n, R + i * ldr);
+    if (nrhs > 0)
+      std::copy(W + i * ldw + n, W + i * ldw + ldw, C + i * ldc);
+  }
+  matrixAllocatorFree(W);
+} // void matrixLapackTsqr(unsigned long m, unsigned long n, unsigned long nrhs, const double * A, unsigned long lda, const double * B, unsigned long ldb, double * R, unsigned long ldr, double * C, unsigned long ldc)
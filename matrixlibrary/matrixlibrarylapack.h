@@ -0,0 +1,280 @@
+/*
+ * Copyright:   2021 Johnathon Leong
+ *
+ * License:     License under LGPL-3.0-or-later.
+ *              Please refer to https://www.gnu.org/licenses/lgpl-3.0.txt for more information on the
+ *              terms of LGPL-3.0 or relavent website for a later version of the LGPL.
+ *
+ * Disclaimer:  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY
+ *              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ *              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ *              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ *              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *              WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author:      Johnathon Leong
+ *
+ * Note:        LAPACK style factorizations and solvers of matrixlibrary. The routines work in place
+ *              on raw row-major buffers and are blocked, so that most of their flops are done by the
+ *              GEMM and TRSM kernels of matrixlibrarykernels, in parallel for large matrices. The LU
+ *              and QR factorizations are split into the tasks of their column blocks, which run as
+ *              soon as their dependencies are done, and the tall and skinny QR into row blocks
+ *              merged in a reduction tree. Pivot vectors are zero based: row i was
+ *              interchanged with row ipiv[i] at step i.
+ *
+ * Version:     1.0.6
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the tall and skinny QR factorization "matrixLapackTsqr()", which factorizes
+ *                 row blocks on separate threads and merges their R in a reduction tree, applying
+ *                 Q^T to a right-hand side without forming Q.
+ *
+ * Version:     1.0.5
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. "matrixLapackPotrf()" is now blocked and runs by column blocks as a graph of
+ *                 panel and update tasks, like the LU and QR factorizations, with the trailing
+ *                 updates done by GEMM calls.
+ *
+ * Version:     1.0.4
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The reflectors of each panel of "matrixLapackGeqrf()" are accumulated into a
+ *                 compact WY block reflector I - V * T * V^T, which the trailing column blocks and
+ *                 "matrixLapackOrmqr()" apply by GEMMs instead of one reflector at a time.
+ *
+ * Version:     1.0.3
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. "matrixLapackGetrf()" and "matrixLapackGeqrf()" now run by column blocks as a
+ *                 graph of panel and update tasks on matrixlibrarythreads, with a lookahead that
+ *                 factorizes the next panel while the current trailing update is still running.
+ *
+ * Version:     1.0.2
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the Householder QR factorization "matrixLapackGeqrf()" and the application
+ *                 of its Q by "matrixLapackOrmqr()".
+ *              2. Added the Cholesky factorization "matrixLapackPotrf()" and its solver
+ *                 "matrixLapackPotrs()".
+ *              3. The condition number estimator is shared by "matrixLapackGecon()" and the new
+ *                 "matrixLapackPocon()" and "matrixLapackTrcon()".
+ *
+ * Version:     1.0.1
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. "matrixLapackGetrs()" can solve with the transpose of the factorized matrix.
+ *              2. Added the condition number estimator "matrixLapackGecon()".
+ *
+ * Version:     1.0.0
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Implemented first release version of matrixlibrarylapack.
+ */
+
+#ifndef MATRIXLIBRARYLAPACK_H
+#define MATRIXLIBRARYLAPACK_H
+
+/**
+ * @brief MATRIXLAPACK_GETRF_NB - Column size of the panels of the LU factorization, which are
+ *                                also the column blocks updated by the tasks of the
+ *                                factorization. Each panel is factorized column by column, and
+ *                                each column block on its right is then updated by a GEMM of
+ *                                inner size NB.
+ */
+#define MATRIXLAPACK_GETRF_NB 64
+
+/**
+ * @brief MATRIXLAPACK_GEQRF_NB - Column size of the panels of the QR factorization, which are
+ *                                also the column blocks updated by the tasks of the
+ *                                factorization. The reflectors of each panel are applied to
+ *                                the column blocks on its right as one block reflector, by
+ *                                GEMMs of inner size NB.
+ */
+#define MATRIXLAPACK_GEQRF_NB 64
+
+/**
+ * @brief MATRIXLAPACK_POTRF_NB - Column size of the panels of the Cholesky factorization, which
+ *                                are also the column blocks updated by the tasks of the
+ *                                factorization. Each diagonal block is factorized column by
+ *                                column, and each column block on its right is then updated by a
+ *                                GEMM of inner size NB.
+ */
+#define MATRIXLAPACK_POTRF_NB 64
+
+/**
+ * @brief MATRIXLAPACK_TSQR_ROWS - Number of rows that a row block of the tall and skinny QR
+ *                                 factorization loads and factorizes at a time, below its current
+ *                                 R, or the column size of A if larger.
+ */
+#define MATRIXLAPACK_TSQR_ROWS 512
+
+/**
+ * @brief matrixLapackGecon - Estimates the reciprocal of the condition number in the 1-norm of a
+ *                            square matrix from its LU factorization, with the iterative
+ *                            estimator of Hager and Higham used by LAPACK. Each iteration solves
+ *                            with A and A^T for a single vector, so the estimate costs O(n^2).
+ * @param n                 - Size of A.
+ * @param LU                - Pointer to the first element of the factorization.
+ * @param ldlu              - Leading dimension (row stride) of the factorization.
+ * @param ipiv              - Pivot vector of the factorization.
+ * @param norm              - The 1-norm of A, see "matrixLapackNorm1()".
+ * @return                  - The estimate of 1 / (||A||_1 * ||A^-1||_1), zero if A is singular.
+ */
+double matrixLapackGecon(unsigned long n, const double * LU, unsigned long ldlu,
+                         const unsigned long * ipiv, double norm);
+
+/**
+ * @brief matrixLapackGeqrf - Householder QR factorization, A = Q * R, where A is (m x n). A is
+ *                            overwritten by R on and above the diagonal, and by the Householder
+ *                            vectors below it. Q is the product H(0) * H(1) * ... * H(k - 1),
+ *                            k = min(m, n), of the reflectors H(j) = I - tau[j] * v * v^T, where
+ *                            v has an implicit one at row j and zeros above it. The column blocks
+ *                            on the right of a panel apply its reflectors in parallel, as one
+ *                            compact WY block reflector.
+ * @param m                 - Row size of A.
+ * @param n                 - Column size of A.
+ * @param A                 - Pointer to the first element of the row-major A.
+ * @param lda               - Leading dimension (row stride) of A.
+ * @param tau               - Scalar factors of the min(m, n) reflectors, filled by the
+ *                            factorization.
+ */
+void matrixLapackGeqrf(unsigned long m, unsigned long n, double * A, unsigned long lda,
+                       double * tau);
+
+/**
+ * @brief matrixLapackGetrf - LU factorization with partial pivoting, P * A = L * U, where A is
+ *                            (m x n), L is unit lower triangular (trapezoidal if m > n) and U is
+ *                            upper triangular (trapezoidal if m < n). A is overwritten by L and U,
+ *                            without the unit diagonal of L. The panels and the updates of the
+ *                            column blocks on their right run as parallel tasks, with lookahead.
+ * @param m                 - Row size of A.
+ * @param n                 - Column size of A.
+ * @param A                 - Pointer to the first element of the row-major A.
+ * @param lda               - Leading dimension (row stride) of A.
+ * @param ipiv              - Pivot vector of min(m, n) elements, filled by the factorization.
+ * @return                  - Zero if every pivot is nonzero, otherwise the one based index of the
+ *                            first exactly zero pivot, in which case U is singular. The
+ *                            factorization is still completed.
+ */
+unsigned long matrixLapackGetrf(unsigned long m, unsigned long n, double * A, unsigned long lda,
+                                unsigned long * ipiv);
+
+/**
+ * @brief matrixLapackGetrs - Solves A * X = B, or A^T * X = B, from the LU factorization of
+ *                            "matrixLapackGetrf()", where A is (n x n) and B is (n x nrhs). B is
+ *                            overwritten by X. All the right-hand sides are solved together by
+ *                            blocked triangular solves, which read L and U in place for A^T.
+ * @param trans             - Solves with A^T when true.
+ * @param n                 - Size of A and row size of B.
+ * @param nrhs              - Column size of B, the number of right-hand sides.
+ * @param LU                - Pointer to the first element of the factorization.
+ * @param ldlu              - Leading dimension (row stride) of the factorization.
+ * @param ipiv              - Pivot vector of the factorization.
+ * @param B                 - Pointer to the first element of the row-major B.
+ * @param ldb               - Leading dimension (row stride) of B.
+ */
+void matrixLapackGetrs(bool trans, unsigned long n, unsigned long nrhs, const double * LU,
+                       unsigned long ldlu, const unsigned long * ipiv, double * B,
+                       unsigned long ldb);
+
+/**
+ * @brief matrixLapackNorm1 - Computes the 1-norm of a row-major block, that is its largest
+ *                            absolute column sum.
+ * @param m                 - Row size of A.
+ * @param n                 - Column size of A.
+ * @param A                 - Pointer to the first element of A.
+ * @param lda               - Leading dimension (row stride) of A.
+ * @return                  - The 1-norm of A.
+ */
+double matrixLapackNorm1(unsigned long m, unsigned long n, const double * A, unsigned long lda);
+
+/**
+ * @brief matrixLapackOrmqr - Multiplies a block by the Q of "matrixLapackGeqrf()" from the left,
+ *                            C = Q * C or C = Q^T * C, by block reflectors, without forming Q.
+ * @param trans             - Multiplies by Q^T when true.
+ * @param m                 - Row size of C and of the factorized matrix.
+ * @param nrhs              - Column size of C.
+ * @param k                 - Number of reflectors of Q.
+ * @param A                 - Pointer to the first element of the factorization.
+ * @param lda               - Leading dimension (row stride) of the factorization.
+ * @param tau               - Scalar factors of the reflectors.
+ * @param C                 - Pointer to the first element of the row-major C.
+ * @param ldc               - Leading dimension (row stride) of C.
+ */
+void matrixLapackOrmqr(bool trans, unsigned long m, unsigned long nrhs, unsigned long k,
+                       const double * A, unsigned long lda, const double * tau, double * C,
+                       unsigned long ldc);
+
+/**
+ * @brief matrixLapackPocon - Estimates the reciprocal of the condition number in the 1-norm of a
+ *                            symmetric positive definite matrix from its Cholesky factorization.
+ * @param n                 - Size of A.
+ * @param L                 - Pointer to the first element of the factorization.
+ * @param ldl               - Leading dimension (row stride) of the factorization.
+ * @param norm              - The 1-norm of A, see "matrixLapackNorm1()".
+ * @return                  - The estimate of 1 / (||A||_1 * ||A^-1||_1).
+ */
+double matrixLapackPocon(unsigned long n, const double * L, unsigned long ldl, double norm);
+
+/**
+ * @brief matrixLapackPotrf - Cholesky factorization, A = L * L^T, of a symmetric positive definite
+ *                            (n x n) matrix. Only the lower triangle of A is read, and it is
+ *                            overwritten by L. The strict upper triangle is left untouched. The
+ *                            column blocks on the right of a panel are updated in parallel by
+ *                            GEMMs.
+ * @param n                 - Size of A.
+ * @param A                 - Pointer to the first element of the row-major A.
+ * @param lda               - Leading dimension (row stride) of A.
+ * @return                  - Zero on success, otherwise the one based index of the first leading
+ *                            minor that is not positive definite, at which the factorization
+ *                            stopped.
+ */
+unsigned long matrixLapackPotrf(unsigned long n, double * A, unsigned long lda);
+
+/**
+ * @brief matrixLapackPotrs - Solves A * X = B from the Cholesky factorization of
+ *                            "matrixLapackPotrf()", where A is (n x n) and B is (n x nrhs). B is
+ *                            overwritten by X.
+ * @param n                 - Size of A and row size of B.
+ * @param nrhs              - Column size of B, the number of right-hand sides.
+ * @param L                 - Pointer to the first element of the factorization.
+ * @param ldl               - Leading dimension (row stride) of the factorization.
+ * @param B                 - Pointer to the first element of the row-major B.
+ * @param ldb               - Leading dimension (row stride) of B.
+ */
+void matrixLapackPotrs(unsigned long n, unsigned long nrhs, const double * L, unsigned long ldl,
+                       double * B, unsigned long ldb);
+
+/**
+ * @brief matrixLapackTrcon - Estimates the reciprocal of the condition number in the 1-norm of a
+ *                            triangular matrix, such as the R of a QR factorization.
+ * @param upper             - Whether T is upper or lower triangular.
+ * @param n                 - Size of T.
+ * @param T                 - Pointer to the first element of T.
+ * @param ldt               - Leading dimension (row stride) of T.
+ * @return                  - The estimate of 1 / (||T||_1 * ||T^-1||_1), zero if T is singular.
+ */
+double matrixLapackTrcon(bool upper, unsigned long n, const double * T, unsigned long ldt);
+
+/**
+ * @brief matrixLapackTsqr - Tall and skinny QR factorization, A = Q * R, where A is (m x n) with
+ *                           m >= n, returning R and the first n rows of Q^T * B without forming Q.
+ *                           Row blocks of A are factorized on separate threads and their R are
+ *                           merged in a binary reduction tree. A and B are only read, and the
+ *                           workspace does not grow with m.
+ * @param m                 - Row size of A and B.
+ * @param n                 - Column size of A.
+ * @param nrhs              - Column size of B, possibly zero.
+ * @param A                 - Pointer to the first element of the row-major A.
+ * @param lda               - Leading dimension (row stride) of A.
+ * @param B                 - Pointer to the first element of the row-major B.
+ * @param ldb               - Leading dimension (row stride) of B.
+ * @param R                 - Pointer to the first element of the (n x n) R, filled with zeros
+ *                            below the diagonal.
+ * @param ldr               - Leading dimension (row stride) of R.
+ * @param C                 - Pointer to the first element of the (n x nrhs) first rows of
+ *                            Q^T * B.
+ * @param ldc               - Leading dimension (row stride) of C.
+ */
+void matrixLapackTsqr(unsigned long m, unsigned long n, unsigned long nrhs, const double * A,
+                      unsigned long lda, const double * B, unsigned long ldb, double * R,
+                      unsigned long ldr, double * C, unsigned long ldc);
+
+#endif // MATRIXLIBRARYLAPACK_H
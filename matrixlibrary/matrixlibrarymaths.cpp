@@ -19,6 +19,24 @@
  *
  * Note:        To be used together with matrixlibrary.
  *
+ * Version:     1.0.6
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The results of the operations along the rows are transposed back in place with
+ *                 "transpose()" instead of through a copy.
+ *
+ * Version:     1.0.5
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The result matrix of "matrixMathsCumulativeSum()" is allocated uninitialized.
+ *
+ * Version:     1.0.4
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The indicator and cumulative sum matrices are now indexed using their leading
+ *                 dimension. Removed unused row indices.
+ *
+ * Version:     1.0.3
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added view overloads of all the functions. The matrix overloads forward to them.
+ *
  * Version:     1.0.2
  * Date:        2021/08/04 (YYYY/MM/DD)
  * Change Log:  1. Updated the following functions
@@ -59,10 +77,30 @@
  *                            value in the order from left-to-right if the direction is set to 1.
  */
 matrix matrixMathsAbsMax(const matrix & X, matrix & Z, unsigned char indicatorType, unsigned char direction) {
+  return matrixMathsAbsMax(matrixView(X), Z, indicatorType, direction);
+} // matrix matrixMathsAbsMax(const matrix & X, matrix & Z, unsigned char indicatorType, unsigned char direction)
+
+/**
+ * @brief matrixMathsAbsMax - Finds the absolute maximum value for each of the vector of the view.
+ *                            The vector direction is defined by the input argument.
+ * @param X                 - The view whose absolute maximum value is to be determined.
+ * @param Z                 - The resultant absolute maximum value vector matrix.
+ * @param direction         - Defines the direction of the vector;
+ *                            0 -> column vector
+ *                            1 -> row vector
+ * @return                  - The location of the absolute maximum value of the vector, indicated by
+ *                            value 1.
+ *                            The position will take the first occurance of the absolute maximum
+ *                            value in the order from top-to-bottom if the direction is set to 0.
+ *                            The position will take the first occurance of the absolute maximum
+ *                            value in the order from left-to-right if the direction is set to 1.
+ */
+matrix matrixMathsAbsMax(const matrixView & X, matrix & Z, unsigned char indicatorType, unsigned char direction) {
   if (direction > 1)
     direction = 0;
 
-  matrix Y = (direction == 0) ? X : matrixTranspose(X);
+  matrix T = (direction == 0) ? matrix() : matrixTranspose(X);
+  matrixView Y = (direction == 0) ? X : T.view();
   matrix P;
   (indicatorType == 1) ? P.resizeClear(Y.getRowSize(), Y.getColSize()) : P.resizeClear(1, Y.getColSize());
 
@@ -70,15 +108,16 @@ matrix matrixMathsAbsMax(const matrix & X, matrix & Z, unsigned char indicatorTy
   unsigned long rowIndex = 0;
 
   for (unsigned long i = 0; i < Y.getRowSize(); i++) {
+    const double * y = &Y.mMat[i * Y.getLd()];
     for (unsigned long j = 0; j < Y.getColSize(); j++) {
       if (i > 0) {
-        if (fabs(Z.mMat[j]) < fabs(Y.mMat[rowIndex + j])) {
-          Z.mMat[j] = Y.mMat[rowIndex + j];
+        if (fabs(Z.mMat[j]) < fabs(y[j])) {
+          Z.mMat[j] = y[j];
           if (indicatorType == 1) {
             unsigned long index = 0;
             for (unsigned long k = 0; k < i; k++) {
               P.mMat[index + j] = 0;
-              index += Y.getColSize();
+              index += P.getLd();
             }
             P.mMat[rowIndex + j] = 1;
           }
@@ -87,20 +126,20 @@ matrix matrixMathsAbsMax(const matrix & X, matrix & Z, unsigned char indicatorTy
         }
       }
       else {
-        Z.mMat[j] = Y.mMat[j];
+        Z.mMat[j] = y[j];
         P.mMat[j] = 1;
       }
     }
-    rowIndex += Y.getColSize();
+    rowIndex += P.getLd();
   }
 
   if (direction == 1) {
-    Z = matrixTranspose(Z);
-    P = matrixTranspose(P);
+    Z.transpose();
+    P.transpose();
   }
 
   return P;
-} // matrix matrixMathsAbsMax(const matrix & X, matrix & Z, unsigned char indicatorType, unsigned char direction)
+} // matrix matrixMathsAbsMax(const matrixView & X, matrix & Z, unsigned char indicatorType, unsigned char direction)
 
 /**
  * @brief matrixMathsAbsMin - Finds the absolute minimum value for each of the vector of the matrix.
@@ -118,10 +157,30 @@ matrix matrixMathsAbsMax(const matrix & X, matrix & Z, unsigned char indicatorTy
  *                            value in the order from left-to-right if the direction is set to 1.
  */
 matrix matrixMathsAbsMin(const matrix & X, matrix & Z, unsigned char indicatorType, unsigned char direction) {
+  return matrixMathsAbsMin(matrixView(X), Z, indicatorType, direction);
+} // matrix matrixMathsAbsMin(const matrix & X, matrix & Z, unsigned char indicatorType, unsigned char direction)
+
+/**
+ * @brief matrixMathsAbsMin - Finds the absolute minimum value for each of the vector of the view.
+ *                            The vector direction is defined by the input argument.
+ * @param X                 - The view whose absolute minimum value is to be determined.
+ * @param Z                 - The resultant absolute minimum value vector matrix.
+ * @param direction         - Defines the direction of the vector;
+ *                            0 -> column vector
+ *                            1 -> row vector
+ * @return                  - The location of the absolute minimum value of the vector, indicated by
+ *                            value 1.
+ *                            The position will take the first occurance of the absolute minimum
+ *                            value in the order from top-to-bottom if the direction is set to 0.
+ *                            The position will take the first occurance of the absolute minimum
+ *                            value in the order from left-to-right if the direction is set to 1.
+ */
+matrix matrixMathsAbsMin(const matrixView & X, matrix & Z, unsigned char indicatorType, unsigned char direction) {
   if (direction > 1)
     direction = 0;
 
-  matrix Y = (direction == 0) ? X : matrixTranspose(X);
+  matrix T = (direction == 0) ? matrix() : matrixTranspose(X);
+  matrixView Y = (direction == 0) ? X : T.view();
   matrix P;
   (indicatorType == 1) ? P.resizeClear(Y.getRowSize(), Y.getColSize()) : P.resizeClear(1, Y.getColSize());
 
@@ -129,15 +188,16 @@ matrix matrixMathsAbsMin(const matrix & X, matrix & Z, unsigned char indicatorTy
   unsigned long rowIndex = 0;
 
   for (unsigned long i = 0; i < Y.getRowSize(); i++) {
+    const double * y = &Y.mMat[i * Y.getLd()];
     for (unsigned long j = 0; j < Y.getColSize(); j++) {
       if (i > 0) {
-        if (fabs(Z.mMat[j]) > fabs(Y.mMat[rowIndex + j])) {
-          Z.mMat[j] = Y.mMat[rowIndex + j];
+        if (fabs(Z.mMat[j]) > fabs(y[j])) {
+          Z.mMat[j] = y[j];
           if (indicatorType == 1) {
             unsigned long index = 0;
             for (unsigned long k = 0; k < i; k++) {
               P.mMat[index + j] = 0;
-              index += Y.getColSize();
+              index += P.getLd();
             }
             P.mMat[rowIndex + j] = 1;
           }
@@ -146,20 +206,20 @@ matrix matrixMathsAbsMin(const matrix & X, matrix & Z, unsigned char indicatorTy
         }
       }
       else {
-        Z.mMat[j] = Y.mMat[j];
+        Z.mMat[j] = y[j];
         P.mMat[j] = 1;
       }
     }
-    rowIndex += Y.getColSize();
+    rowIndex += P.getLd();
   }
 
   if (direction == 1) {
-    Z = matrixTranspose(Z);
-    P = matrixTranspose(P);
+    Z.transpose();
+    P.transpose();
   }
 
   return P;
-} // matrix matrixMathsAbsMin(const matrix & X, matrix & Z, unsigned char indicatorType, unsigned char direction)
+} // matrix matrixMathsAbsMin(const matrixView & X, matrix & Z, unsigned char indicatorType, unsigned char direction)
 
 /**
  * @brief matrixMathsCumulativeSum - Computes the cumulative sum for each of the vector of the
@@ -171,28 +231,43 @@ matrix matrixMathsAbsMin(const matrix & X, matrix & Z, unsigned char indicatorTy
  * @return                         - The resultant cumulative sum vector matrix.
  */
 matrix matrixMathsCumulativeSum(const matrix & X, unsigned char direction) {
+  return matrixMathsCumulativeSum(matrixView(X), direction);
+} // matrix matrixMathsCumulativeSum(const matrix & X, unsigned char direction) --------------------
+
+/**
+ * @brief matrixMathsCumulativeSum - Computes the cumulative sum for each of the vector of the
+ *                                   matrix. The vector direction is defined by the input argument.
+ * @param X                        - The view whose cumulative sum is to be calculated.
+ * @param direction                - Defines the direction of the vector;
+ *                                   0 -> column vector
+ *                                   1 -> row vector
+ * @return                         - The resultant cumulative sum vector matrix.
+ */
+matrix matrixMathsCumulativeSum(const matrixView & X, unsigned char direction) {
   if (direction > 1)
     direction = 0;
 
-  matrix Y = (direction == 0) ? X : matrixTranspose(X);
-  matrix Z(Y.getRowSize(), Y.getColSize());
+  matrix T = (direction == 0) ? matrix() : matrixTranspose(X);
+  matrixView Y = (direction == 0) ? X : T.view();
+  matrix Z(Y.getRowSize(), Y.getColSize(), matrixUninitialized);
   unsigned long rowIndex = 0;
 
   for (unsigned long i = 0; i < Y.getRowSize(); i++) {
+    const double * y = &Y.mMat[i * Y.getLd()];
     for (unsigned long j = 0; j < Y.getColSize(); j++) {
       if (i > 0)
-        Z.mMat[rowIndex + j] = Z.mMat[rowIndex - Y.getColSize() + j] + Y.mMat[rowIndex + j];
+        Z.mMat[rowIndex + j] = Z.mMat[rowIndex - Z.getLd() + j] + y[j];
       else
-        Z.mMat[j] = Y.mMat[j];
+        Z.mMat[j] = y[j];
     }
-    rowIndex += Y.getColSize();
+    rowIndex += Z.getLd();
   }
 
   if (direction == 1)
-    Z = matrixTranspose(Z);
+    Z.transpose();
 
   return Z;
-} // matrix matrixMathsCumulativeSum(const matrix & X, unsigned char direction) --------------------
+} // matrix matrixMathsCumulativeSum(const matrixView & X, unsigned char direction) ----------------
 
 /**
  * @brief matrixMathsMax - Finds the maximum value for each of the vector of the matrix.
@@ -209,10 +284,29 @@ matrix matrixMathsCumulativeSum(const matrix & X, unsigned char direction) {
  *                         order from left-to-right if the direction is set to 1.
  */
 matrix matrixMathsMax(const matrix & X, matrix & Z, unsigned char indicatorType, unsigned char direction) {
+  return matrixMathsMax(matrixView(X), Z, indicatorType, direction);
+} // matrix matrixMathsMax(const matrix & X, matrix & Z, unsigned char indicatorType, unsigned char direction)
+
+/**
+ * @brief matrixMathsMax - Finds the maximum value for each of the vector of the view.
+ *                         The vector direction is defined by the input argument.
+ * @param X              - The view whose maximum value is to be determined.
+ * @param Z              - The resultant maximum value vector matrix.
+ * @param direction      - Defines the direction of the vector;
+ *                         0 -> column vector
+ *                         1 -> row vector
+ * @return               - The location of the maximum value of the vector, indicated by value 1.
+ *                         The position will take the first occurance of the maximum value in the
+ *                         order from top-to-bottom if the direction is set to 0.
+ *                         The position will take the first occurance of the maximum value in the
+ *                         order from left-to-right if the direction is set to 1.
+ */
+matrix matrixMathsMax(const matrixView & X, matrix & Z, unsigned char indicatorType, unsigned char direction) {
   if (direction > 1)
     direction = 0;
 
-  matrix Y = (direction == 0) ? X : matrixTranspose(X);
+  matrix T = (direction == 0) ? matrix() : matrixTranspose(X);
+  matrixView Y = (direction == 0) ? X : T.view();
   matrix P;
   (indicatorType == 1) ? P.resizeClear(Y.getRowSize(), Y.getColSize()) : P.resizeClear(1, Y.getColSize());
 
@@ -220,15 +314,16 @@ matrix matrixMathsMax(const matrix & X, matrix & Z, unsigned char indicatorType,
   unsigned long rowIndex = 0;
 
   for (unsigned long i = 0; i < Y.getRowSize(); i++) {
+    const double * y = &Y.mMat[i * Y.getLd()];
     for (unsigned long j = 0; j < Y.getColSize(); j++) {
       if (i > 0) {
-        if (Z.mMat[j] < Y.mMat[rowIndex + j]) {
-          Z.mMat[j] = Y.mMat[rowIndex + j];
+        if (Z.mMat[j] < y[j]) {
+          Z.mMat[j] = y[j];
           if (indicatorType == 1) {
             unsigned long index = 0;
             for (unsigned long k = 0; k < i; k++) {
               P.mMat[index + j] = 0;
-              index += Y.getColSize();
+              index += P.getLd();
             }
             P.mMat[rowIndex + j] = 1;
           }
@@ -237,20 +332,20 @@ matrix matrixMathsMax(const matrix & X, matrix & Z, unsigned char indicatorType,
         }
       }
       else {
-        Z.mMat[j] = Y.mMat[j];
+        Z.mMat[j] = y[j];
         P.mMat[j] = 1;
       }
     }
-    rowIndex += Y.getColSize();
+    rowIndex += P.getLd();
   }
 
   if (direction == 1) {
-    Z = matrixTranspose(Z);
-    P = matrixTranspose(P);
+    Z.transpose();
+    P.transpose();
   }
 
   return P;
-} // matrix matrixMathsMax(const matrix & X, matrix & Z, unsigned char indicatorType, unsigned char direction)
+} // matrix matrixMathsMax(const matrixView & X, matrix & Z, unsigned char indicatorType, unsigned char direction)
 
 /**
  * @brief matrixMathsMin - Finds the minimum value for each of the vector of the matrix.
@@ -267,10 +362,29 @@ matrix matrixMathsMax(const matrix & X, matrix & Z, unsigned char indicatorType,
  *                         order from left-to-right if the direction is set to 1.
  */
 matrix matrixMathsMin(const matrix & X, matrix & Z, unsigned char indicatorType, unsigned char direction) {
+  return matrixMathsMin(matrixView(X), Z, indicatorType, direction);
+} // matrix matrixMathsMin(const matrix & X, matrix & Z, unsigned char indicatorType, unsigned char direction)
+
+/**
+ * @brief matrixMathsMin - Finds the minimum value for each of the vector of the view.
+ *                         The vector direction is defined by the input argument.
+ * @param X              - The view whose minimum value is to be determined.
+ * @param Z              - The resultant minimum value vector matrix.
+ * @param direction      - Defines the direction of the vector;
+ *                         0 -> column vector
+ *                         1 -> row vector
+ * @return               - The location of the minimum value of the vector, indicated by value 1.
+ *                         The position will take the first occurance of the minimum value in the
+ *                         order from top-to-bottom if the direction is set to 0.
+ *                         The position will take the first occurance of the minimum value in the
+ *                         order from left-to-right if the direction is set to 1.
+ */
+matrix matrixMathsMin(const matrixView & X, matrix & Z, unsigned char indicatorType, unsigned char direction) {
   if (direction > 1)
     direction = 0;
 
-  matrix Y = (direction == 0) ? X : matrixTranspose(X);
+  matrix T = (direction == 0) ? matrix() : matrixTranspose(X);
+  matrixView Y = (direction == 0) ? X : T.view();
   matrix P;
   (indicatorType == 1) ? P.resizeClear(Y.getRowSize(), Y.getColSize()) : P.resizeClear(1, Y.getColSize());
 
@@ -278,15 +392,16 @@ matrix matrixMathsMin(const matrix & X, matrix & Z, unsigned char indicatorType,
   unsigned long rowIndex = 0;
 
   for (unsigned long i = 0; i < Y.getRowSize(); i++) {
+    const double * y = &Y.mMat[i * Y.getLd()];
     for (unsigned long j = 0; j < Y.getColSize(); j++) {
       if (i > 0) {
-        if (Z.mMat[j] > Y.mMat[rowIndex + j]) {
-          Z.mMat[j] = Y.mMat[rowIndex + j];
+        if (Z.mMat[j] > y[j]) {
+          Z.mMat[j] = y[j];
           if (indicatorType == 1) {
             unsigned long index = 0;
             for (unsigned long k = 0; k < i; k++) {
               P.mMat[index + j] = 0;
-              index += Y.getColSize();
+              index += P.getLd();
             }
             P.mMat[rowIndex + j] = 1;
           }
@@ -295,20 +410,20 @@ matrix matrixMathsMin(const matrix & X, matrix & Z, unsigned char indicatorType,
         }
       }
       else {
-        Z.mMat[j] = Y.mMat[j];
+        Z.mMat[j] = y[j];
         P.mMat[j] = 1;
       }
     }
-    rowIndex += Y.getColSize();
+    rowIndex += P.getLd();
   }
 
   if (direction == 1) {
-    Z = matrixTranspose(Z);
-    P = matrixTranspose(P);
+    Z.transpose();
+    P.transpose();
   }
 
   return P;
-} // matrix matrixMathsMin(const matrix & X, matrix & Z, unsigned char indicatorType, unsigned char direction)
+} // matrix matrixMathsMin(const matrixView & X, matrix & Z, unsigned char indicatorType, unsigned char direction)
 
 /**
  * @brief matrixMathsRootMeanSquare - Computes the root mean square for each of the vector of the
@@ -320,19 +435,32 @@ matrix matrixMathsMin(const matrix & X, matrix & Z, unsigned char indicatorType,
  * @return                          - The resultant root mean square vector matrix.
  */
 matrix matrixMathsRootMeanSquare(const matrix & X, unsigned char direction) {
+  return matrixMathsRootMeanSquare(matrixView(X), direction);
+} // matrix matrixMathsRootMeanSquare(const matrix & X, unsigned char direction) -------------------
+
+/**
+ * @brief matrixMathsRootMeanSquare - Computes the root mean square for each of the vector of the
+ *                                    matrix. The vector direction is defined by the input argument.
+ * @param X                         - The view whose root mean square is to be calculated.
+ * @param direction                 - Defines the direction of the vector;
+ *                                    0 -> column vector
+ *                                    1 -> row vector
+ * @return                          - The resultant root mean square vector matrix.
+ */
+matrix matrixMathsRootMeanSquare(const matrixView & X, unsigned char direction) {
   if (direction > 1)
     direction = 0;
 
-  matrix Y = (direction == 0) ? X : matrixTranspose(X);
+  matrix T = (direction == 0) ? matrix() : matrixTranspose(X);
+  matrixView Y = (direction == 0) ? X : T.view();
   matrix Z(1, Y.getColSize());
   double rowSize = (double)(Y.getRowSize());
-  unsigned long rowIndex = 0;
 
   for (unsigned long i = 0; i < Y.getRowSize(); i++) {
+    const double * y = &Y.mMat[i * Y.getLd()];
     for (unsigned long j = 0; j < Y.getColSize(); j++) {
-      Z.mMat[j] += Y.mMat[rowIndex + j] * Y.mMat[rowIndex + j];
+      Z.mMat[j] += y[j] * y[j];
     }
-    rowIndex += Y.getColSize();
   }
 
   for (unsigned long i = 0; i < Y.getColSize(); i++) {
@@ -340,10 +468,10 @@ matrix matrixMathsRootMeanSquare(const matrix & X, unsigned char direction) {
   }
 
   if (direction == 1)
-    Z = matrixTranspose(Z);
+    Z.transpose();
 
   return Z;
-} // matrix matrixMathsRootMeanSquare(const matrix & X, unsigned char direction) -------------------
+} // matrix matrixMathsRootMeanSquare(const matrixView & X, unsigned char direction) ---------------
 
 /**
  * @brief matrixMathsRootMeanSquare - Computes the square root for each of the vector of the matrix.
@@ -355,18 +483,31 @@ matrix matrixMathsRootMeanSquare(const matrix & X, unsigned char direction) {
  * @return                          - The resultant square root vector matrix.
  */
 matrix matrixMathsSquareRoot(const matrix & X, unsigned char direction) {
+  return matrixMathsSquareRoot(matrixView(X), direction);
+} // matrix matrixMathsSquareRoot(const matrix & X, unsigned char direction) -----------------------
+
+/**
+ * @brief matrixMathsRootMeanSquare - Computes the square root for each of the vector of the view.
+ *                                    The vector direction is defined by the input argument.
+ * @param X                         - The view whose square root is to be calculated.
+ * @param direction                 - Defines the direction of the vector;
+ *                                    0 -> column vector
+ *                                    1 -> row vector
+ * @return                          - The resultant square root vector matrix.
+ */
+matrix matrixMathsSquareRoot(const matrixView & X, unsigned char direction) {
   if (direction > 1)
     direction = 0;
 
-  matrix Y = (direction == 0) ? X : matrixTranspose(X);
+  matrix T = (direction == 0) ? matrix() : matrixTranspose(X);
+  matrixView Y = (direction == 0) ? X : T.view();
   matrix Z(1, Y.getColSize());
-  unsigned long rowIndex = 0;
 
   for (unsigned long i = 0; i < Y.getRowSize(); i++) {
+    const double * y = &Y.mMat[i * Y.getLd()];
     for (unsigned long j = 0; j < Y.getColSize(); j++) {
-      Z.mMat[j] += Y.mMat[rowIndex + j] * Y.mMat[rowIndex + j];
+      Z.mMat[j] += y[j] * y[j];
     }
-    rowIndex += Y.getColSize();
   }
 
   for (unsigned long i = 0; i < Y.getColSize(); i++) {
@@ -374,10 +515,10 @@ matrix matrixMathsSquareRoot(const matrix & X, unsigned char direction) {
   }
 
   if (direction == 1)
-    Z = matrixTranspose(Z);
+    Z.transpose();
 
   return Z;
-} // matrix matrixMathsSquareRoot(const matrix & X, unsigned char direction) -----------------------
+} // matrix matrixMathsSquareRoot(const matrixView & X, unsigned char direction) -------------------
 
 /**
  * @brief matrixMathsSum - Computes the sum for each of the vector of the matrix. The vector
@@ -389,25 +530,38 @@ matrix matrixMathsSquareRoot(const matrix & X, unsigned char direction) {
  * @return               - The resultant sum vector matrix.
  */
 matrix matrixMathsSum(const matrix & X, unsigned char direction) {
+  return matrixMathsSum(matrixView(X), direction);
+} // matrix matrixMathsSum(const matrix & X, unsigned char direction) ------------------------------
+
+/**
+ * @brief matrixMathsSum - Computes the sum for each of the vector of the view. The vector
+ *                         direction is defined by the input argument.
+ * @param X              - The view whose sum is to be calculated.
+ * @param direction      - Defines the direction of the vector;
+ *                         0 -> column vector
+ *                         1 -> row vector
+ * @return               - The resultant sum vector matrix.
+ */
+matrix matrixMathsSum(const matrixView & X, unsigned char direction) {
   if (direction > 1)
     direction = 0;
 
-  matrix Y = (direction == 0) ? X : matrixTranspose(X);
+  matrix T = (direction == 0) ? matrix() : matrixTranspose(X);
+  matrixView Y = (direction == 0) ? X : T.view();
   matrix Z(1, Y.getColSize());
-  unsigned long rowIndex = 0;
 
   for (unsigned long i = 0; i < Y.getRowSize(); i++) {
+    const double * y = &Y.mMat[i * Y.getLd()];
     for (unsigned long j = 0; j < Y.getColSize(); j++) {
-      Z.mMat[j] += Y.mMat[rowIndex + j];
+      Z.mMat[j] += y[j];
     }
-    rowIndex += Y.getColSize();
   }
 
   if (direction == 1)
-    Z = matrixTranspose(Z);
+    Z.transpose();
 
   return Z;
-} // matrix matrixMathsSum(const matrix & X, unsigned char direction) ------------------------------
+} // matrix matrixMathsSum(const matrixView & X, unsigned char direction) --------------------------
 
 /**
  * @brief matrixMathsVectorRootMeanSquare - Computes the root mean square of the input vector. The
@@ -416,11 +570,21 @@ matrix matrixMathsSum(const matrix & X, unsigned char direction) {
  * @return                                - The computed root mean square value.
  */
 double matrixMathsVectorRootMeanSquare(const matrix & X) {
+  return matrixMathsVectorRootMeanSquare(matrixView(X));
+} // double matrixMathsVectorRootMeanSquare(const matrix & X) --------------------------------------
+
+/**
+ * @brief matrixMathsVectorRootMeanSquare - Computes the root mean square of the input vector. The
+ *                                          input vector must be a [N x 1] matrix.
+ * @param X                               - The vector whose root mean square is to be calculated.
+ * @return                                - The computed root mean square value.
+ */
+double matrixMathsVectorRootMeanSquare(const matrixView & X) {
   double val = 0;
   for (unsigned long i = 0; i < X.getRowSize(); i++)
-    val += (X.mMat[i] * X.mMat[i]);
+    val += (X.mMat[i * X.getLd()] * X.mMat[i * X.getLd()]);
   return sqrt(val / (double)(X.getRowSize()));
-} // double matrixMathsVectorRootMeanSquare(const matrix & X) --------------------------------------
+} // double matrixMathsVectorRootMeanSquare(const matrixView & X) ----------------------------------
 
 /**
  * @brief matrixMathsVectorRootMeanSquare - Computes the square root of the input vector. The input
@@ -429,11 +593,21 @@ double matrixMathsVectorRootMeanSquare(const matrix & X) {
  * @return                                - The computed square root value.
  */
 double matrixMathsVectorSquareRoot(const matrix & X) {
+  return matrixMathsVectorSquareRoot(matrixView(X));
+} // double matrixMathsVectorSquareRoot(const matrix & X) ------------------------------------------
+
+/**
+ * @brief matrixMathsVectorRootMeanSquare - Computes the square root of the input vector. The input
+ *                                          vector must be a [N x 1] matrix.
+ * @param X                               - The vector whose square root is to be calculated.
+ * @return                                - The computed square root value.
+ */
+double matrixMathsVectorSquareRoot(const matrixView & X) {
   double val = 0;
   for (unsigned long i = 0; i < X.getRowSize(); i++)
-    val += (X.mMat[i] * X.mMat[i]);
+    val += (X.mMat[i * X.getLd()] * X.mMat[i * X.getLd()]);
   return sqrt(val);
-} // double matrixMathsVectorSquareRoot(const matrix & X) ------------------------------------------
+} // double matrixMathsVectorSquareRoot(const matrixView & X) --------------------------------------
 
 /**
  * @brief matrixMathsVectorRootMeanSquare - Computes the sum of the input vector. The input vector
@@ -442,8 +616,18 @@ double matrixMathsVectorSquareRoot(const matrix & X) {
  * @return                                - The computed sum value.
  */
 double matrixMathsVectorSum(const matrix & X) {
+  return matrixMathsVectorSum(matrixView(X));
+} // double matrixMathsVectorSum(const matrix & X) -------------------------------------------------
+
+/**
+ * @brief matrixMathsVectorRootMeanSquare - Computes the sum of the input vector. The input vector
+ *                                          must be a [N x 1] matrix.
+ * @param X                               - The vector whose sum is to be calculated.
+ * @return                                - The computed sum value.
+ */
+double matrixMathsVectorSum(const matrixView & X) {
   double val = 0;
   for (unsigned long i = 0; i < X.getRowSize(); i++)
-    val += X.mMat[i];
+    val += X.mMat[i * X.getLd()];
   return val;
-} // double matrixMathsVectorSum(const matrix & X) -------------------------------------------------
+} // double matrixMathsVectorSum(const matrixView & X) ---------------------------------------------
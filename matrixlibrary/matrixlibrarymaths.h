@@ -19,6 +19,24 @@
  *
  * Note:        To be used together with matrixlibrary.
  *
+ * Version:     1.0.6
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The results of the operations along the rows are transposed back in place with
+ *                 "transpose()" instead of through a copy.
+ *
+ * Version:     1.0.5
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The result matrix of "matrixMathsCumulativeSum()" is allocated uninitialized.
+ *
+ * Version:     1.0.4
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The indicator and cumulative sum matrices are now indexed using their leading
+ *                 dimension. Removed unused row indices.
+ *
+ * Version:     1.0.3
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added view overloads of all the functions. The matrix overloads forward to them.
+ *
  * Version:     1.0.2
  * Date:        2021/08/04 (YYYY/MM/DD)
  * Change Log:  1. Updated the following functions
@@ -62,6 +80,23 @@
  */
 matrix matrixMathsAbsMax(const matrix & X, matrix & Z, unsigned char indicatorType = 0, unsigned char direction = 0);
 
+/**
+ * @brief matrixMathsAbsMax - Finds the absolute maximum value for each of the vector of the view.
+ *                            The vector direction is defined by the input argument.
+ * @param X                 - The view whose absolute maximum value is to be determined.
+ * @param Z                 - The resultant absolute maximum value vector matrix.
+ * @param direction         - Defines the direction of the vector;
+ *                            0 -> column vector
+ *                            1 -> row vector
+ * @return                  - The location of the absolute maximum value of the vector, indicated by
+ *                            value 1.
+ *                            The position will take the first occurance of the absolute maximum
+ *                            value in the order from top-to-bottom if the direction is set to 0.
+ *                            The position will take the first occurance of the absolute maximum
+ *                            value in the order from left-to-right if the direction is set to 1.
+ */
+matrix matrixMathsAbsMax(const matrixView & X, matrix & Z, unsigned char indicatorType = 0, unsigned char direction = 0);
+
 /**
  * @brief matrixMathsAbsMin - Finds the absolute minimum value for each of the vector of the matrix.
  *                            The vector direction is defined by the input argument.
@@ -79,6 +114,23 @@ matrix matrixMathsAbsMax(const matrix & X, matrix & Z, unsigned char indicatorTy
  */
 matrix matrixMathsAbsMin(const matrix & X, matrix & Z, unsigned char indicatorType = 0, unsigned char direction = 0);
 
+/**
+ * @brief matrixMathsAbsMin - Finds the absolute minimum value for each of the vector of the view.
+ *                            The vector direction is defined by the input argument.
+ * @param X                 - The view whose absolute minimum value is to be determined.
+ * @param Z                 - The resultant absolute minimum value vector matrix.
+ * @param direction         - Defines the direction of the vector;
+ *                            0 -> column vector
+ *                            1 -> row vector
+ * @return                  - The location of the absolute minimum value of the vector, indicated by
+ *                            value 1.
+ *                            The position will take the first occurance of the absolute minimum
+ *                            value in the order from top-to-bottom if the direction is set to 0.
+ *                            The position will take the first occurance of the absolute minimum
+ *                            value in the order from left-to-right if the direction is set to 1.
+ */
+matrix matrixMathsAbsMin(const matrixView & X, matrix & Z, unsigned char indicatorType = 0, unsigned char direction = 0);
+
 /**
  * @brief matrixMathsCumulativeSum - Computes the cumulative sum for each of the vector of the
  *                                   matrix. The vector direction is defined by the input argument.
@@ -90,6 +142,17 @@ matrix matrixMathsAbsMin(const matrix & X, matrix & Z, unsigned char indicatorTy
  */
 matrix matrixMathsCumulativeSum(const matrix & X, unsigned char direction = 0);
 
+/**
+ * @brief matrixMathsCumulativeSum - Computes the cumulative sum for each of the vector of the
+ *                                   matrix. The vector direction is defined by the input argument.
+ * @param X                        - The view whose cumulative sum is to be calculated.
+ * @param direction                - Defines the direction of the vector;
+ *                                   0 -> column vector
+ *                                   1 -> row vector
+ * @return                         - The resultant cumulative sum vector matrix.
+ */
+matrix matrixMathsCumulativeSum(const matrixView & X, unsigned char direction = 0);
+
 /**
  * @brief matrixMathsMax - Finds the maximum value for each of the vector of the matrix.
  *                         The vector direction is defined by the input argument.
@@ -106,6 +169,22 @@ matrix matrixMathsCumulativeSum(const matrix & X, unsigned char direction = 0);
  */
 matrix matrixMathsMax(const matrix & X, matrix & Z, unsigned char indicatorType = 0, unsigned char direction = 0);
 
+/**
+ * @brief matrixMathsMax - Finds the maximum value for each of the vector of the view.
+ *                         The vector direction is defined by the input argument.
+ * @param X              - The view whose maximum value is to be determined.
+ * @param Z              - The resultant maximum value vector matrix.
+ * @param direction      - Defines the direction of the vector;
+ *                         0 -> column vector
+ *                         1 -> row vector
+ * @return               - The location of the maximum value of the vector, indicated by value 1.
+ *                         The position will take the first occurance of the maximum value in the
+ *                         order from top-to-bottom if the direction is set to 0.
+ *                         The position will take the first occurance of the maximum value in the
+ *                         order from left-to-right if the direction is set to 1.
+ */
+matrix matrixMathsMax(const matrixView & X, matrix & Z, unsigned char indicatorType = 0, unsigned char direction = 0);
+
 /**
  * @brief matrixMathsMin - Finds the minimum value for each of the vector of the matrix.
  *                         The vector direction is defined by the input argument.
@@ -122,6 +201,22 @@ matrix matrixMathsMax(const matrix & X, matrix & Z, unsigned char indicatorType
  */
 matrix matrixMathsMin(const matrix & X, matrix & Z, unsigned char indicatorType = 0, unsigned char direction = 0);
 
+/**
+ * @brief matrixMathsMin - Finds the minimum value for each of the vector of the view.
+ *                         The vector direction is defined by the input argument.
+ * @param X              - The view whose minimum value is to be determined.
+ * @param Z              - The resultant minimum value vector matrix.
+ * @param direction      - Defines the direction of the vector;
+ *                         0 -> column vector
+ *                         1 -> row vector
+ * @return               - The location of the minimum value of the vector, indicated by value 1.
+ *                         The position will take the first occurance of the minimum value in the
+ *                         order from top-to-bottom if the direction is set to 0.
+ *                         The position will take the first occurance of the minimum value in the
+ *                         order from left-to-right if the direction is set to 1.
+ */
+matrix matrixMathsMin(const matrixView & X, matrix & Z, unsigned char indicatorType = 0, unsigned char direction = 0);
+
 /**
  * @brief matrixMathsRootMeanSquare - Computes the root mean square for each of the vector of the
  *                                    matrix. The vector direction is defined by the input argument.
@@ -133,6 +228,17 @@ matrix matrixMathsMin(const matrix & X, matrix & Z, unsigned char indicatorType
  */
 matrix matrixMathsRootMeanSquare(const matrix & X, unsigned char direction = 0);
 
+/**
+ * @brief matrixMathsRootMeanSquare - Computes the root mean square for each of the vector of the
+ *                                    matrix. The vector direction is defined by the input argument.
+ * @param X                         - The view whose root mean square is to be calculated.
+ * @param direction                 - Defines the direction of the vector;
+ *                                    0 -> column vector
+ *                                    1 -> row vector
+ * @return                          - The resultant root mean square vector matrix.
+ */
+matrix matrixMathsRootMeanSquare(const matrixView & X, unsigned char direction = 0);
+
 /**
  * @brief matrixMathsRootMeanSquare - Computes the square root for each of the vector of the matrix.
  *                                    The vector direction is defined by the input argument.
@@ -144,6 +250,17 @@ matrix matrixMathsRootMeanSquare(const matrix & X, unsigned char direction = 0);
  */
 matrix matrixMathsSquareRoot(const matrix & X, unsigned char direction = 0);
 
+/**
+ * @brief matrixMathsRootMeanSquare - Computes the square root for each of the vector of the view.
+ *                                    The vector direction is defined by the input argument.
+ * @param X                         - The view whose RMS is to be calculated.
+ * @param direction                 - Defines the direction of the vector;
+ *                                    0 -> column vector
+ *                                    1 -> row vector
+ * @return                          - The resultant square root vector matrix.
+ */
+matrix matrixMathsSquareRoot(const matrixView & X, unsigned char direction = 0);
+
 /**
  * @brief matrixMathsSum - Computes the sum for each of the vector of the matrix. The vector
  *                         direction is defined by the input argument.
@@ -155,6 +272,17 @@ matrix matrixMathsSquareRoot(const matrix & X, unsigned char direction = 0);
  */
 matrix matrixMathsSum(const matrix & X, unsigned char direction = 0);
 
+/**
+ * @brief matrixMathsSum - Computes the sum for each of the vector of the view. The vector
+ *                         direction is defined by the input argument.
+ * @param X              - The view whose sum is to be calculated.
+ * @param direction      - Defines the direction of the vector;
+ *                         0 -> column vector
+ *                         1 -> row vector
+ * @return               - The resultant sum vector matrix.
+ */
+matrix matrixMathsSum(const matrixView & X, unsigned char direction = 0);
+
 /**
  * @brief matrixMathsVectorRootMeanSquare - Computes the root mean square of the input vector. The
  *                                          input vector must be a [N x 1] matrix.
@@ -163,6 +291,14 @@ matrix matrixMathsSum(const matrix & X, unsigned char direction = 0);
  */
 double matrixMathsVectorRootMeanSquare(const matrix & X);
 
+/**
+ * @brief matrixMathsVectorRootMeanSquare - Computes the root mean square of the input vector. The
+ *                                          input vector must be a [N x 1] matrix.
+ * @param X                               - The vector whose root mean square is to be calculated.
+ * @return                                - The computed root mean squre value.
+ */
+double matrixMathsVectorRootMeanSquare(const matrixView & X);
+
 /**
  * @brief matrixMathsVectorRootMeanSquare - Computes the square root of the input vector. The input
  *                                          vector must be a [N x 1] matrix.
@@ -171,6 +307,14 @@ double matrixMathsVectorRootMeanSquare(const matrix & X);
  */
 double matrixMathsVectorSquareRoot(const matrix & X);
 
+/**
+ * @brief matrixMathsVectorRootMeanSquare - Computes the square root of the input vector. The input
+ *                                          vector must be a [N x 1] matrix.
+ * @param X                               - The vector whose square root is to be calculated.
+ * @return                                - The computed square root value.
+ */
+double matrixMathsVectorSquareRoot(const matrixView & X);
+
 /**
  * @brief matrixMathsVectorRootMeanSquare - Computes the sum of the input vector. The input vector
  *                                          must be a [N x 1] matrix.
@@ -179,4 +323,12 @@ double matrixMathsVectorSquareRoot(const matrix & X);
  */
 double matrixMathsVectorSum(const matrix & X);
 
+/**
+ * @brief matrixMathsVectorRootMeanSquare - Computes the sum of the input vector. The input vector
+ *                                          must be a [N x 1] matrix.
+ * @param X                               - The vector whose sum is to be calculated.
+ * @return                                - The computed sum value.
+ */
+double matrixMathsVectorSum(const matrixView & X);
+
 #endif // MATRIXLIBRARYMATHS_H
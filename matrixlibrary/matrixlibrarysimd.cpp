@@ -0,0 +1,1081 @@
+/*
+ * Copyright:   2021 Johnathon Leong
+ *
+ * License:     License under LGPL-3.0-or-later.
+ *              Please refer to https://www.gnu.org/licenses/lgpl-3.0.txt for more information on the
+ *              terms of LGPL-3.0 or relavent website for a later version of the LGPL.
+ *
+ * Disclaimer:  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY
+ *              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ *              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ *              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ *              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *              WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author:      Johnathon Leong
+ *
+ * Note:        Runtime dispatched SIMD kernels used internally by matrixlibrary. The instruction set
+ *              is detected once, the first time the kernels are requested, and the fastest set of
+ *              kernels supported by the CPU is selected. All variants are compiled into the same
+ *              binary so that it runs on both older and newer x86 processors. On other platforms
+ *              the portable scalar kernels are used.
+ *
+ * Version:     1.0.2
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the matrix-vector "gemv" and vector-matrix "gevm" kernels of every kernel
+ *                 set.
+ *              2. Added the transpose micro kernels "transposeMicro" of every kernel set, with
+ *                 their block size "transposeNB".
+ *
+ * Version:     1.0.1
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the single precision GEMM micro kernels "gemmMicroFloat" of every kernel
+ *                 set, with their register block sizes "gemmMRFloat" and "gemmNRFloat".
+ *                 MATRIXSIMD_GEMM_NR_MAX is raised to 32 for the 8x32 AVX-512 kernel.
+ *
+ * Version:     1.0.0
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Implemented first release version of matrixlibrarysimd.
+ */
+#include "matrixlibrarysimd.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define MATRIXSIMD_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define MATRIXSIMD_TARGET(isa) __attribute__((target(isa)))
+#else
+#define MATRIXSIMD_TARGET(isa)
+#endif
+
+/// ================================================================================================
+/// STATIC FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief MATRIXSIMD_DEFINE_BINARY - Defines an element wise kernel between two arrays, Z = X op Y.
+ *                                   The main loop processes four vectors per iteration, followed by
+ *                                   single vectors and finally a scalar tail.
+ */
+#define MATRIXSIMD_DEFINE_BINARY(name, isa, vec, width, loadu, storeu, vop, op)                    \
+  MATRIXSIMD_TARGET(isa)                                                                           \
+  static void name(unsigned long n, const double * X, const double * Y, double * Z) {              \
+    unsigned long i = 0;                                                                           \
+    for (; i + 4 * width <= n; i += 4 * width) {                                                   \
+      vec z0 = vop(loadu(X + i), loadu(Y + i));                                                    \
+      vec z1 = vop(loadu(X + i + width), loadu(Y + i + width));                                    \
+      vec z2 = vop(loadu(X + i + 2 * width), loadu(Y + i + 2 * width));                            \
+      vec z3 = vop(loadu(X + i + 3 * width), loadu(Y + i + 3 * width));                            \
+      storeu(Z + i, z0);                                                                           \
+      storeu(Z + i + width, z1);                                                                   \
+      storeu(Z + i + 2 * width, z2);                                                               \
+      storeu(Z + i + 3 * width, z3);                                                               \
+    }                                                                                              \
+    for (; i + width <= n; i += width)                                                             \
+      storeu(Z + i, vop(loadu(X + i), loadu(Y + i)));                                              \
+    for (; i < n; i++)                                                                             \
+      Z[i] = X[i] op Y[i];                                                                         \
+  }
+
+/**
+ * @brief MATRIXSIMD_DEFINE_SCALAR - Defines an element wise kernel between an array and a value,
+ *                                   Z = X op Y.
+ */
+#define MATRIXSIMD_DEFINE_SCALAR(name, isa, vec, width, loadu, storeu, set1, vop, op)              \
+  MATRIXSIMD_TARGET(isa)                                                                           \
+  static void name(unsigned long n, const double * X, double Y, double * Z) {                      \
+    unsigned long i = 0;                                                                           \
+    vec y = set1(Y);                                                                               \
+    for (; i + 4 * width <= n; i += 4 * width) {                                                   \
+      vec z0 = vop(loadu(X + i), y);                                                               \
+      vec z1 = vop(loadu(X + i + width), y);                                                       \
+      vec z2 = vop(loadu(X + i + 2 * width), y);                                                   \
+      vec z3 = vop(loadu(X + i + 3 * width), y);                                                   \
+      storeu(Z + i, z0);                                                                           \
+      storeu(Z + i + width, z1);                                                                   \
+      storeu(Z + i + 2 * width, z2);                                                               \
+      storeu(Z + i + 3 * width, z3);                                                               \
+    }                                                                                              \
+    for (; i + width <= n; i += width)                                                             \
+      storeu(Z + i, vop(loadu(X + i), y));                                                         \
+    for (; i < n; i++)                                                                             \
+      Z[i] = X[i] op Y;                                                                            \
+  }
+
+/**
+ * @brief MATRIXSIMD_DEFINE_GEMV - Defines a matrix-vector kernel, y = alpha * A * x + beta * y.
+ *                                 Four rows of A are streamed at once against the same loads of
+ *                                 x, each row accumulating into its own vector register that is
+ *                                 reduced at the end of the row.
+ */
+#define MATRIXSIMD_DEFINE_GEMV(name, isa, vec, width, loadu, setzero, fmadd, reduce)              \
+  MATRIXSIMD_TARGET(isa)                                                                           \
+  static void name(unsigned long m, unsigned long n, double alpha, const double * A,               \
+                   unsigned long lda, const double * x, double beta, double * y,                   \
+                   unsigned long incy) {                                                           \
+    unsigned long i = 0;                                                                           \
+    for (; i + 4 <= m; i += 4) {                                                                   \
+      const double * a0 = A + i * lda;                                                             \
+      const double * a1 = a0 + lda;                                                                \
+      const double * a2 = a1 + lda;                                                                \
+      const double * a3 = a2 + lda;                                                                \
+      vec s0 = setzero(), s1 = setzero(), s2 = setzero(), s3 = setzero();                          \
+      unsigned long j = 0;                                                                         \
+      for (; j + width <= n; j += width) {                                                         \
+        vec v = loadu(x + j);                                                                      \
+        s0 = fmadd(loadu(a0 + j), v, s0);                                                          \
+        s1 = fmadd(loadu(a1 + j), v, s1);                                                          \
+        s2 = fmadd(loadu(a2 + j), v, s2);                                                          \
+        s3 = fmadd(loadu(a3 + j), v, s3);                                                          \
+      }                                                                                            \
+      double r0 = reduce(s0), r1 = reduce(s1), r2 = reduce(s2), r3 = reduce(s3);                   \
+      for (; j < n; j++) {                                                                         \
+        r0 += a0[j] * x[j];                                                                        \
+        r1 += a1[j] * x[j];                                                                        \
+        r2 += a2[j] * x[j];                                                                        \
+        r3 += a3[j] * x[j];                                                                        \
+      }                                                                                            \
+      matrixSimdGemvStore(y + i * incy, r0, alpha, beta);                                          \
+      matrixSimdGemvStore(y + (i + 1) * incy, r1, alpha, beta);                                    \
+      matrixSimdGemvStore(y + (i + 2) * incy, r2, alpha, beta);                                    \
+      matrixSimdGemvStore(y + (i + 3) * incy, r3, alpha, beta);                                    \
+    }                                                                                              \
+    for (; i < m; i++) {                                                                           \
+      const double * a0 = A + i * lda;                                                             \
+      vec s0 = setzero();                                                                          \
+      unsigned long j = 0;                                                                         \
+      for (; j + width <= n; j += width)                                                           \
+        s0 = fmadd(loadu(a0 + j), loadu(x + j), s0);                                               \
+      double r0 = reduce(s0);                                                                      \
+      for (; j < n; j++)                                                                           \
+        r0 += a0[j] * x[j];                                                                        \
+      matrixSimdGemvStore(y + i * incy, r0, alpha, beta);                                          \
+    }                                                                                              \
+  }
+
+/**
+ * @brief MATRIXSIMD_DEFINE_GEVM - Defines a vector-matrix kernel, y += alpha * x * A. Four rows of
+ *                                 A are accumulated into every load and store of y, which cuts the
+ *                                 traffic on y by four.
+ */
+#define MATRIXSIMD_DEFINE_GEVM(name, isa, vec, width, loadu, storeu, set1, fmadd)                  \
+  MATRIXSIMD_TARGET(isa)                                                                           \
+  static void name(unsigned long m, unsigned long n, double alpha, const double * A,               \
+                   unsigned long lda, const double * x, unsigned long incx, double * y) {          \
+    unsigned long i = 0;                                                                           \
+    for (; i + 4 <= m; i += 4) {                                                                   \
+      const double * a0 = A + i * lda;                                                             \
+      const double * a1 = a0 + lda;                                                                \
+      const double * a2 = a1 + lda;                                                                \
+      const double * a3 = a2 + lda;                                                                \
+      double x0 = alpha * x[i * incx], x1 = alpha * x[(i + 1) * incx];                             \
+      double x2 = alpha * x[(i + 2) * incx], x3 = alpha * x[(i + 3) * incx];                       \
+      vec v0 = set1(x0), v1 = set1(x1), v2 = set1(x2), v3 = set1(x3);                              \
+      unsigned long j = 0;                                                                         \
+      for (; j + width <= n; j += width) {                                                         \
+        vec t = loadu(y + j);                                                                      \
+        t = fmadd(v0, loadu(a0 + j), t);                                                           \
+        t = fmadd(v1, loadu(a1 + j), t);                                                           \
+        t = fmadd(v2, loadu(a2 + j), t);                                                           \
+        t = fmadd(v3, loadu(a3 + j), t);                                                           \
+        storeu(y + j, t);                                                                          \
+      }                                                                                            \
+      for (; j < n; j++)                                                                           \
+        y[j] += x0 * a0[j] + x1 * a1[j] + x2 * a2[j] + x3 * a3[j];                                 \
+    }                                                                                              \
+    for (; i < m; i++) {                                                                           \
+      const double * a0 = A + i * lda;                                                             \
+      double x0 = alpha * x[i * incx];                                                             \
+      vec v0 = set1(x0);                                                                           \
+      unsigned long j = 0;                                                                         \
+      for (; j + width <= n; j += width)                                                           \
+        storeu(y + j, fmadd(v0, loadu(a0 + j), loadu(y + j)));                                     \
+      for (; j < n; j++)                                                                           \
+        y[j] += x0 * a0[j];                                                                        \
+    }                                                                                              \
+  }
+
+/**
+ * @brief matrixSimdGemvStore - Stores an element of the result of a matrix-vector kernel,
+ *                              y = alpha * s + beta * y. y is not read when beta is zero.
+ * @param y                   - Pointer to the element.
+ * @param s                   - The dot product of the row.
+ * @param alpha               - Scaling of the dot product.
+ * @param beta                - Scaling of y.
+ */
+static inline void matrixSimdGemvStore(double * y, double s, double alpha, double beta) {
+  *y = (beta == 0.0) ? alpha * s : beta * *y + alpha * s;
+} // void matrixSimdGemvStore(double * y, double s, double alpha, double beta) ---------------------
+
+/// ------------------------------------------------------------------------------------------------
+/// Portable scalar kernels
+/// ------------------------------------------------------------------------------------------------
+/**
+ * @brief matrixSimdAddGeneric - Portable kernel, Z[i] = X[i] + Y[i].
+ */
+static void matrixSimdAddGeneric(unsigned long n, const double * X, const double * Y, double * Z) {
+  for (unsigned long i = 0; i < n; i++)
+    Z[i] = X[i] + Y[i];
+} // void matrixSimdAddGeneric(unsigned long n, const double * X, const double * Y, double * Z) ----
+
+/**
+ * @brief matrixSimdSubtractGeneric - Portable kernel, Z[i] = X[i] - Y[i].
+ */
+static void matrixSimdSubtractGeneric(unsigned long n, const double * X, const double * Y, double * Z) {
+  for (unsigned long i = 0; i < n; i++)
+    Z[i] = X[i] - Y[i];
+} // void matrixSimdSubtractGeneric(unsigned long n, const double * X, const double * Y, double * Z)
+
+/**
+ * @brief matrixSimdMultiplyGeneric - Portable kernel, Z[i] = X[i] * Y[i].
+ */
+static void matrixSimdMultiplyGeneric(unsigned long n, const double * X, const double * Y, double * Z) {
+  for (unsigned long i = 0; i < n; i++)
+    Z[i] = X[i] * Y[i];
+} // void matrixSimdMultiplyGeneric(unsigned long n, const double * X, const double * Y, double * Z)
+
+/**
+ * @brief matrixSimdDivideGeneric - Portable kernel, Z[i] = X[i] / Y[i].
+ */
+static void matrixSimdDivideGeneric(unsigned long n, const double * X, const double * Y, double * Z) {
+  for (unsigned long i = 0; i < n; i++)
+    Z[i] = X[i] / Y[i];
+} // void matrixSimdDivideGeneric(unsigned long n, const double * X, const double * Y, double * Z)
+
+/**
+ * @brief matrixSimdAddScalarGeneric - Portable kernel, Z[i] = X[i] + Y.
+ */
+static void matrixSimdAddScalarGeneric(unsigned long n, const double * X, double Y, double * Z) {
+  for (unsigned long i = 0; i < n; i++)
+    Z[i] = X[i] + Y;
+} // void matrixSimdAddScalarGeneric(unsigned long n, const double * X, double Y, double * Z) ------
+
+/**
+ * @brief matrixSimdSubtractScalarGeneric - Portable kernel, Z[i] = X[i] - Y.
+ */
+static void matrixSimdSubtractScalarGeneric(unsigned long n, const double * X, double Y, double * Z) {
+  for (unsigned long i = 0; i < n; i++)
+    Z[i] = X[i] - Y;
+} // void matrixSimdSubtractScalarGeneric(unsigned long n, const double * X, double Y, double * Z)
+
+/**
+ * @brief matrixSimdMultiplyScalarGeneric - Portable kernel, Z[i] = X[i] * Y.
+ */
+static void matrixSimdMultiplyScalarGeneric(unsigned long n, const double * X, double Y, double * Z) {
+  for (unsigned long i = 0; i < n; i++)
+    Z[i] = X[i] * Y;
+} // void matrixSimdMultiplyScalarGeneric(unsigned long n, const double * X, double Y, double * Z)
+
+/**
+ * @brief matrixSimdDivideScalarGeneric - Portable kernel, Z[i] = X[i] / Y.
+ */
+static void matrixSimdDivideScalarGeneric(unsigned long n, const double * X, double Y, double * Z) {
+  for (unsigned long i = 0; i < n; i++)
+    Z[i] = X[i] / Y;
+} // void matrixSimdDivideScalarGeneric(unsigned long n, const double * X, double Y, double * Z) ---
+
+/**
+ * @brief matrixSimdGemmMicroGeneric - Portable 4x8 GEMM micro kernel.
+ */
+static void matrixSimdGemmMicroGeneric(unsigned long kc, double alpha, const double * A,
+                                         const double * B, double beta, double * C,
+                                         unsigned long ldc) {
+  double AB[4 * 8] = {0};
+
+  for (unsigned long p = 0; p < kc; p++) {
+    for (unsigned long i = 0; i < 4; i++) {
+      double a = A[i];
+      for (unsigned long j = 0; j < 8; j++)
+        AB[i * 8 + j] += a * B[j];
+    }
+    A += 4;
+    B += 8;
+  }
+
+  for (unsigned long i = 0; i < 4; i++) {
+    double * c = C + i * ldc;
+    const double * ab = AB + i * 8;
+    if (beta == 0.0) {
+      for (unsigned long j = 0; j < 8; j++)
+        c[j] = alpha * ab[j];
+    }
+    else {
+      for (unsigned long j = 0; j < 8; j++)
+        c[j] = beta * c[j] + alpha * ab[j];
+    }
+  }
+} // void matrixSimdGemmMicroGeneric(unsigned long kc, double alpha, const double * A, const double * B, double beta, double * C, unsigned long ldc)
+
+/**
+ * @brief matrixSimdGemmMicroFloatGeneric - Portable 4x8 single precision GEMM micro kernel.
+ */
+static void matrixSimdGemmMicroFloatGeneric(unsigned long kc, float alpha, const float * A,
+                                            const float * B, float beta, float * C,
+                                            unsigned long ldc) {
+  float AB[4 * 8] = {0};
+
+  for (unsigned long p = 0; p < kc; p++) {
+    for (unsigned long i = 0; i < 4; i++) {
+      float a = A[i];
+      for (unsigned long j = 0; j < 8; j++)
+        AB[i * 8 + j] += a * B[j];
+    }
+    A += 4;
+    B += 8;
+  }
+
+  for (unsigned long i = 0; i < 4; i++) {
+    float * c = C + i * ldc;
+    const float * ab = AB + i * 8;
+    if (beta == 0.0f) {
+      for (unsigned long j = 0; j < 8; j++)
+        c[j] = alpha * ab[j];
+    }
+    else {
+      for (unsigned long j = 0; j < 8; j++)
+        c[j] = beta * c[j] + alpha * ab[j];
+    }
+  }
+} // void matrixSimdGemmMicroFloatGeneric(unsigned long kc, float alpha, const float * A, const float * B, float beta, float * C, unsigned long ldc)
+
+/**
+ * @brief matrixSimdGemvGeneric - Portable matrix-vector kernel, y = alpha * A * x + beta * y.
+ */
+static void matrixSimdGemvGeneric(unsigned long m, unsigned long n, double alpha, const double * A,
+                                  unsigned long lda, const double * x, double beta, double * y,
+                                  unsigned long incy) {
+  for (unsigned long i = 0; i < m; i++) {
+    const double * a = A + i * lda;
+    double s = 0.0;
+    for (unsigned long j = 0; j < n; j++)
+      s += a[j] * x[j];
+    matrixSimdGemvStore(y + i * incy, s, alpha, beta);
+  }
+} // void matrixSimdGemvGeneric(unsigned long m, unsigned long n, double alpha, const double * A, unsigned long lda, const double * x, double beta, double * y, unsigned long incy)
+
+/**
+ * @brief matrixSimdGevmGeneric - Portable vector-matrix kernel, y += alpha * x * A.
+ */
+static void matrixSimdGevmGeneric(unsigned long m, unsigned long n, double alpha, const double * A,
+                                  unsigned long lda, const double * x, unsigned long incx,
+                                  double * y) {
+  for (unsigned long i = 0; i < m; i++) {
+    const double * a = A + i * lda;
+    double s = alpha * x[i * incx];
+    for (unsigned long j = 0; j < n; j++)
+      y[j] += s * a[j];
+  }
+} // void matrixSimdGevmGeneric(unsigned long m, unsigned long n, double alpha, const double * A, unsigned long lda, const double * x, unsigned long incx, double * y)
+
+/**
+ * @brief matrixSimdTransposeGeneric - Portable 4x4 transpose micro kernel.
+ */
+static void matrixSimdTransposeGeneric(const double * X, unsigned long ldx, double * Z,
+                                       unsigned long ldz) {
+  for (unsigned long i = 0; i < 4; i++)
+    for (unsigned long j = 0; j < 4; j++)
+      Z[j * ldz + i] = X[i * ldx + j];
+} // void matrixSimdTransposeGeneric(const double * X, unsigned long ldx, double * Z, unsigned long ldz)
+
+#if defined(MATRIXSIMD_X86)
+/// ------------------------------------------------------------------------------------------------
+/// SSE2 kernels
+/// ------------------------------------------------------------------------------------------------
+MATRIXSIMD_DEFINE_BINARY(matrixSimdAddSse2, "sse2", __m128d, 2, _mm_loadu_pd, _mm_storeu_pd,
+                         _mm_add_pd, +)
+MATRIXSIMD_DEFINE_BINARY(matrixSimdSubtractSse2, "sse2", __m128d, 2, _mm_loadu_pd, _mm_storeu_pd,
+                         _mm_sub_pd, -)
+MATRIXSIMD_DEFINE_BINARY(matrixSimdMultiplySse2, "sse2", __m128d, 2, _mm_loadu_pd, _mm_storeu_pd,
+                         _mm_mul_pd, *)
+MATRIXSIMD_DEFINE_BINARY(matrixSimdDivideSse2, "sse2", __m128d, 2, _mm_loadu_pd, _mm_storeu_pd,
+                         _mm_div_pd, /)
+MATRIXSIMD_DEFINE_SCALAR(matrixSimdAddScalarSse2, "sse2", __m128d, 2, _mm_loadu_pd, _mm_storeu_pd,
+                         _mm_set1_pd, _mm_add_pd, +)
+MATRIXSIMD_DEFINE_SCALAR(matrixSimdSubtractScalarSse2, "sse2", __m128d, 2, _mm_loadu_pd,
+                         _mm_storeu_pd, _mm_set1_pd, _mm_sub_pd, -)
+MATRIXSIMD_DEFINE_SCALAR(matrixSimdMultiplyScalarSse2, "sse2", __m128d, 2, _mm_loadu_pd,
+                         _mm_storeu_pd, _mm_set1_pd, _mm_mul_pd, *)
+MATRIXSIMD_DEFINE_SCALAR(matrixSimdDivideScalarSse2, "sse2", __m128d, 2, _mm_loadu_pd,
+                         _mm_storeu_pd, _mm_set1_pd, _mm_div_pd, /)
+
+/**
+ * @brief matrixSimdFmaddSse2 - Multiply-add, a * b + c, SSE2 having no fused instruction.
+ */
+MATRIXSIMD_TARGET("sse2")
+static inline __m128d matrixSimdFmaddSse2(__m128d a, __m128d b, __m128d c) {
+  return _mm_add_pd(_mm_mul_pd(a, b), c);
+} // __m128d matrixSimdFmaddSse2(__m128d a, __m128d b, __m128d c) ----------------------------------
+
+/**
+ * @brief matrixSimdReduceSse2 - Horizontal sum of the two lanes of a register.
+ */
+MATRIXSIMD_TARGET("sse2")
+static inline double matrixSimdReduceSse2(__m128d v) {
+  return _mm_cvtsd_f64(_mm_add_sd(v, _mm_unpackhi_pd(v, v)));
+} // double matrixSimdReduceSse2(__m128d v) --------------------------------------------------------
+
+MATRIXSIMD_DEFINE_GEMV(matrixSimdGemvSse2, "sse2", __m128d, 2, _mm_loadu_pd, _mm_setzero_pd,
+                       matrixSimdFmaddSse2, matrixSimdReduceSse2)
+MATRIXSIMD_DEFINE_GEVM(matrixSimdGevmSse2, "sse2", __m128d, 2, _mm_loadu_pd, _mm_storeu_pd,
+                       _mm_set1_pd, matrixSimdFmaddSse2)
+
+/**
+ * @brief matrixSimdTransposeSse2 - 2x2 transpose micro kernel.
+ */
+MATRIXSIMD_TARGET("sse2")
+static void matrixSimdTransposeSse2(const double * X, unsigned long ldx, double * Z,
+                                    unsigned long ldz) {
+  __m128d r0 = _mm_loadu_pd(X);
+  __m128d r1 = _mm_loadu_pd(X + ldx);
+  _mm_storeu_pd(Z, _mm_unpacklo_pd(r0, r1));
+  _mm_storeu_pd(Z + ldz, _mm_unpackhi_pd(r0, r1));
+} // void matrixSimdTransposeSse2(const double * X, unsigned long ldx, double * Z, unsigned long ldz)
+
+#define MATRIXSIMD_SSE2_ROW(r)                                                                     \
+  a = _mm_set1_pd(A[r]);                                                                           \
+  c##r##0 = _mm_add_pd(c##r##0, _mm_mul_pd(a, b0));                                                \
+  c##r##1 = _mm_add_pd(c##r##1, _mm_mul_pd(a, b1));
+
+#define MATRIXSIMD_SSE2_STORE(v, ptr)                                                              \
+  {                                                                                                \
+    __m128d t = _mm_mul_pd(v, valpha);                                                             \
+    if (beta != 0.0)                                                                               \
+      t = _mm_add_pd(t, _mm_mul_pd(vbeta, _mm_loadu_pd(ptr)));                                     \
+    _mm_storeu_pd(ptr, t);                                                                         \
+  }
+
+/**
+ * @brief matrixSimdGemmMicroSse2 - 4x4 GEMM micro kernel holding the block of C in eight 128-bit
+ *                                  registers.
+ */
+MATRIXSIMD_TARGET("sse2")
+static void matrixSimdGemmMicroSse2(unsigned long kc, double alpha, const double * A,
+                                    const double * B, double beta, double * C, unsigned long ldc) {
+  __m128d c00 = _mm_setzero_pd(), c01 = _mm_setzero_pd();
+  __m128d c10 = _mm_setzero_pd(), c11 = _mm_setzero_pd();
+  __m128d c20 = _mm_setzero_pd(), c21 = _mm_setzero_pd();
+  __m128d c30 = _mm_setzero_pd(), c31 = _mm_setzero_pd();
+  __m128d a, b0, b1;
+
+  for (unsigned long p = 0; p < kc; p++) {
+    b0 = _mm_loadu_pd(B);
+    b1 = _mm_loadu_pd(B + 2);
+    MATRIXSIMD_SSE2_ROW(0)
+    MATRIXSIMD_SSE2_ROW(1)
+    MATRIXSIMD_SSE2_ROW(2)
+    MATRIXSIMD_SSE2_ROW(3)
+    A += 4;
+    B += 4;
+  }
+
+  __m128d valpha = _mm_set1_pd(alpha);
+  __m128d vbeta = _mm_set1_pd(beta);
+  MATRIXSIMD_SSE2_STORE(c00, C)
+  MATRIXSIMD_SSE2_STORE(c01, C + 2)
+  MATRIXSIMD_SSE2_STORE(c10, C + ldc)
+  MATRIXSIMD_SSE2_STORE(c11, C + ldc + 2)
+  MATRIXSIMD_SSE2_STORE(c20, C + 2 * ldc)
+  MATRIXSIMD_SSE2_STORE(c21, C + 2 * ldc + 2)
+  MATRIXSIMD_SSE2_STORE(c30, C + 3 * ldc)
+  MATRIXSIMD_SSE2_STORE(c31, C + 3 * ldc + 2)
+} // void matrixSimdGemmMicroSse2(unsigned long kc, double alpha, const double * A, const double * B, double beta, double * C, unsigned long ldc)
+
+#define MATRIXSIMD_SSE2_FLOAT_ROW(r)                                                               \
+  a = _mm_set1_ps(A[r]);                                                                           \
+  c##r##0 = _mm_add_ps(c##r##0, _mm_mul_ps(a, b0));                                                \
+  c##r##1 = _mm_add_ps(c##r##1, _mm_mul_ps(a, b1));
+
+#define MATRIXSIMD_SSE2_FLOAT_STORE(v, ptr)                                                        \
+  {                                                                                                \
+    __m128 t = _mm_mul_ps(v, valpha);                                                              \
+    if (beta != 0.0f)                                                                              \
+      t = _mm_add_ps(t, _mm_mul_ps(vbeta, _mm_loadu_ps(ptr)));                                     \
+    _mm_storeu_ps(ptr, t);                                                                         \
+  }
+
+/**
+ * @brief matrixSimdGemmMicroFloatSse2 - 4x8 single precision GEMM micro kernel holding the block
+ *                                       of C in eight 128-bit registers.
+ */
+MATRIXSIMD_TARGET("sse2")
+static void matrixSimdGemmMicroFloatSse2(unsigned long kc, float alpha, const float * A,
+                                         const float * B, float beta, float * C,
+                                         unsigned long ldc) {
+  __m128 c00 = _mm_setzero_ps(), c01 = _mm_setzero_ps();
+  __m128 c10 = _mm_setzero_ps(), c11 = _mm_setzero_ps();
+  __m128 c20 = _mm_setzero_ps(), c21 = _mm_setzero_ps();
+  __m128 c30 = _mm_setzero_ps(), c31 = _mm_setzero_ps();
+  __m128 a, b0, b1;
+
+  for (unsigned long p = 0; p < kc; p++) {
+    b0 = _mm_loadu_ps(B);
+    b1 = _mm_loadu_ps(B + 4);
+    MATRIXSIMD_SSE2_FLOAT_ROW(0)
+    MATRIXSIMD_SSE2_FLOAT_ROW(1)
+    MATRIXSIMD_SSE2_FLOAT_ROW(2)
+    MATRIXSIMD_SSE2_FLOAT_ROW(3)
+    A += 4;
+    B += 8;
+  }
+
+  __m128 valpha = _mm_set1_ps(alpha);
+  __m128 vbeta = _mm_set1_ps(beta);
+  MATRIXSIMD_SSE2_FLOAT_STORE(c00, C)
+  MATRIXSIMD_SSE2_FLOAT_STORE(c01, C + 4)
+  MATRIXSIMD_SSE2_FLOAT_STORE(c10, C + ldc)
+  MATRIXSIMD_SSE2_FLOAT_STORE(c11, C + ldc + 4)
+  MATRIXSIMD_SSE2_FLOAT_STORE(c20, C + 2 * ldc)
+  MATRIXSIMD_SSE2_FLOAT_STORE(c21, C + 2 * ldc + 4)
+  MATRIXSIMD_SSE2_FLOAT_STORE(c30, C + 3 * ldc)
+  MATRIXSIMD_SSE2_FLOAT_STORE(c31, C + 3 * ldc + 4)
+} // void matrixSimdGemmMicroFloatSse2(unsigned long kc, float alpha, const float * A, const float * B, float beta, float * C, unsigned long ldc)
+
+/// ------------------------------------------------------------------------------------------------
+/// AVX2 and FMA kernels
+/// ------------------------------------------------------------------------------------------------
+MATRIXSIMD_DEFINE_BINARY(matrixSimdAddAvx2, "avx2,fma", __m256d, 4, _mm256_loadu_pd,
+                         _mm256_storeu_pd, _mm256_add_pd, +)
+MATRIXSIMD_DEFINE_BINARY(matrixSimdSubtractAvx2, "avx2,fma", __m256d, 4, _mm256_loadu_pd,
+                         _mm256_storeu_pd, _mm256_sub_pd, -)
+MATRIXSIMD_DEFINE_BINARY(matrixSimdMultiplyAvx2, "avx2,fma", __m256d, 4, _mm256_loadu_pd,
+                         _mm256_storeu_pd, _mm256_mul_pd, *)
+MATRIXSIMD_DEFINE_BINARY(matrixSimdDivideAvx2, "avx2,fma", __m256d, 4, _mm256_loadu_pd,
+                         _mm256_storeu_pd, _mm256_div_pd, /)
+MATRIXSIMD_DEFINE_SCALAR(matrixSimdAddScalarAvx2, "avx2,fma", __m256d, 4, _mm256_loadu_pd,
+                         _mm256_storeu_pd, _mm256_set1_pd, _mm256_add_pd, +)
+MATRIXSIMD_DEFINE_SCALAR(matrixSimdSubtractScalarAvx2, "avx2,fma", __m256d, 4, _mm256_loadu_pd,
+                         _mm256_storeu_pd, _mm256_set1_pd, _mm256_sub_pd, -)
+MATRIXSIMD_DEFINE_SCALAR(matrixSimdMultiplyScalarAvx2, "avx2,fma", __m256d, 4, _mm256_loadu_pd,
+                         _mm256_storeu_pd, _mm256_set1_pd, _mm256_mul_pd, *)
+MATRIXSIMD_DEFINE_SCALAR(matrixSimdDivideScalarAvx2, "avx2,fma", __m256d, 4, _mm256_loadu_pd,
+                         _mm256_storeu_pd, _mm256_set1_pd, _mm256_div_pd, /)
+
+/**
+ * @brief matrixSimdReduceAvx2 - Horizontal sum of the four lanes of a register.
+ */
+MATRIXSIMD_TARGET("avx2,fma")
+static inline double matrixSimdReduceAvx2(__m256d v) {
+  __m128d s = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+  return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+} // double matrixSimdReduceAvx2(__m256d v) --------------------------------------------------------
+
+MATRIXSIMD_DEFINE_GEMV(matrixSimdGemvAvx2, "avx2,fma", __m256d, 4, _mm256_loadu_pd,
+                       _mm256_setzero_pd, _mm256_fmadd_pd, matrixSimdReduceAvx2)
+MATRIXSIMD_DEFINE_GEVM(matrixSimdGevmAvx2, "avx2,fma", __m256d, 4, _mm256_loadu_pd,
+                       _mm256_storeu_pd, _mm256_set1_pd, _mm256_fmadd_pd)
+
+/**
+ * @brief matrixSimdTransposeAvx2 - 4x4 transpose micro kernel. Pairs of rows are interleaved
+ *                                  within the 128-bit lanes, then the lanes are exchanged.
+ */
+MATRIXSIMD_TARGET("avx2,fma")
+static void matrixSimdTransposeAvx2(const double * X, unsigned long ldx, double * Z,
+                                    unsigned long ldz) {
+  __m256d r0 = _mm256_loadu_pd(X);
+  __m256d r1 = _mm256_loadu_pd(X + ldx);
+  __m256d r2 = _mm256_loadu_pd(X + 2 * ldx);
+  __m256d r3 = _mm256_loadu_pd(X + 3 * ldx);
+  __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+  __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+  __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+  __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+  _mm256_storeu_pd(Z, _mm256_permute2f128_pd(t0, t2, 0x20));
+  _mm256_storeu_pd(Z + ldz, _mm256_permute2f128_pd(t1, t3, 0x20));
+  _mm256_storeu_pd(Z + 2 * ldz, _mm256_permute2f128_pd(t0, t2, 0x31));
+  _mm256_storeu_pd(Z + 3 * ldz, _mm256_permute2f128_pd(t1, t3, 0x31));
+} // void matrixSimdTransposeAvx2(const double * X, unsigned long ldx, double * Z, unsigned long ldz)
+
+#define MATRIXSIMD_AVX2_ROW(r)                                                                     \
+  a = _mm256_broadcast_sd(A + r);                                                                  \
+  c##r##0 = _mm256_fmadd_pd(a, b0, c##r##0);                                                       \
+  c##r##1 = _mm256_fmadd_pd(a, b1, c##r##1);
+
+#define MATRIXSIMD_AVX2_STORE(v, ptr)                                                              \
+  {                                                                                                \
+    __m256d t = _mm256_mul_pd(v, valpha);                                                          \
+    if (beta != 0.0)                                                                               \
+      t = _mm256_fmadd_pd(vbeta, _mm256_loadu_pd(ptr), t);                                         \
+    _mm256_storeu_pd(ptr, t);                                                                      \
+  }
+
+/**
+ * @brief matrixSimdGemmMicroAvx2 - 6x8 GEMM micro kernel holding the block of C in twelve 256-bit
+ *                                  registers, leaving room for two rows of B and one broadcast of
+ *                                  A within the sixteen available registers.
+ */
+MATRIXSIMD_TARGET("avx2,fma")
+static void matrixSimdGemmMicroAvx2(unsigned long kc, double alpha, const double * A,
+                                    const double * B, double beta, double * C, unsigned long ldc) {
+  __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+  __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+  __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+  __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+  __m256d c40 = _mm256_setzero_pd(), c41 = _mm256_setzero_pd();
+  __m256d c50 = _mm256_setzero_pd(), c51 = _mm256_setzero_pd();
+  __m256d a, b0, b1;
+
+  for (unsigned long p = 0; p < kc; p++) {
+    b0 = _mm256_loadu_pd(B);
+    b1 = _mm256_loadu_pd(B + 4);
+    MATRIXSIMD_AVX2_ROW(0)
+    MATRIXSIMD_AVX2_ROW(1)
+    MATRIXSIMD_AVX2_ROW(2)
+    MATRIXSIMD_AVX2_ROW(3)
+    MATRIXSIMD_AVX2_ROW(4)
+    MATRIXSIMD_AVX2_ROW(5)
+    A += 6;
+    B += 8;
+  }
+
+  __m256d valpha = _mm256_set1_pd(alpha);
+  __m256d vbeta = _mm256_set1_pd(beta);
+  MATRIXSIMD_AVX2_STORE(c00, C)
+  MATRIXSIMD_AVX2_STORE(c01, C + 4)
+  MATRIXSIMD_AVX2_STORE(c10, C + ldc)
+  MATRIXSIMD_AVX2_STORE(c11, C + ldc + 4)
+  MATRIXSIMD_AVX2_STORE(c20, C + 2 * ldc)
+  MATRIXSIMD_AVX2_STORE(c21, C + 2 * ldc + 4)
+  MATRIXSIMD_AVX2_STORE(c30, C + 3 * ldc)
+  MATRIXSIMD_AVX2_STORE(c31, C + 3 * ldc + 4)
+  MATRIXSIMD_AVX2_STORE(c40, C + 4 * ldc)
+  MATRIXSIMD_AVX2_STORE(c41, C + 4 * ldc + 4)
+  MATRIXSIMD_AVX2_STORE(c50, C + 5 * ldc)
+  MATRIXSIMD_AVX2_STORE(c51, C + 5 * ldc + 4)
+} // void matrixSimdGemmMicroAvx2(unsigned long kc, double alpha, const double * A, const double * B, double beta, double * C, unsigned long ldc)
+
+#define MATRIXSIMD_AVX2_FLOAT_ROW(r)                                                               \
+  a = _mm256_broadcast_ss(A + r);                                                                  \
+  c##r##0 = _mm256_fmadd_ps(a, b0, c##r##0);                                                       \
+  c##r##1 = _mm256_fmadd_ps(a, b1, c##r##1);
+
+#define MATRIXSIMD_AVX2_FLOAT_STORE(v, ptr)                                                        \
+  {                                                                                                \
+    __m256 t = _mm256_mul_ps(v, valpha);                                                           \
+    if (beta != 0.0f)                                                                              \
+      t = _mm256_fmadd_ps(vbeta, _mm256_loadu_ps(ptr), t);                                         \
+    _mm256_storeu_ps(ptr, t);                                                                      \
+  }
+
+/**
+ * @brief matrixSimdGemmMicroFloatAvx2 - 6x16 single precision GEMM micro kernel, with the same
+ *                                       register layout as "matrixSimdGemmMicroAvx2()".
+ */
+MATRIXSIMD_TARGET("avx2,fma")
+static void matrixSimdGemmMicroFloatAvx2(unsigned long kc, float alpha, const float * A,
+                                         const float * B, float beta, float * C,
+                                         unsigned long ldc) {
+  __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+  __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+  __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+  __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+  __m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+  __m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+  __m256 a, b0, b1;
+
+  for (unsigned long p = 0; p < kc; p++) {
+    b0 = _mm256_loadu_ps(B);
+    b1 = _mm256_loadu_ps(B + 8);
+    MATRIXSIMD_AVX2_FLOAT_ROW(0)
+    MATRIXSIMD_AVX2_FLOAT_ROW(1)
+    MATRIXSIMD_AVX2_FLOAT_ROW(2)
+    MATRIXSIMD_AVX2_FLOAT_ROW(3)
+    MATRIXSIMD_AVX2_FLOAT_ROW(4)
+    MATRIXSIMD_AVX2_FLOAT_ROW(5)
+    A += 6;
+    B += 16;
+  }
+
+  __m256 valpha = _mm256_set1_ps(alpha);
+  __m256 vbeta = _mm256_set1_ps(beta);
+  MATRIXSIMD_AVX2_FLOAT_STORE(c00, C)
+  MATRIXSIMD_AVX2_FLOAT_STORE(c01, C + 8)
+  MATRIXSIMD_AVX2_FLOAT_STORE(c10, C + ldc)
+  MATRIXSIMD_AVX2_FLOAT_STORE(c11, C + ldc + 8)
+  MATRIXSIMD_AVX2_FLOAT_STORE(c20, C + 2 * ldc)
+  MATRIXSIMD_AVX2_FLOAT_STORE(c21, C + 2 * ldc + 8)
+  MATRIXSIMD_AVX2_FLOAT_STORE(c30, C + 3 * ldc)
+  MATRIXSIMD_AVX2_FLOAT_STORE(c31, C + 3 * ldc + 8)
+  MATRIXSIMD_AVX2_FLOAT_STORE(c40, C + 4 * ldc)
+  MATRIXSIMD_AVX2_FLOAT_STORE(c41, C + 4 * ldc + 8)
+  MATRIXSIMD_AVX2_FLOAT_STORE(c50, C + 5 * ldc)
+  MATRIXSIMD_AVX2_FLOAT_STORE(c51, C + 5 * ldc + 8)
+} // void matrixSimdGemmMicroFloatAvx2(unsigned long kc, float alpha, const float * A, const float * B, float beta, float * C, unsigned long ldc)
+
+/// ------------------------------------------------------------------------------------------------
+/// AVX-512 kernels
+/// ------------------------------------------------------------------------------------------------
+MATRIXSIMD_DEFINE_BINARY(matrixSimdAddAvx512, "avx512f", __m512d, 8, _mm512_loadu_pd,
+                         _mm512_storeu_pd, _mm512_add_pd, +)
+MATRIXSIMD_DEFINE_BINARY(matrixSimdSubtractAvx512, "avx512f", __m512d, 8, _mm512_loadu_pd,
+                         _mm512_storeu_pd, _mm512_sub_pd, -)
+MATRIXSIMD_DEFINE_BINARY(matrixSimdMultiplyAvx512, "avx512f", __m512d, 8, _mm512_loadu_pd,
+                         _mm512_storeu_pd, _mm512_mul_pd, *)
+MATRIXSIMD_DEFINE_BINARY(matrixSimdDivideAvx512, "avx512f", __m512d, 8, _mm512_loadu_pd,
+                         _mm512_storeu_pd, _mm512_div_pd, /)
+MATRIXSIMD_DEFINE_SCALAR(matrixSimdAddScalarAvx512, "avx512f", __m512d, 8, _mm512_loadu_pd,
+                         _mm512_storeu_pd, _mm512_set1_pd, _mm512_add_pd, +)
+MATRIXSIMD_DEFINE_SCALAR(matrixSimdSubtractScalarAvx512, "avx512f", __m512d, 8, _mm512_loadu_pd,
+                         _mm512_storeu_pd, _mm512_set1_pd, _mm512_sub_pd, -)
+MATRIXSIMD_DEFINE_SCALAR(matrixSimdMultiplyScalarAvx512, "avx512f", __m512d, 8, _mm512_loadu_pd,
+                         _mm512_storeu_pd, _mm512_set1_pd, _mm512_mul_pd, *)
+MATRIXSIMD_DEFINE_SCALAR(matrixSimdDivideScalarAvx512, "avx512f", __m512d, 8, _mm512_loadu_pd,
+                         _mm512_storeu_pd, _mm512_set1_pd, _mm512_div_pd, /)
+
+/**
+ * @brief matrixSimdReduceAvx512 - Horizontal sum of the eight lanes of a register.
+ */
+MATRIXSIMD_TARGET("avx512f")
+static inline double matrixSimdReduceAvx512(__m512d v) {
+  double t[8];
+  _mm512_storeu_pd(t, v);
+  return ((t[0] + t[4]) + (t[1] + t[5])) + ((t[2] + t[6]) + (t[3] + t[7]));
+} // double matrixSimdReduceAvx512(__m512d v) ------------------------------------------------------
+
+MATRIXSIMD_DEFINE_GEMV(matrixSimdGemvAvx512, "avx512f", __m512d, 8, _mm512_loadu_pd,
+                       _mm512_setzero_pd, _mm512_fmadd_pd, matrixSimdReduceAvx512)
+MATRIXSIMD_DEFINE_GEVM(matrixSimdGevmAvx512, "avx512f", __m512d, 8, _mm512_loadu_pd,
+                       _mm512_storeu_pd, _mm512_set1_pd, _mm512_fmadd_pd)
+
+/**
+ * @brief matrixSimdTransposeAvx512 - 8x8 transpose micro kernel. Pairs of rows are interleaved
+ *                                    within the 128-bit lanes, then the lanes are gathered in two
+ *                                    rounds of shuffles. The full-mask forms of the shuffles
+ *                                    are used as the unmasked ones trip -Wuninitialized on GCC.
+ */
+MATRIXSIMD_TARGET("avx512f")
+static void matrixSimdTransposeAvx512(const double * X, unsigned long ldx, double * Z,
+                                      unsigned long ldz) {
+  __m512d r0 = _mm512_loadu_pd(X);
+  __m512d r1 = _mm512_loadu_pd(X + ldx);
+  __m512d r2 = _mm512_loadu_pd(X + 2 * ldx);
+  __m512d r3 = _mm512_loadu_pd(X + 3 * ldx);
+  __m512d r4 = _mm512_loadu_pd(X + 4 * ldx);
+  __m512d r5 = _mm512_loadu_pd(X + 5 * ldx);
+  __m512d r6 = _mm512_loadu_pd(X + 6 * ldx);
+  __m512d r7 = _mm512_loadu_pd(X + 7 * ldx);
+
+  __m512d t0 = _mm512_mask_unpacklo_pd(r0, 0xff, r0, r1);
+  __m512d t1 = _mm512_mask_unpackhi_pd(r0, 0xff, r0, r1);
+  __m512d t2 = _mm512_mask_unpacklo_pd(r2, 0xff, r2, r3);
+  __m512d t3 = _mm512_mask_unpackhi_pd(r2, 0xff, r2, r3);
+  __m512d t4 = _mm512_mask_unpacklo_pd(r4, 0xff, r4, r5);
+  __m512d t5 = _mm512_mask_unpackhi_pd(r4, 0xff, r4, r5);
+  __m512d t6 = _mm512_mask_unpacklo_pd(r6, 0xff, r6, r7);
+  __m512d t7 = _mm512_mask_unpackhi_pd(r6, 0xff, r6, r7);
+
+  __m512d u0 = _mm512_mask_shuffle_f64x2(t0, 0xff, t0, t2, 0x88);
+  __m512d u1 = _mm512_mask_shuffle_f64x2(t1, 0xff, t1, t3, 0x88);
+  __m512d u2 = _mm512_mask_shuffle_f64x2(t0, 0xff, t0, t2, 0xdd);
+  __m512d u3 = _mm512_mask_shuffle_f64x2(t1, 0xff, t1, t3, 0xdd);
+  __m512d u4 = _mm512_mask_shuffle_f64x2(t4, 0xff, t4, t6, 0x88);
+  __m512d u5 = _mm512_mask_shuffle_f64x2(t5, 0xff, t5, t7, 0x88);
+  __m512d u6 = _mm512_mask_shuffle_f64x2(t4, 0xff, t4, t6, 0xdd);
+  __m512d u7 = _mm512_mask_shuffle_f64x2(t5, 0xff, t5, t7, 0xdd);
+
+  _mm512_storeu_pd(Z, _mm512_mask_shuffle_f64x2(u0, 0xff, u0, u4, 0x88));
+  _mm512_storeu_pd(Z + ldz, _mm512_mask_shuffle_f64x2(u1, 0xff, u1, u5, 0x88));
+  _mm512_storeu_pd(Z + 2 * ldz, _mm512_mask_shuffle_f64x2(u2, 0xff, u2, u6, 0x88));
+  _mm512_storeu_pd(Z + 3 * ldz, _mm512_mask_shuffle_f64x2(u3, 0xff, u3, u7, 0x88));
+  _mm512_storeu_pd(Z + 4 * ldz, _mm512_mask_shuffle_f64x2(u0, 0xff, u0, u4, 0xdd));
+  _mm512_storeu_pd(Z + 5 * ldz, _mm512_mask_shuffle_f64x2(u1, 0xff, u1, u5, 0xdd));
+  _mm512_storeu_pd(Z + 6 * ldz, _mm512_mask_shuffle_f64x2(u2, 0xff, u2, u6, 0xdd));
+  _mm512_storeu_pd(Z + 7 * ldz, _mm512_mask_shuffle_f64x2(u3, 0xff, u3, u7, 0xdd));
+} // void matrixSimdTransposeAvx512(const double * X, unsigned long ldx, double * Z, unsigned long ldz)
+
+#define MATRIXSIMD_AVX512_ROW(r)                                                                   \
+  a = _mm512_set1_pd(A[r]);                                                                        \
+  c##r##0 = _mm512_fmadd_pd(a, b0, c##r##0);                                                       \
+  c##r##1 = _mm512_fmadd_pd(a, b1, c##r##1);
+
+#define MATRIXSIMD_AVX512_STORE(v, ptr)                                                            \
+  {                                                                                                \
+    __m512d t = _mm512_mul_pd(v, valpha);                                                          \
+    if (beta != 0.0)                                                                               \
+      t = _mm512_fmadd_pd(vbeta, _mm512_loadu_pd(ptr), t);                                         \
+    _mm512_storeu_pd(ptr, t);                                                                      \
+  }
+
+/**
+ * @brief matrixSimdGemmMicroAvx512 - 8x16 GEMM micro kernel holding the block of C in sixteen
+ *                                    512-bit registers.
+ */
+MATRIXSIMD_TARGET("avx512f")
+static void matrixSimdGemmMicroAvx512(unsigned long kc, double alpha, const double * A,
+                                      const double * B, double beta, double * C,
+                                      unsigned long ldc) {
+  __m512d c00 = _mm512_setzero_pd(), c01 = _mm512_setzero_pd();
+  __m512d c10 = _mm512_setzero_pd(), c11 = _mm512_setzero_pd();
+  __m512d c20 = _mm512_setzero_pd(), c21 = _mm512_setzero_pd();
+  __m512d c30 = _mm512_setzero_pd(), c31 = _mm512_setzero_pd();
+  __m512d c40 = _mm512_setzero_pd(), c41 = _mm512_setzero_pd();
+  __m512d c50 = _mm512_setzero_pd(), c51 = _mm512_setzero_pd();
+  __m512d c60 = _mm512_setzero_pd(), c61 = _mm512_setzero_pd();
+  __m512d c70 = _mm512_setzero_pd(), c71 = _mm512_setzero_pd();
+  __m512d a, b0, b1;
+
+  for (unsigned long p = 0; p < kc; p++) {
+    b0 = _mm512_loadu_pd(B);
+    b1 = _mm512_loadu_pd(B + 8);
+    MATRIXSIMD_AVX512_ROW(0)
+    MATRIXSIMD_AVX512_ROW(1)
+    MATRIXSIMD_AVX512_ROW(2)
+    MATRIXSIMD_AVX512_ROW(3)
+    MATRIXSIMD_AVX512_ROW(4)
+    MATRIXSIMD_AVX512_ROW(5)
+    MATRIXSIMD_AVX512_ROW(6)
+    MATRIXSIMD_AVX512_ROW(7)
+    A += 8;
+    B += 16;
+  }
+
+  __m512d valpha = _mm512_set1_pd(alpha);
+  __m512d vbeta = _mm512_set1_pd(beta);
+  MATRIXSIMD_AVX512_STORE(c00, C)
+  MATRIXSIMD_AVX512_STORE(c01, C + 8)
+  MATRIXSIMD_AVX512_STORE(c10, C + ldc)
+  MATRIXSIMD_AVX512_STORE(c11, C + ldc + 8)
+  MATRIXSIMD_AVX512_STORE(c20, C + 2 * ldc)
+  MATRIXSIMD_AVX512_STORE(c21, C + 2 * ldc + 8)
+  MATRIXSIMD_AVX512_STORE(c30, C + 3 * ldc)
+  MATRIXSIMD_AVX512_STORE(c31, C + 3 * ldc + 8)
+  MATRIXSIMD_AVX512_STORE(c40, C + 4 * ldc)
+  MATRIXSIMD_AVX512_STORE(c41, C + 4 * ldc + 8)
+  MATRIXSIMD_AVX512_STORE(c50, C + 5 * ldc)
+  MATRIXSIMD_AVX512_STORE(c51, C + 5 * ldc + 8)
+  MATRIXSIMD_AVX512_STORE(c60, C + 6 * ldc)
+  MATRIXSIMD_AVX512_STORE(c61, C + 6 * ldc + 8)
+  MATRIXSIMD_AVX512_STORE(c70, C + 7 * ldc)
+  MATRIXSIMD_AVX512_STORE(c71, C + 7 * ldc + 8)
+} // void matrixSimdGemmMicroAvx512(unsigned long kc, double alpha, const double * A, const double * B, double beta, double * C, unsigned long ldc)
+
+#define MATRIXSIMD_AVX512_FLOAT_ROW(r)                                                             \
+  a = _mm512_set1_ps(A[r]);                                                                        \
+  c##r##0 = _mm512_fmadd_ps(a, b0, c##r##0);                                                       \
+  c##r##1 = _mm512_fmadd_ps(a, b1, c##r##1);
+
+#define MATRIXSIMD_AVX512_FLOAT_STORE(v, ptr)                                                      \
+  {                                                                                                \
+    __m512 t = _mm512_mul_ps(v, valpha);                                                           \
+    if (beta != 0.0f)                                                                              \
+      t = _mm512_fmadd_ps(vbeta, _mm512_loadu_ps(ptr), t);                                         \
+    _mm512_storeu_ps(ptr, t);                                                                      \
+  }
+
+/**
+ * @brief matrixSimdGemmMicroFloatAvx512 - 8x32 single precision GEMM micro kernel, with the same
+ *                                         register layout as "matrixSimdGemmMicroAvx512()".
+ */
+MATRIXSIMD_TARGET("avx512f")
+static void matrixSimdGemmMicroFloatAvx512(unsigned long kc, float alpha, const float * A,
+                                           const float * B, float beta, float * C,
+                                           unsigned long ldc) {
+  __m512 c00 = _mm512_setzero_ps(), c01 = _mm512_setzero_ps();
+  __m512 c10 = _mm512_setzero_ps(), c11 = _mm512_setzero_ps();
+  __m512 c20 = _mm512_setzero_ps(), c21 = _mm512_setzero_ps();
+  __m512 c30 = _mm512_setzero_ps(), c31 = _mm512_setzero_ps();
+  __m512 c40 = _mm512_setzero_ps(), c41 = _mm512_setzero_ps();
+  __m512 c50 = _mm512_setzero_ps(), c51 = _mm512_setzero_ps();
+  __m512 c60 = _mm512_setzero_ps(), c61 = _mm512_setzero_ps();
+  __m512 c70 = _mm512_setzero_ps(), c71 = _mm512_setzero_ps();
+  __m512 a, b0, b1;
+
+  for (unsigned long p = 0; p < kc; p++) {
+    b0 = _mm512_loadu_ps(B);
+    b1 = _mm512_loadu_ps(B + 16);
+    MATRIXSIMD_AVX512_FLOAT_ROW(0)
+    MATRIXSIMD_AVX512_FLOAT_ROW(1)
+    MATRIXSIMD_AVX512_FLOAT_ROW(2)
+    MATRIXSIMD_AVX512_FLOAT_ROW(3)
+    MATRIXSIMD_AVX512_FLOAT_ROW(4)
+    MATRIXSIMD_AVX512_FLOAT_ROW(5)
+    MATRIXSIMD_AVX512_FLOAT_ROW(6)
+    MATRIXSIMD_AVX512_FLOAT_ROW(7)
+    A += 8;
+    B += 32;
+  }
+
+  __m512 valpha = _mm512_set1_ps(alpha);
+  __m512 vbeta = _mm512_set1_ps(beta);
+  MATRIXSIMD_AVX512_FLOAT_STORE(c00, C)
+  MATRIXSIMD_AVX512_FLOAT_STORE(c01, C + 16)
+  MATRIXSIMD_AVX512_FLOAT_STORE(c10, C + ldc)
+  MATRIXSIMD_AVX512_FLOAT_STORE(c11, C + ldc + 16)
+  MATRIXSIMD_AVX512_FLOAT_STORE(c20, C + 2 * ldc)
+  MATRIXSIMD_AVX512_FLOAT_STORE(c21, C + 2 * ldc + 16)
+  MATRIXSIMD_AVX512_FLOAT_STORE(c30, C + 3 * ldc)
+  MATRIXSIMD_AVX512_FLOAT_STORE(c31, C + 3 * ldc + 16)
+  MATRIXSIMD_AVX512_FLOAT_STORE(c40, C + 4 * ldc)
+  MATRIXSIMD_AVX512_FLOAT_STORE(c41, C + 4 * ldc + 16)
+  MATRIXSIMD_AVX512_FLOAT_STORE(c50, C + 5 * ldc)
+  MATRIXSIMD_AVX512_FLOAT_STORE(c51, C + 5 * ldc + 16)
+  MATRIXSIMD_AVX512_FLOAT_STORE(c60, C + 6 * ldc)
+  MATRIXSIMD_AVX512_FLOAT_STORE(c61, C + 6 * ldc + 16)
+  MATRIXSIMD_AVX512_FLOAT_STORE(c70, C + 7 * ldc)
+  MATRIXSIMD_AVX512_FLOAT_STORE(c71, C + 7 * ldc + 16)
+} // void matrixSimdGemmMicroFloatAvx512(unsigned long kc, float alpha, const float * A, const float * B, float beta, float * C, unsigned long ldc)
+#endif // MATRIXSIMD_X86
+
+/// ------------------------------------------------------------------------------------------------
+/// Kernel tables and CPU detection
+/// ------------------------------------------------------------------------------------------------
+static const matrixSimdKernels matrixSimdKernelsScalar = {
+  MATRIXSIMD_LEVEL_SCALAR, "scalar",
+  matrixSimdAddGeneric, matrixSimdSubtractGeneric,
+  matrixSimdMultiplyGeneric, matrixSimdDivideGeneric,
+  matrixSimdAddScalarGeneric, matrixSimdSubtractScalarGeneric,
+  matrixSimdMultiplyScalarGeneric, matrixSimdDivideScalarGeneric,
+  4, 8, matrixSimdGemmMicroGeneric,
+  4, 8, matrixSimdGemmMicroFloatGeneric,
+  matrixSimdGemvGeneric, matrixSimdGevmGeneric,
+  4, matrixSimdTransposeGeneric
+};
+
+#if defined(MATRIXSIMD_X86)
+static const matrixSimdKernels matrixSimdKernelsSse2 = {
+  MATRIXSIMD_LEVEL_SSE2, "sse2",
+  matrixSimdAddSse2, matrixSimdSubtractSse2,
+  matrixSimdMultiplySse2, matrixSimdDivideSse2,
+  matrixSimdAddScalarSse2, matrixSimdSubtractScalarSse2,
+  matrixSimdMultiplyScalarSse2, matrixSimdDivideScalarSse2,
+  4, 4, matrixSimdGemmMicroSse2,
+  4, 8, matrixSimdGemmMicroFloatSse2,
+  matrixSimdGemvSse2, matrixSimdGevmSse2,
+  2, matrixSimdTransposeSse2
+};
+
+static const matrixSimdKernels matrixSimdKernelsAvx2 = {
+  MATRIXSIMD_LEVEL_AVX2, "avx2",
+  matrixSimdAddAvx2, matrixSimdSubtractAvx2,
+  matrixSimdMultiplyAvx2, matrixSimdDivideAvx2,
+  matrixSimdAddScalarAvx2, matrixSimdSubtractScalarAvx2,
+  matrixSimdMultiplyScalarAvx2, matrixSimdDivideScalarAvx2,
+  6, 8, matrixSimdGemmMicroAvx2,
+  6, 16, matrixSimdGemmMicroFloatAvx2,
+  matrixSimdGemvAvx2, matrixSimdGevmAvx2,
+  4, matrixSimdTransposeAvx2
+};
+
+static const matrixSimdKernels matrixSimdKernelsAvx512 = {
+  MATRIXSIMD_LEVEL_AVX512, "avx512",
+  matrixSimdAddAvx512, matrixSimdSubtractAvx512,
+  matrixSimdMultiplyAvx512, matrixSimdDivideAvx512,
+  matrixSimdAddScalarAvx512, matrixSimdSubtractScalarAvx512,
+  matrixSimdMultiplyScalarAvx512, matrixSimdDivideScalarAvx512,
+  8, 16, matrixSimdGemmMicroAvx512,
+  8, 32, matrixSimdGemmMicroFloatAvx512,
+  matrixSimdGemvAvx512, matrixSimdGevmAvx512,
+  8, matrixSimdTransposeAvx512
+};
+#endif // MATRIXSIMD_X86
+
+/**
+ * @brief matrixSimdDetect - Queries the CPU, and the operating system support for the extended
+ *                           register state, for the highest usable instruction set level.
+ * @return                 - One of the MATRIXSIMD_LEVEL_* values.
+ */
+static unsigned char matrixSimdDetect(void) {
+#if defined(MATRIXSIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f"))
+    return MATRIXSIMD_LEVEL_AVX512;
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    return MATRIXSIMD_LEVEL_AVX2;
+  if (__builtin_cpu_supports("sse2"))
+    return MATRIXSIMD_LEVEL_SSE2;
+#elif defined(MATRIXSIMD_X86) && defined(_MSC_VER)
+  int info[4];
+  __cpuid(info, 0);
+  int maxLeaf = info[0];
+  __cpuid(info, 1);
+  int sse2 = (info[3] >> 26) & 1;
+  int fma = (info[2] >> 12) & 1;
+  int osxsave = (info[2] >> 27) & 1;
+  int avx2 = 0;
+  int avx512f = 0;
+  if (maxLeaf >= 7) {
+    __cpuidex(info, 7, 0);
+    avx2 = (info[1] >> 5) & 1;
+    avx512f = (info[1] >> 16) & 1;
+  }
+  unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+  if (avx512f && ((xcr0 & 0xe6) == 0xe6))
+    return MATRIXSIMD_LEVEL_AVX512;
+  if (avx2 && fma && ((xcr0 & 0x06) == 0x06))
+    return MATRIXSIMD_LEVEL_AVX2;
+  if (sse2)
+    return MATRIXSIMD_LEVEL_SSE2;
+#endif
+  return MATRIXSIMD_LEVEL_SCALAR;
+} // unsigned char matrixSimdDetect(void) ----------------------------------------------------------
+
+/**
+ * @brief matrixSimdSelect - Returns the kernel table of the given instruction set level.
+ * @param level            - One of the MATRIXSIMD_LEVEL_* values.
+ * @return                 - The kernel table.
+ */
+static const matrixSimdKernels * matrixSimdSelect(unsigned char level) {
+#if defined(MATRIXSIMD_X86)
+  if (level >= MATRIXSIMD_LEVEL_AVX512)
+    return &matrixSimdKernelsAvx512;
+  if (level == MATRIXSIMD_LEVEL_AVX2)
+    return &matrixSimdKernelsAvx2;
+  if (level == MATRIXSIMD_LEVEL_SSE2)
+    return &matrixSimdKernelsSse2;
+#endif
+  (void)level;
+  return &matrixSimdKernelsScalar;
+} // const matrixSimdKernels * matrixSimdSelect(unsigned char level) -------------------------------
+
+/**
+ * @brief matrixSimdActive - Returns the storage of the active kernel table. The detection runs
+ *                           once, the first time this function is called.
+ * @return                 - Reference to the active kernel table pointer.
+ */
+static const matrixSimdKernels *& matrixSimdActive(void) {
+  static const matrixSimdKernels * active = matrixSimdSelect(matrixSimdDetectedLevel());
+  return active;
+} // const matrixSimdKernels *& matrixSimdActive(void) ---------------------------------------------
+
+/// ================================================================================================
+/// EXTERNAL FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief matrixSimd - Returns the kernel table of the active instruction set. The CPU is detected
+ *                     on the first call.
+ * @return           - The active kernel table.
+ */
+const matrixSimdKernels & matrixSimd(void) {
+  return *matrixSimdActive();
+} // const matrixSimdKernels & matrixSimd(void) ----------------------------------------------------
+
+/**
+ * @brief matrixSimdDetectedLevel - Returns the highest instruction set level supported by the CPU
+ *                                  and the operating system.
+ * @return                        - One of the MATRIXSIMD_LEVEL_* values.
+ */
+unsigned char matrixSimdDetectedLevel(void) {
+  static const unsigned char level = matrixSimdDetect();
+  return level;
+} // unsigned char matrixSimdDetectedLevel(void) ---------------------------------------------------
+
+/**
+ * @brief matrixSimdSetLevel - Restricts the active kernels to the given instruction set level.
+ *                             Levels above the detected level are clamped to the detected level.
+ *                             This is meant to be called during start up, before any matrix
+ *                             operation runs on another thread.
+ * @param level              - Requested level, one of the MATRIXSIMD_LEVEL_* values.
+ * @return                   - The level that is now active.
+ */
+unsigned char matrixSimdSetLevel(unsigned char level) {
+  if (level > matrixSimdDetectedLevel())
+    level = matrixSimdDetectedLevel();
+  matrixSimdActive() = matrixSimdSelect(level);
+  return matrixSimdActive()->level;
+} // unsigned char matrixSimdSetLevel(unsigned char level) -----------------------------------------
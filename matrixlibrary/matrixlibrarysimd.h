@@ -0,0 +1,221 @@
+/*
+ * Copyright:   2021 Johnathon Leong
+ *
+ * License:     License under LGPL-3.0-or-later.
+ *              Please refer to https://www.gnu.org/licenses/lgpl-3.0.txt for more information on the
+ *              terms of LGPL-3.0 or relavent website for a later version of the LGPL.
+ *
+ * Disclaimer:  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY
+ *              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ *              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ *              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ *              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *              WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author:      Johnathon Leong
+ *
+ * Note:        Runtime dispatched SIMD kernels used internally by matrixlibrary. The instruction set
+ *              is detected once, the first time the kernels are requested, and the fastest set of
+ *              kernels supported by the CPU is selected. All variants are compiled into the same
+ *              binary so that it runs on both older and newer x86 processors. On other platforms
+ *              the portable scalar kernels are used.
+ *
+ * Version:     1.0.2
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the matrix-vector "gemv" and vector-matrix "gevm" kernels of every kernel
+ *                 set.
+ *              2. Added the transpose micro kernels "transposeMicro" of every kernel set, with
+ *                 their block size "transposeNB".
+ *
+ * Version:     1.0.1
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added the single precision GEMM micro kernels "gemmMicroFloat" of every kernel
+ *                 set, with their register block sizes "gemmMRFloat" and "gemmNRFloat".
+ *                 MATRIXSIMD_GEMM_NR_MAX is raised to 32 for the 8x32 AVX-512 kernel.
+ *
+ * Version:     1.0.0
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Implemented first release version of matrixlibrarysimd.
+ */
+
+#ifndef MATRIXLIBRARYSIMD_H
+#define MATRIXLIBRARYSIMD_H
+
+/**
+ * @brief MATRIXSIMD_LEVEL_SCALAR - Portable scalar kernels.
+ */
+#define MATRIXSIMD_LEVEL_SCALAR 0
+
+/**
+ * @brief MATRIXSIMD_LEVEL_SSE2 - 128-bit SSE2 kernels.
+ */
+#define MATRIXSIMD_LEVEL_SSE2 1
+
+/**
+ * @brief MATRIXSIMD_LEVEL_AVX2 - 256-bit AVX2 and FMA kernels.
+ */
+#define MATRIXSIMD_LEVEL_AVX2 2
+
+/**
+ * @brief MATRIXSIMD_LEVEL_AVX512 - 512-bit AVX-512F kernels.
+ */
+#define MATRIXSIMD_LEVEL_AVX512 3
+
+/**
+ * @brief MATRIXSIMD_GEMM_MR_MAX - Largest micro kernel row size among all the kernel sets.
+ */
+#define MATRIXSIMD_GEMM_MR_MAX 8
+
+/**
+ * @brief MATRIXSIMD_GEMM_NR_MAX - Largest micro kernel column size among all the kernel sets.
+ */
+#define MATRIXSIMD_GEMM_NR_MAX 32
+
+/**
+ * @brief matrixSimdKernels - Function table of one instruction set. The element wise kernels
+ *                            process n consecutive elements and allow the output to alias any of
+ *                            the inputs.
+ */
+struct matrixSimdKernels {
+  /**
+   * @brief level - Instruction set level of the kernels, one of the MATRIXSIMD_LEVEL_* values.
+   */
+  unsigned char level;
+
+  /**
+   * @brief name - Printable name of the instruction set.
+   */
+  const char * name;
+
+  /**
+   * @brief add - Z[i] = X[i] + Y[i].
+   */
+  void (*add)(unsigned long n, const double * X, const double * Y, double * Z);
+
+  /**
+   * @brief subtract - Z[i] = X[i] - Y[i].
+   */
+  void (*subtract)(unsigned long n, const double * X, const double * Y, double * Z);
+
+  /**
+   * @brief multiply - Z[i] = X[i] * Y[i].
+   */
+  void (*multiply)(unsigned long n, const double * X, const double * Y, double * Z);
+
+  /**
+   * @brief divide - Z[i] = X[i] / Y[i].
+   */
+  void (*divide)(unsigned long n, const double * X, const double * Y, double * Z);
+
+  /**
+   * @brief addScalar - Z[i] = X[i] + Y.
+   */
+  void (*addScalar)(unsigned long n, const double * X, double Y, double * Z);
+
+  /**
+   * @brief subtractScalar - Z[i] = X[i] - Y.
+   */
+  void (*subtractScalar)(unsigned long n, const double * X, double Y, double * Z);
+
+  /**
+   * @brief multiplyScalar - Z[i] = X[i] * Y.
+   */
+  void (*multiplyScalar)(unsigned long n, const double * X, double Y, double * Z);
+
+  /**
+   * @brief divideScalar - Z[i] = X[i] / Y.
+   */
+  void (*divideScalar)(unsigned long n, const double * X, double Y, double * Z);
+
+  /**
+   * @brief gemmMR - Row size of the register block of the GEMM micro kernel.
+   */
+  unsigned long gemmMR;
+
+  /**
+   * @brief gemmNR - Column size of the register block of the GEMM micro kernel.
+   */
+  unsigned long gemmNR;
+
+  /**
+   * @brief gemmMicro - GEMM micro kernel. Computes the (gemmMR x gemmNR) product of a packed
+   *                    micro panel of A (stored column by column) and a packed micro panel of B
+   *                    (stored row by row), and stores C = alpha * A * B + beta * C. C is not read
+   *                    when beta is zero.
+   */
+  void (*gemmMicro)(unsigned long kc, double alpha, const double * A, const double * B, double beta,
+                    double * C, unsigned long ldc);
+
+  /**
+   * @brief gemmMRFloat - Row size of the register block of the single precision GEMM micro kernel.
+   */
+  unsigned long gemmMRFloat;
+
+  /**
+   * @brief gemmNRFloat - Column size of the register block of the single precision GEMM micro
+   *                      kernel.
+   */
+  unsigned long gemmNRFloat;
+
+  /**
+   * @brief gemmMicroFloat - Single precision GEMM micro kernel, the same as "gemmMicro" on
+   *                         (gemmMRFloat x gemmNRFloat) blocks.
+   */
+  void (*gemmMicroFloat)(unsigned long kc, float alpha, const float * A, const float * B, float beta,
+                         float * C, unsigned long ldc);
+
+  /**
+   * @brief gemv - Matrix-vector kernel, y = alpha * A * x + beta * y, where A is a row-major
+   *               (m x n) block, x is contiguous and the elements of y are incy apart. y is not
+   *               read when beta is zero.
+   */
+  void (*gemv)(unsigned long m, unsigned long n, double alpha, const double * A, unsigned long lda,
+               const double * x, double beta, double * y, unsigned long incy);
+
+  /**
+   * @brief gevm - Vector-matrix kernel, y += alpha * x * A, where A is a row-major (m x n) block,
+   *               the elements of x are incx apart and y is contiguous.
+   */
+  void (*gevm)(unsigned long m, unsigned long n, double alpha, const double * A, unsigned long lda,
+               const double * x, unsigned long incx, double * y);
+
+  /**
+   * @brief transposeNB - Size of the square block of the transpose micro kernel.
+   */
+  unsigned long transposeNB;
+
+  /**
+   * @brief transposeMicro - Transpose micro kernel, Z = X^T on (transposeNB x transposeNB) blocks,
+   *                         done with register shuffles. The blocks must not overlap.
+   */
+  void (*transposeMicro)(const double * X, unsigned long ldx, double * Z, unsigned long ldz);
+};
+
+/**
+ * @brief matrixSimd - Returns the kernel table of the active instruction set. The CPU is detected
+ *                     on the first call.
+ * @return           - The active kernel table.
+ */
+const matrixSimdKernels & matrixSimd(void);
+
+/**
+ * @brief matrixSimdDetectedLevel - Returns the highest instruction set level supported by the CPU
+ *                                  and the operating system.
+ * @return                        - One of the MATRIXSIMD_LEVEL_* values.
+ */
+unsigned char matrixSimdDetectedLevel(void);
+
+/**
+ * @brief matrixSimdSetLevel - Restricts the active kernels to the given instruction set level.
+ *                             Levels above the detected level are clamped to the detected level.
+ *                             This is meant to be called during start up, before any matrix
+ *                             operation runs on another thread.
+ * @param level              - Requested level, one of the MATRIXSIMD_LEVEL_* values.
+ * @return                   - The level that is now active.
+ */
+unsigned char matrixSimdSetLevel(unsigned char level);
+
+#endif // MATRIXLIBRARYSIMD_H
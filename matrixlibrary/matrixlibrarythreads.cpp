@@ -0,0 +1,466 @@
+/*
+ * Copyright:   2021 Johnathon Leong
+ *
+ * License:     License under LGPL-3.0-or-later.
+ *              Please refer to https://www.gnu.org/licenses/lgpl-3.0.txt for more information on the
+ *              terms of LGPL-3.0 or relavent website for a later version of the LGPL.
+ *
+ * Disclaimer:  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY
+ *              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ *              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ *              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ *              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *              WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author:      Johnathon Leong
+ *
+ * Note:        Thread pool shared by the parallel kernels of matrixlibrary. The worker threads are
+ *              started the first time a parallel loop needs them and are reused by every later
+ *              loop. The iterations of a loop are split into one contiguous range per participating
+ *              thread, and a thread that runs out of work steals iterations from the ranges of the
+ *              others, so that uneven tiles still keep every thread busy. Tasks that depend on
+ *              each other are run as a graph, in which a task becomes ready once all of its
+ *              predecessors are done, and the ready task of the lowest index is run first.
+ *
+ * Version:     1.0.1
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added "matrixThreadsGraph", which runs a graph of dependent tasks on the threads of
+ *                 the pool, each task as soon as its predecessors are done.
+ *
+ * Version:     1.0.0
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Implemented first release version of matrixlibrarythreads.
+ */
+
+
+#include "matrixlibrarythreads.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief matrixThreadsRange - Range of iterations of a participating thread. The range is padded
+ *                             to a cache line so that the threads do not contend on each other.
+ */
+struct alignas(64) matrixThreadsRange {
+  /**
+   * @brief next - Next iteration of the range to be taken, by its owner or by a thief.
+   */
+  std::atomic<unsigned long> next;
+
+  /**
+   * @brief end - One past the last iteration of the range.
+   */
+  unsigned long end;
+};
+
+/**
+ * @brief matrixThreadsPool - State of the thread pool.
+ */
+struct matrixThreadsPool {
+  matrixThreadsPool();
+  ~matrixThreadsPool();
+
+  /**
+   * @brief submit - Held by the thread running a parallel loop on the pool.
+   */
+  std::mutex submit;
+
+  /**
+   * @brief lock - Protects the job and the worker threads.
+   */
+  std::mutex lock;
+
+  /**
+   * @brief wake - Signalled when a job is posted or the workers are stopped.
+   */
+  std::condition_variable wake;
+
+  /**
+   * @brief done - Signalled when the last worker of a job is done.
+   */
+  std::condition_variable done;
+
+  /**
+   * @brief workers - The worker threads, the calling thread of a loop is not one of them.
+   */
+  std::vector<std::thread> workers;
+
+  /**
+   * @brief count - Number of threads, including the calling thread, zero until first used.
+   */
+  unsigned long count;
+
+  /**
+   * @brief generation - Incremented every time a job is posted.
+   */
+  unsigned long generation;
+
+  /**
+   * @brief pending - Number of workers still running the current job.
+   */
+  unsigned long pending;
+
+  /**
+   * @brief participants - Number of threads, including the calling thread, of the current job.
+   */
+  unsigned long participants;
+
+  /**
+   * @brief stop - Set to stop the worker threads.
+   */
+  bool stop;
+
+  /**
+   * @brief task - Task of the current job.
+   */
+  void (*task)(void *, unsigned long);
+
+  /**
+   * @brief context - Context of the current job.
+   */
+  void * context;
+
+  /**
+   * @brief ranges - Ranges of iterations of the participants of the current job.
+   */
+  matrixThreadsRange ranges[MATRIXTHREADS_MAX];
+};
+
+/**
+ * @brief matrixThreadsGraphRun - State of a run of a graph of tasks, shared by its threads.
+ */
+struct matrixThreadsGraphRun {
+  /**
+   * @brief lock - Protects the state of the run.
+   */
+  std::mutex lock;
+
+  /**
+   * @brief ready - Signalled when a task becomes ready or the last task is done.
+   */
+  std::condition_variable ready;
+
+  /**
+   * @brief queue - The ready tasks, the lowest index first.
+   */
+  std::priority_queue<unsigned long, std::vector<unsigned long>, std::greater<unsigned long> > queue;
+
+  /**
+   * @brief predecessors - Number of predecessors of each task that are not done yet.
+   */
+  std::vector<unsigned long> predecessors;
+
+  /**
+   * @brief successors - The tasks that wait for each task.
+   */
+  const std::vector<std::vector<unsigned long> > * successors;
+
+  /**
+   * @brief remaining - Number of tasks that are not done yet.
+   */
+  unsigned long remaining;
+
+  /**
+   * @brief task - The task run for every index.
+   */
+  void (*task)(void *, unsigned long);
+
+  /**
+   * @brief context - Context passed to the task.
+   */
+  void * context;
+};
+
+/**
+ * @brief matrixThreadsInside - Set while the thread runs the iterations of a parallel loop.
+ */
+static thread_local unsigned char matrixThreadsInside = 0;
+
+/// ================================================================================================
+/// STATIC FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief matrixThreadsDefault - Gets the default number of threads.
+ * @return                     - The number of hardware threads, at least one.
+ */
+static unsigned long matrixThreadsDefault(void) {
+  unsigned long count = std::thread::hardware_concurrency();
+  if (count == 0)
+    count = 1;
+  return count < MATRIXTHREADS_MAX ? count : MATRIXTHREADS_MAX;
+} // unsigned long matrixThreadsDefault(void) ------------------------------------------------------
+
+/**
+ * @brief matrixThreadsGraphWorker - Runs the ready tasks of a graph, lowest index first, until
+ *                                   every task of the graph is done. It is the iteration of the
+ *                                   parallel loop behind "matrixThreadsGraph::run()", run once per
+ *                                   thread.
+ * @param context                  - The state of the run.
+ * @param index                    - Unused.
+ */
+static void matrixThreadsGraphWorker(void * context, unsigned long index) {
+  (void)index;
+  matrixThreadsGraphRun & state = * (matrixThreadsGraphRun *)context;
+  std::unique_lock<std::mutex> guard(state.lock);
+  for (;;) {
+    state.ready.wait(guard, [&] { return (state.remaining == 0) || !state.queue.empty(); });
+    if (state.remaining == 0)
+      return;
+    unsigned long t = state.queue.top();
+    state.queue.pop();
+
+    guard.unlock();
+    state.task(state.context, t);
+    guard.lock();
+    const std::vector<unsigned long> & successors = (* state.successors)[t];
+    unsigned long released = 0;
+    for (unsigned long s = 0; s < successors.size(); s++) {
+      if (--state.predecessors[successors[s]] == 0) {
+        state.queue.push(successors[s]);
+        released++;
+      }
+    }
+    if (--state.remaining == 0)
+      state.ready.notify_all();
+    else if (released > 1)
+      state.ready.notify_all();
+    else if (released == 1)
+      state.ready.notify_one();
+  }
+} // void matrixThreadsGraphWorker(void * context, unsigned long index) ----------------------------
+
+/**
+ * @brief matrixThreadsInstance - Gets the thread pool.
+ * @return                      - The thread pool.
+ */
+static matrixThreadsPool & matrixThreadsInstance(void) {
+  static matrixThreadsPool pool;
+  return pool;
+} // matrixThreadsPool & matrixThreadsInstance(void) -----------------------------------------------
+
+/**
+ * @brief matrixThreadsRun - Runs the iterations of the range of a participant, then steals the
+ *                           remaining iterations of the other participants.
+ * @param pool             - The thread pool.
+ * @param index            - Index of the participant.
+ */
+static void matrixThreadsRun(matrixThreadsPool & pool, unsigned long index) {
+  for (unsigned long v = 0; v < pool.participants; v++) {
+    matrixThreadsRange & range = pool.ranges[(index + v) % pool.participants];
+    for (;;) {
+      unsigned long i = range.next.fetch_add(1, std::memory_order_relaxed);
+      if (i >= range.end)
+        break;
+      pool.task(pool.context, i);
+    }
+  }
+} // void matrixThreadsRun(matrixThreadsPool & pool, unsigned long index) --------------------------
+
+/**
+ * @brief matrixThreadsStop - Stops and joins the worker threads. The caller must hold the submit
+ *                            lock of the pool.
+ * @param pool              - The thread pool.
+ */
+static void matrixThreadsStop(matrixThreadsPool & pool) {
+  {
+    std::lock_guard<std::mutex> guard(pool.lock);
+    pool.stop = true;
+  }
+  pool.wake.notify_all();
+  for (unsigned long i = 0; i < pool.workers.size(); i++)
+    pool.workers[i].join();
+  pool.workers.clear();
+  pool.stop = false;
+} // void matrixThreadsStop(matrixThreadsPool & pool) ----------------------------------------------
+
+/**
+ * @brief matrixThreadsWorker - Main loop of a worker thread, which waits for the jobs of the pool
+ *                              until it is stopped.
+ * @param pool                - The thread pool.
+ * @param index               - Index of the worker, starting from 1 as 0 is the calling thread.
+ * @param seen                - Generation of the pool when the worker was started.
+ */
+static void matrixThreadsWorker(matrixThreadsPool * pool, unsigned long index, unsigned long seen) {
+  matrixThreadsInside = 1;
+  std::unique_lock<std::mutex> guard(pool->lock);
+  for (;;) {
+    pool->wake.wait(guard, [&] { return pool->stop || (pool->generation != seen); });
+    if (pool->stop)
+      return;
+    seen = pool->generation;
+    if (index >= pool->participants)
+      continue;
+
+    guard.unlock();
+    matrixThreadsRun(*pool, index);
+    guard.lock();
+    if (--pool->pending == 0)
+      pool->done.notify_one();
+  }
+} // void matrixThreadsWorker(matrixThreadsPool * pool, unsigned long index, unsigned long seen) ---
+
+/// ================================================================================================
+/// PUBLIC FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief matrixThreadsGraph - Constructor of a graph of tasks without any dependency.
+ * @param count              - Number of tasks. The index of a task is also its priority, the lower
+ *                             index being run first among the ready tasks.
+ */
+matrixThreadsGraph::matrixThreadsGraph(unsigned long count) :
+  mPredecessors(count, 0), mSuccessors(count) {
+} // matrixThreadsGraph::matrixThreadsGraph(unsigned long count) -----------------------------------
+
+/**
+ * @brief addDependency - Makes a task wait for another one to be done.
+ * @param before        - Index of the task to be done first.
+ * @param after         - Index of the task that waits for it, higher than before.
+ */
+void matrixThreadsGraph::addDependency(unsigned long before, unsigned long after) {
+  mSuccessors[before].push_back(after);
+  mPredecessors[after]++;
+} // void matrixThreadsGraph::addDependency(unsigned long before, unsigned long after) -------------
+
+/**
+ * @brief run     - Runs task(context, i) for every task i of the graph on the threads of the pool,
+ *                  the calling thread included, and returns once every task is done. Every thread
+ *                  takes the ready task of the lowest index, and a task that completes releases
+ *                  its successors. Since a task only waits for lower indices, a single thread
+ *                  running the tasks in order never waits, which keeps the serial fallback of
+ *                  "matrixThreadsParallelFor()" correct.
+ * @param task    - The task run for every index.
+ * @param context - Context passed to the task.
+ */
+void matrixThreadsGraph::run(void (*task)(void *, unsigned long), void * context) const {
+  matrixThreadsGraphRun state;
+  state.predecessors = mPredecessors;
+  state.successors = &mSuccessors;
+  state.remaining = mPredecessors.size();
+  state.task = task;
+  state.context = context;
+  for (unsigned long t = 0; t < mPredecessors.size(); t++) {
+    if (mPredecessors[t] == 0)
+      state.queue.push(t);
+  }
+  if (state.remaining == 0)
+    return;
+
+  matrixThreadsParallelFor(matrixThreadsGetCount(), matrixThreadsGraphWorker, &state);
+} // void matrixThreadsGraph::run(void (*task)(void *, unsigned long), void * context) const -------
+
+/**
+ * @brief matrixThreadsPool - Constructor. No thread is started until the first parallel loop.
+ */
+matrixThreadsPool::matrixThreadsPool() :
+  count(0), generation(0), pending(0), participants(0), stop(false), task(NULL), context(NULL) {
+} // matrixThreadsPool::matrixThreadsPool() --------------------------------------------------------
+
+/**
+ * @brief ~matrixThreadsPool - Destructor. Stops the worker threads.
+ */
+matrixThreadsPool::~matrixThreadsPool() {
+  std::lock_guard<std::mutex> guard(submit);
+  matrixThreadsStop(*this);
+} // matrixThreadsPool::~matrixThreadsPool() -------------------------------------------------------
+
+/// ================================================================================================
+/// EXTERNAL FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief matrixThreadsGetCount - Gets the number of threads, including the calling thread, used by
+ *                                the parallel loops.
+ * @return                      - The number of threads.
+ */
+unsigned long matrixThreadsGetCount(void) {
+  matrixThreadsPool & pool = matrixThreadsInstance();
+  std::lock_guard<std::mutex> guard(pool.lock);
+  if (pool.count == 0)
+    pool.count = matrixThreadsDefault();
+  return pool.count;
+} // unsigned long matrixThreadsGetCount(void) -----------------------------------------------------
+
+/**
+ * @brief matrixThreadsParallelFor - Runs task(context, i) for every i in [0, count) on the threads
+ *                                   of the pool, the calling thread included, and returns once
+ *                                   every iteration is done. The iterations must be independent.
+ *                                   The loop runs serially on the calling thread when the pool has
+ *                                   a single thread, when it is called from inside a parallel loop
+ *                                   or when the pool is busy with a loop of another thread.
+ * @param count                    - Number of iterations.
+ * @param task                     - The task run for every iteration.
+ * @param context                  - Context passed to the task.
+ */
+void matrixThreadsParallelFor(unsigned long count, void (*task)(void *, unsigned long),
+                              void * context) {
+  unsigned long participants = matrixThreadsInside ? 1 : matrixThreadsGetCount();
+  if (participants > count)
+    participants = count;
+
+  matrixThreadsPool & pool = matrixThreadsInstance();
+  std::unique_lock<std::mutex> submit(pool.submit, std::defer_lock);
+  if ((participants > 1) && !submit.try_lock())
+    participants = 1;
+
+  if (participants <= 1) {
+    for (unsigned long i = 0; i < count; i++)
+      task(context, i);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(pool.lock);
+    // the workers are started lazily and kept alive for the next loops
+    while (pool.workers.size() + 1 < pool.count)
+      pool.workers.push_back(std::thread(matrixThreadsWorker, &pool, pool.workers.size() + 1,
+                                         pool.generation));
+    if (participants > pool.workers.size() + 1)
+      participants = pool.workers.size() + 1;
+
+    for (unsigned long w = 0; w < participants; w++) {
+      pool.ranges[w].next.store(count * w / participants, std::memory_order_relaxed);
+      pool.ranges[w].end = count * (w + 1) / participants;
+    }
+    pool.task = task;
+    pool.context = context;
+    pool.participants = participants;
+    pool.pending = participants - 1;
+    pool.generation++;
+  }
+  pool.wake.notify_all();
+
+  matrixThreadsInside = 1;
+  matrixThreadsRun(pool, 0);
+  matrixThreadsInside = 0;
+
+  std::unique_lock<std::mutex> guard(pool.lock);
+  pool.done.wait(guard, [&] { return pool.pending == 0; });
+} // void matrixThreadsParallelFor(unsigned long count, void (*task)(void *, unsigned long), void * context)
+
+/**
+ * @brief matrixThreadsSetCount - Sets the number of threads, including the calling thread, used by
+ *                                the parallel loops. The worker threads already running are
+ *                                stopped, and the new ones are started by the next parallel loop.
+ *                                It must not be called from inside a parallel loop.
+ * @param count                 - The number of threads, clamped to MATRIXTHREADS_MAX. Zero selects
+ *                                the number of hardware threads, which is also the default.
+ */
+void matrixThreadsSetCount(unsigned long count) {
+  if (count == 0)
+    count = matrixThreadsDefault();
+  else if (count > MATRIXTHREADS_MAX)
+    count = MATRIXTHREADS_MAX;
+
+  matrixThreadsPool & pool = matrixThreadsInstance();
+  std::lock_guard<std::mutex> guard(pool.submit);
+  matrixThreadsStop(pool);
+  std::lock_guard<std::mutex> state(pool.lock);
+  pool.count = count;
+} // void matrixThreadsSetCount(unsigned long count) -----------------------------------------------
@@ -0,0 +1,119 @@
+/*
+ * Copyright:   2021 Johnathon Leong
+ *
+ * License:     License under LGPL-3.0-or-later.
+ *              Please refer to https://www.gnu.org/licenses/lgpl-3.0.txt for more information on the
+ *              terms of LGPL-3.0 or relavent website for a later version of the LGPL.
+ *
+ * Disclaimer:  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY
+ *              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ *              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ *              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ *              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *              WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author:      Johnathon Leong
+ *
+ * Note:        Thread pool shared by the parallel kernels of matrixlibrary. The worker threads are
+ *              started the first time a parallel loop needs them and are reused by every later
+ *              loop. The iterations of a loop are split into one contiguous range per participating
+ *              thread, and a thread that runs out of work steals iterations from the ranges of the
+ *              others, so that uneven tiles still keep every thread busy. Tasks that depend on
+ *              each other are run as a graph, in which a task becomes ready once all of its
+ *              predecessors are done, and the ready task of the lowest index is run first.
+ *
+ * Version:     1.0.1
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Added "matrixThreadsGraph", which runs a graph of dependent tasks on the threads of
+ *                 the pool, each task as soon as its predecessors are done.
+ *
+ * Version:     1.0.0
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Implemented first release version of matrixlibrarythreads.
+ */
+
+#ifndef MATRIXLIBRARYTHREADS_H
+#define MATRIXLIBRARYTHREADS_H
+
+/**
+ * @brief MATRIXTHREADS_MAX - Maximum number of threads, including the calling thread, of the pool.
+ */
+#define MATRIXTHREADS_MAX 256
+
+#include <vector>
+
+class matrixThreadsGraph
+{
+public:
+  /**
+   * @brief matrixThreadsGraph - Constructor of a graph of tasks without any dependency.
+   * @param count              - Number of tasks. The index of a task is also its priority, the
+   *                             lower index being run first among the ready tasks.
+   */
+  explicit matrixThreadsGraph(unsigned long count);
+
+  /**
+   * @brief addDependency - Makes a task wait for another one to be done.
+   * @param before        - Index of the task to be done first.
+   * @param after         - Index of the task that waits for it, higher than before.
+   */
+  void addDependency(unsigned long before, unsigned long after);
+
+  /**
+   * @brief run     - Runs task(context, i) for every task i of the graph on the threads of the
+   *                  pool, the calling thread included, and returns once every task is done. The
+   *                  tasks run serially in the order of their index under the same conditions as
+   *                  "matrixThreadsParallelFor()", and the parallel loops called by a task run
+   *                  serially on its thread. The graph can be run more than once.
+   * @param task    - The task run for every index.
+   * @param context - Context passed to the task.
+   */
+  void run(void (*task)(void *, unsigned long), void * context) const;
+
+private:
+  /**
+   * @brief mPredecessors - To store the number of predecessors of each task.
+   */
+  std::vector<unsigned long> mPredecessors;
+
+  /**
+   * @brief mSuccessors - To store the tasks that wait for each task.
+   */
+  std::vector<std::vector<unsigned long> > mSuccessors;
+};
+
+/**
+ * @brief matrixThreadsGetCount - Gets the number of threads, including the calling thread, used by
+ *                                the parallel loops.
+ * @return                      - The number of threads.
+ */
+unsigned long matrixThreadsGetCount(void);
+
+/**
+ * @brief matrixThreadsParallelFor - Runs task(context, i) for every i in [0, count) on the threads
+ *                                   of the pool, the calling thread included, and returns once
+ *                                   every iteration is done. The iterations must be independent.
+ *                                   The loop runs serially on the calling thread when the pool has
+ *                                   a single thread, when it is called from inside a parallel loop
+ *                                   or when the pool is busy with a loop of another thread.
+ * @param count                    - Number of iterations.
+ * @param task                     - The task run for every iteration.
+ * @param context                  - Context passed to the task.
+ */
+void matrixThreadsParallelFor(unsigned long count, void (*task)(void *, unsigned long),
+                              void * context);
+
+/**
+ * @brief matrixThreadsSetCount - Sets the number of threads, including the calling thread, used by
+ *                                the parallel loops. The worker threads already running are
+ *                                stopped, and the new ones are started by the next parallel loop.
+ *                                It must not be called from inside a parallel loop.
+ * @param count                 - The number of threads, clamped to MATRIXTHREADS_MAX. Zero selects
+ *                                the number of hardware threads, which is also the default.
+ */
+void matrixThreadsSetCount(unsigned long count);
+
+#endif // MATRIXLIBRARYTHREADS_H
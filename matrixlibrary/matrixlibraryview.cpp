@@ -0,0 +1,269 @@
+/*
+ * Copyright:   2021 Johnathon Leong
+ *
+ * License:     License under LGPL-3.0-or-later.
+ *              Please refer to https://www.gnu.org/licenses/lgpl-3.0.txt for more information on the
+ *              terms of LGPL-3.0 or relavent website for a later version of the LGPL.
+ *
+ * Disclaimer:  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY
+ *              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ *              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ *              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ *              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *              WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author:      Johnathon Leong
+ *
+ * Note:        Non-owning views of matrixlibrary. A view refers to a rectangular block of the
+ *              elements of a matrix, by a pointer to its first element, its row and column size, and
+ *              the leading dimension (row stride) of the matrix. Creating a view does not allocate
+ *              or copy any element, and writing through a view changes the viewed matrix. A view
+ *              must not outlive the matrix it refers to, nor be used after that matrix is resized.
+ *              To be used together with matrixlibrary and matrixlibraryexpression.
+ *
+ * Version:     1.0.3
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. "matrixTranspose()" now transposes tile by tile through
+ *                 "matrixKernelsTranspose()".
+ *
+ * Version:     1.0.2
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The result matrix of the multiplication and of the transpose is allocated
+ *                 uninitialized.
+ *
+ * Version:     1.0.1
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The view of a matrix now takes the leading dimension of the matrix, and the
+ *                 results of the view operations are written using their leading dimension.
+ *
+ * Version:     1.0.0
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Implemented first release version of matrixlibraryview.
+ */
+
+#include "matrixlibraryview.h"
+#include "matrixlibrarykernels.h"
+#include <string.h>
+
+/// ================================================================================================
+/// STATIC FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief matrixViewApply - Applies an element wise operation with a value to every element of the
+ *                          view, X = O(X, Y).
+ * @param X               - The view to be operated on.
+ * @param Y               - The value of the operation.
+ */
+template <typename O>
+static void matrixViewApply(const matrixView & X, double Y) {
+  for (unsigned long i = 0; i < X.getRowSize(); i++) {
+    double * z = &X.mMat[i * X.getLd()];
+    for (unsigned long j = 0; j < X.getColSize(); j++)
+      z[j] = O::apply(z[j], Y);
+  }
+} // matrixViewApply(const matrixView & X, double Y) -----------------------------------------------
+
+/// ================================================================================================
+/// PUBLIC FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief matrixView - Overloaded constructor to view a row-major buffer.
+ * @param mat        - Pointer to the first element of the view.
+ * @param row        - Row size of the view.
+ * @param col        - Column size of the view.
+ * @param ld         - Leading dimension (row stride) of the buffer.
+ */
+matrixView::matrixView(double * mat, unsigned long row, unsigned long col, unsigned long ld)
+  : mRow(row), mCol(col), mLd(ld) {
+  mMat = mat;
+} // matrixView::matrixView(double * mat, unsigned long row, unsigned long col, unsigned long ld) --
+
+/**
+ * @brief matrixView - Overloaded constructor to view the whole of a matrix.
+ * @param X          - Matrix to be viewed.
+ */
+matrixView::matrixView(const matrix & X) : mRow(X.getRowSize()), mCol(X.getColSize()), mLd(X.getLd()) {
+  mMat = X.mMat;
+} // matrixView::matrixView(const matrix & X) ------------------------------------------------------
+
+/**
+ * @brief matrixView - Overloaded copy constructor. The new view refers to the same elements.
+ * @param X          - View to be copied.
+ */
+matrixView::matrixView(const matrixView & X) : mRow(X.mRow), mCol(X.mCol), mLd(X.mLd) {
+  mMat = X.mMat;
+} // matrixView::matrixView(const matrixView & X) --------------------------------------------------
+
+/**
+ * @brief operator = - Fills every element of the view with the input value.
+ * @param X          - The value to be stored.
+ * @return           - Returns the view reference of itself.
+ */
+const matrixView& matrixView::operator=(double X) const {
+  matrixViewApply<matrixExpressionAssign>(* this, X);
+  return * this;
+} // matrixView::operator=(double X) const ---------------------------------------------------------
+
+/**
+ * @brief operator = - Copies the elements of the input view into the elements of the view. The
+ *                     views may overlap.
+ * @param X          - The view to copy from.
+ * @return           - Returns the view reference of itself.
+ */
+const matrixView& matrixView::operator=(const matrixView & X) const {
+  if ((mRow != X.mRow) || (mCol != X.mCol))
+    matrixExit("Matrices size mismatch.");
+  if ((mMat == X.mMat) && (mLd == X.mLd))
+    return * this;
+
+  // rows are copied from the top when the source lies after the destination and from the bottom
+  // otherwise, so that every source row is read before it is overwritten.
+  if (X.mMat > mMat) {
+    for (unsigned long i = 0; i < mRow; i++)
+      memmove(&mMat[i * mLd], &X.mMat[i * X.mLd], sizeof(double) * mCol);
+  }
+  else {
+    for (unsigned long i = mRow; i > 0; i--)
+      memmove(&mMat[(i - 1) * mLd], &X.mMat[(i - 1) * X.mLd], sizeof(double) * mCol);
+  }
+  return * this;
+} // matrixView::operator=(const matrixView & X) const ---------------------------------------------
+
+/**
+ * @brief getColSize - Returns the column size of the view.
+ * @return           - Column size of the view.
+ */
+unsigned long matrixView::getColSize(void) const {
+  return mCol;
+} // matrixView::getColSize(void) const ------------------------------------------------------------
+
+/**
+ * @brief getLd - Returns the leading dimension (row stride) of the view.
+ * @return      - Leading dimension of the view.
+ */
+unsigned long matrixView::getLd(void) const {
+  return mLd;
+} // matrixView::getLd(void) const -----------------------------------------------------------------
+
+/**
+ * @brief getRowSize - Returns the row size of the view.
+ * @return           - Row size of the view.
+ */
+unsigned long matrixView::getRowSize(void) const {
+  return mRow;
+} // matrixView::getRowSize(void) const ------------------------------------------------------------
+
+/**
+ * @brief getSize - Returns the total number of elements in the view.
+ * @return        - Size of the view.
+ */
+unsigned long matrixView::getSize(void) const {
+  return mRow * mCol;
+} // matrixView::getSize(void) const ---------------------------------------------------------------
+
+/**
+ * @brief view     - Returns a view of a block of the view, defined by the input arguments.
+ * @param startRow - Start row index of the block.
+ * @param endRow   - End row index of the block.
+ * @param startCol - Start column index of the block.
+ * @param endCol   - End column index of the block.
+ * @return         - Returns the view of the block.
+ */
+matrixView matrixView::view(unsigned long startRow, unsigned long endRow, unsigned long startCol, unsigned long endCol) const {
+  if (startRow == 0)
+    matrixExit("Matrix start row index should be greater than 0.");
+  if (endRow == 0)
+    matrixExit("Matrix end row index should be greater than 0.");
+  if (startRow > mRow)
+    matrixExit("Matrix start row index exceeds matrix row size.");
+  if (endRow > mRow)
+    matrixExit("Matrix end row index exceeds matrix row size.");
+  if (startRow > endRow)
+    matrixExit("Matrix start row index exceeds matrix end row index.");
+  if (startCol == 0)
+    matrixExit("Matrix start column index should be greater than 0.");
+  if (startCol > mCol)
+    matrixExit("Matrix start column index exceeds matrix column size.");
+  if (endCol > mCol)
+    matrixExit("Matrix end column index exceeds matrix column size.");
+  if (startCol > endCol)
+    matrixExit("Matrix start column index exceeds matrix end column index.");
+
+  return matrixView(&mMat[(startRow - 1) * mLd + startCol - 1], endRow - startRow + 1,
+                    endCol - startCol + 1, mLd);
+} // matrixView::view(unsigned long startRow, unsigned long endRow, unsigned long startCol, unsigned long endCol) const
+
+/// ================================================================================================
+/// EXTERNAL FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief operator * - Overloading of the multiplication operatior between two views.
+ * @param X          - Main view for multiplication.
+ * @param Y          - Multiplication view.
+ * @return           - The resultant matrix.
+ */
+matrix operator*(const matrixView & X, const matrixView & Y) {
+  if (X.getColSize() != Y.getRowSize())
+    matrixExit("Matrices inner size mismatch.");
+
+  matrix Z(X.getRowSize(), Y.getColSize(), matrixUninitialized);
+  matrixKernelsGemm(X.getRowSize(), Y.getColSize(), X.getColSize(), 1.0,
+                    X.mMat, X.getLd(), 1,
+                    Y.mMat, Y.getLd(), 1,
+                    0.0, Z.mMat, Z.getLd());
+  return Z;
+} // operator*(const matrixView & X, const matrixView & Y) -----------------------------------------
+
+/**
+ * @brief operator += - Overloading of the addition equal operatior between a view and a double type
+ *                      value.
+ * @param X           - Main view for addition.
+ * @param Y           - Addition value.
+ */
+void operator+=(const matrixView & X, const double & Y) {
+  matrixViewApply<matrixExpressionAdd>(X, Y);
+} // operator+=(const matrixView & X, const double & Y) --------------------------------------------
+
+/**
+ * @brief operator -= - Overloading of the subtraction equal operatior between a view and a double
+ *                      type value.
+ * @param X           - Main view for subtraction.
+ * @param Y           - Subtraction value.
+ */
+void operator-=(const matrixView & X, const double & Y) {
+  matrixViewApply<matrixExpressionSubtract>(X, Y);
+} // operator-=(const matrixView & X, const double & Y) --------------------------------------------
+
+/**
+ * @brief operator *= - Overloading of the multiplication operatior between a view and a double type
+ *                      value.
+ * @param X           - Main view for multiplication.
+ * @param Y           - Multiplication value.
+ */
+void operator*=(const matrixView & X, const double & Y) {
+  matrixViewApply<matrixExpressionMultiply>(X, Y);
+} // operator*=(const matrixView & X, const double & Y) --------------------------------------------
+
+/**
+ * @brief operator /= - Overloading of the division operatior between a view and a double type
+ *                      value.
+ * @param X           - Main view for division.
+ * @param Y           - Division value.
+ */
+void operator/=(const matrixView & X, const double & Y) {
+  matrixViewApply<matrixExpressionDivide>(X, Y);
+} // operator/=(const matrixView & X, const double & Y) --------------------------------------------
+
+/**
+ * @brief matrixTranspose - Create a transpose copy of the input view.
+ * @param X               - The view to be transposed.
+ * @return                - The transposed matrix.
+ */
+matrix matrixTranspose(const matrixView & X) {
+  matrix Z(X.getColSize(), X.getRowSize(), matrixUninitialized);
+  matrixKernelsTranspose(X.getRowSize(), X.getColSize(), X.mMat, X.getLd(), Z.mMat, Z.getLd());
+  return Z;
+} // matrix matrixTranspose(const matrixView & X) --------------------------------------------------
@@ -0,0 +1,284 @@
+/*
+ * Copyright:   2021 Johnathon Leong
+ *
+ * License:     License under LGPL-3.0-or-later.
+ *              Please refer to https://www.gnu.org/licenses/lgpl-3.0.txt for more information on the
+ *              terms of LGPL-3.0 or relavent website for a later version of the LGPL.
+ *
+ * Disclaimer:  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY
+ *              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ *              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ *              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ *              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *              WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author:      Johnathon Leong
+ *
+ * Note:        Non-owning views of matrixlibrary. A view refers to a rectangular block of the
+ *              elements of a matrix, by a pointer to its first element, its row and column size, and
+ *              the leading dimension (row stride) of the matrix. Creating a view does not allocate
+ *              or copy any element, and writing through a view changes the viewed matrix. A view
+ *              must not outlive the matrix it refers to, nor be used after that matrix is resized.
+ *              To be used together with matrixlibrary and matrixlibraryexpression.
+ *
+ * Version:     1.0.3
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. "matrixTranspose()" now transposes tile by tile through
+ *                 "matrixKernelsTranspose()".
+ *
+ * Version:     1.0.2
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The result matrix of the multiplication and of the transpose is allocated
+ *                 uninitialized.
+ *
+ * Version:     1.0.1
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. The view of a matrix now takes the leading dimension of the matrix, and the
+ *                 results of the view operations are written using their leading dimension.
+ *
+ * Version:     1.0.0
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Implemented first release version of matrixlibraryview.
+ */
+
+#ifndef MATRIXLIBRARYVIEW_H
+#define MATRIXLIBRARYVIEW_H
+
+#include "matrixlibrary.h"
+
+class matrixView : public matrixExpression<matrixView>
+{
+public:
+  /**
+   * @brief matrixView - Overloaded constructor to view a row-major buffer.
+   * @param mat        - Pointer to the first element of the view.
+   * @param row        - Row size of the view.
+   * @param col        - Column size of the view.
+   * @param ld         - Leading dimension (row stride) of the buffer.
+   */
+  explicit matrixView(double * mat, unsigned long row, unsigned long col, unsigned long ld);
+
+  /**
+   * @brief matrixView - Overloaded constructor to view the whole of a matrix.
+   * @param X          - Matrix to be viewed.
+   */
+  matrixView(const matrix & X);
+
+  /**
+   * @brief matrixView - Overloaded copy constructor. The new view refers to the same elements.
+   * @param X          - View to be copied.
+   */
+  matrixView(const matrixView & X);
+
+  /**
+   * @brief operator = - Fills every element of the view with the input value.
+   * @param X          - The value to be stored.
+   * @return           - Returns the view reference of itself.
+   */
+  const matrixView& operator=(double X) const;
+
+  /**
+   * @brief operator = - Copies the elements of the input view into the elements of the view. The
+   *                     views may overlap.
+   * @param X          - The view to copy from.
+   * @return           - Returns the view reference of itself.
+   */
+  const matrixView& operator=(const matrixView & X) const;
+
+  /**
+   * @brief operator = - Evaluates a matrix expression into the elements of the view.
+   * @param X          - Matrix expression to be evaluated.
+   * @return           - Returns the view reference of itself.
+   */
+  template <typename E>
+  const matrixView& operator=(const matrixExpression<E> & X) const;
+
+  /**
+   * @brief operator() - Return the value stored in the element defined by the input arguments.
+   * @param rowIndex   - Row index of the element.
+   * @param colIndex   - Column index of the element.
+   * @return           - Returns the stored value.
+   */
+  double& operator()(unsigned long rowIndex, unsigned long colIndex) const;
+
+  /**
+   * @brief evaluate - Returns the value of an element as a matrix expression.
+   * @param row      - Zero based row index.
+   * @param col      - Zero based column index.
+   * @return         - Value of the element.
+   */
+  double evaluate(unsigned long row, unsigned long col) const { return mMat[row * mLd + col]; }
+
+  /**
+   * @brief getColSize - Returns the column size of the view.
+   * @return           - Column size of the view.
+   */
+  unsigned long getColSize(void) const;
+
+  /**
+   * @brief getLd - Returns the leading dimension (row stride) of the view.
+   * @return      - Leading dimension of the view.
+   */
+  unsigned long getLd(void) const;
+
+  /**
+   * @brief getRowSize - Returns the row size of the view.
+   * @return           - Row size of the view.
+   */
+  unsigned long getRowSize(void) const;
+
+  /**
+   * @brief getSize - Returns the total number of elements in the view.
+   * @return        - Size of the view.
+   */
+  unsigned long getSize(void) const;
+
+  /**
+   * @brief view     - Returns a view of a block of the view, defined by the input arguments.
+   * @param startRow - Start row index of the block.
+   * @param endRow   - End row index of the block.
+   * @param startCol - Start column index of the block.
+   * @param endCol   - End column index of the block.
+   * @return         - Returns the view of the block.
+   */
+  matrixView view(unsigned long startRow, unsigned long endRow, unsigned long startCol, unsigned long endCol) const;
+
+  /**
+   * @brief mMat - "double" type pointer to the first element of the view.
+   *               IMPORTANT NOTE: THIS ATTRIBUTE IS NOT "PRIVATE" FOR EFFICIENCY. DO NOT CHANGE THE
+   *                               POINTER.
+   */
+  double * mMat;
+
+private:
+  /**
+   * @brief mRow - To store the row size of the view.
+   */
+  unsigned long mRow;
+
+  /**
+   * @brief mCol - To store the column size of the view.
+   */
+  unsigned long mCol;
+
+  /**
+   * @brief mLd - To store the leading dimension (row stride) of the view.
+   */
+  unsigned long mLd;
+};
+
+/**
+ * @brief operator * - Overloading of the multiplication operatior between two views.
+ * @param X          - Main view for multiplication.
+ * @param Y          - Multiplication view.
+ * @return           - The resultant matrix.
+ */
+matrix operator*(const matrixView & X, const matrixView & Y);
+
+/**
+ * @brief operator += - Overloading of the addition equal operatior between a view and a double type
+ *                      value.
+ * @param X           - Main view for addition.
+ * @param Y           - Addition value.
+ */
+void operator+=(const matrixView & X, const double & Y);
+
+/**
+ * @brief operator -= - Overloading of the subtraction equal operatior between a view and a double
+ *                      type value.
+ * @param X           - Main view for subtraction.
+ * @param Y           - Subtraction value.
+ */
+void operator-=(const matrixView & X, const double & Y);
+
+/**
+ * @brief operator *= - Overloading of the multiplication operatior between a view and a double type
+ *                      value.
+ * @param X           - Main view for multiplication.
+ * @param Y           - Multiplication value.
+ */
+void operator*=(const matrixView & X, const double & Y);
+
+/**
+ * @brief operator /= - Overloading of the division operatior between a view and a double type
+ *                      value.
+ * @param X           - Main view for division.
+ * @param Y           - Division value.
+ */
+void operator/=(const matrixView & X, const double & Y);
+
+/**
+ * @brief operator += - Overloading of the addition equal operatior between a view and a matrix
+ *                      expression. The expression is evaluated directly into the view.
+ * @param X           - Main view for addition.
+ * @param Y           - Addition expression.
+ */
+template <typename E>
+void operator+=(const matrixView & X, const matrixExpression<E> & Y);
+
+/**
+ * @brief operator -= - Overloading of the subtraction equal operatior between a view and a matrix
+ *                      expression. The expression is evaluated directly into the view.
+ * @param X           - Main view for subtraction.
+ * @param Y           - Subtraction expression.
+ */
+template <typename E>
+void operator-=(const matrixView & X, const matrixExpression<E> & Y);
+
+/**
+ * @brief matrixTranspose - Create a transpose copy of the input view.
+ * @param X               - The view to be transposed.
+ * @return                - The transposed matrix.
+ */
+matrix matrixTranspose(const matrixView & X);
+
+/// ================================================================================================
+/// TEMPLATE FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief operator() - Return the value stored in the element defined by the input arguments.
+ * @param rowIndex   - Row index of the element.
+ * @param colIndex   - Column index of the element.
+ * @return           - Returns the stored value.
+ */
+inline double& matrixView::operator()(unsigned long rowIndex, unsigned long colIndex) const {
+  return mMat[--rowIndex * mLd + --colIndex];
+} // matrixView::operator()(unsigned long rowIndex, unsigned long colIndex) const ------------------
+
+/**
+ * @brief operator = - Evaluates a matrix expression into the elements of the view.
+ * @param X          - Matrix expression to be evaluated.
+ * @return           - Returns the view reference of itself.
+ */
+template <typename E>
+const matrixView& matrixView::operator=(const matrixExpression<E> & X) const {
+  matrixExpressionEvaluate<matrixExpressionAssign>(mMat, mRow, mCol, mLd, X);
+  return * this;
+} // matrixView::operator=(const matrixExpression<E> & X) const ------------------------------------
+
+/**
+ * @brief operator += - Overloading of the addition equal operatior between a view and a matrix
+ *                      expression. The expression is evaluated directly into the view.
+ * @param X           - Main view for addition.
+ * @param Y           - Addition expression.
+ */
+template <typename E>
+void operator+=(const matrixView & X, const matrixExpression<E> & Y) {
+  matrixExpressionEvaluate<matrixExpressionAdd>(X.mMat, X.getRowSize(), X.getColSize(), X.getLd(), Y);
+} // operator+=(const matrixView & X, const matrixExpression<E> & Y) -------------------------------
+
+/**
+ * @brief operator -= - Overloading of the subtraction equal operatior between a view and a matrix
+ *                      expression. The expression is evaluated directly into the view.
+ * @param X           - Main view for subtraction.
+ * @param Y           - Subtraction expression.
+ */
+template <typename E>
+void operator-=(const matrixView & X, const matrixExpression<E> & Y) {
+  matrixExpressionEvaluate<matrixExpressionSubtract>(X.mMat, X.getRowSize(), X.getColSize(), X.getLd(), Y);
+} // operator-=(const matrixView & X, const matrixExpression<E> & Y) -------------------------------
+
+#endif // MATRIXLIBRARYVIEW_H
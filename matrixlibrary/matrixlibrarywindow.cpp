@@ -0,0 +1,256 @@
+/*
+ * Copyright:   2021 Johnathon Leong
+ *
+ * License:     License under LGPL-3.0-or-later.
+ *              Please refer to https://www.gnu.org/licenses/lgpl-3.0.txt for more information on the
+ *              terms of LGPL-3.0 or relavent website for a later version of the LGPL.
+ *
+ * Disclaimer:  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY
+ *              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ *              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ *              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ *              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *              WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author:      Johnathon Leong
+ *
+ * Note:        Sliding window matrix of matrixlibrary. The window holds the latest row x col values
+ *              pushed into it, in row-major order, with the oldest value as its first element. Every
+ *              value is stored twice in a ring buffer of twice the window size, so that a push only
+ *              writes two elements and moves the head of the window, and the window is always a
+ *              contiguous row-major block that can be viewed without unrolling the ring. A view of
+ *              the window is only valid until the next push into the window.
+ *              To be used together with matrixlibrary and matrixlibraryview.
+ *
+ * Version:     1.0.0
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Implemented first release version of matrixlibrarywindow.
+ */
+
+#include "matrixlibrarywindow.h"
+#include "matrixlibraryallocator.h"
+#include <string.h>
+
+/// ================================================================================================
+/// PUBLIC FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief matrixWindow - Default constructor. The window is empty until it is created.
+ */
+matrixWindow::matrixWindow() {
+  mMat = NULL;
+  mRow = 0;
+  mCol = 0;
+  mSize = 0;
+  mHead = 0;
+} // matrixWindow::matrixWindow() ------------------------------------------------------------------
+
+/**
+ * @brief matrixWindow - Overloaded constructor to instantiate a mxn window with all the elements
+ *                       cleared to zero.
+ * @param rowSize      - Row size of the window.
+ * @param colSize      - Column size of the window.
+ */
+matrixWindow::matrixWindow(unsigned long rowSize, unsigned long colSize) {
+  mMat = NULL;
+  this->create(rowSize, colSize);
+} // matrixWindow::matrixWindow(unsigned long rowSize, unsigned long colSize) ----------------------
+
+/**
+ * @brief matrixWindow - Overloaded copy constructor.
+ * @param X            - Window to be copied.
+ */
+matrixWindow::matrixWindow(const matrixWindow & X) {
+  mMat = NULL;
+  this->create(X.mRow, X.mCol);
+  if (mSize > 0)
+    this->push(&X.mMat[X.mHead], mSize);
+} // matrixWindow::matrixWindow(const matrixWindow & X) --------------------------------------------
+
+/**
+ * @brief ~matrixWindow - Destructor.
+ */
+matrixWindow::~matrixWindow() {
+  this->release();
+} // matrixWindow::~matrixWindow() -----------------------------------------------------------------
+
+/**
+ * @brief operator = - Overloaded operator to copy a window into itself.
+ * @param X          - The window to copy from.
+ * @return           - Returns the window reference of itself.
+ */
+matrixWindow& matrixWindow::operator=(const matrixWindow & X) {
+  if (this == &X)
+    return * this;
+  if ((mRow != X.mRow) || (mCol != X.mCol))
+    this->create(X.mRow, X.mCol);
+  if (mSize > 0)
+    this->push(&X.mMat[X.mHead], mSize);
+  return * this;
+} // matrixWindow::operator=(const matrixWindow & X) -----------------------------------------------
+
+/**
+ * @brief operator << - Pushes a value into the last element of the window. The first element of
+ *                      the window is pushed out.
+ * @param X           - The value to be pushed.
+ * @return            - Returns the window reference of itself.
+ */
+matrixWindow& matrixWindow::operator<<(double X) {
+  if (mSize == 0)
+    matrixExit("Matrix size not yet defined.");
+
+  mMat[mHead] = X;
+  mMat[mHead + mSize] = X;
+  if (++mHead == mSize)
+    mHead = 0;
+  return * this;
+} // matrixWindow::operator<<(double X) ------------------------------------------------------------
+
+/**
+ * @brief operator << - Pushes the rows of a view into the last rows of the window. The same number
+ *                      of rows is pushed out from the top of the window.
+ * @param X           - The rows to be pushed, with the same column size as the window.
+ * @return            - Returns the window reference of itself.
+ */
+matrixWindow& matrixWindow::operator<<(const matrixView & X) {
+  if (X.getColSize() != mCol)
+    matrixExit("Matrices size mismatch.");
+
+  // rows that would be pushed out again by the later rows of the view are skipped
+  unsigned long i = (X.getRowSize() > mRow) ? X.getRowSize() - mRow : 0;
+  for (; i < X.getRowSize(); i++)
+    this->push(&X.mMat[i * X.getLd()], mCol);
+  return * this;
+} // matrixWindow::operator<<(const matrixView & X) ------------------------------------------------
+
+/**
+ * @brief operator () - Returns the value of an element of the window, with the first element at row
+ *                      and column index 1.
+ * @param rowIndex    - Row index of the element.
+ * @param colIndex    - Column index of the element.
+ * @return            - The value of the element.
+ */
+double matrixWindow::operator()(unsigned long rowIndex, unsigned long colIndex) const {
+  return mMat[mHead + --rowIndex * mCol + --colIndex];
+} // matrixWindow::operator()(unsigned long rowIndex, unsigned long colIndex) const ----------------
+
+/**
+ * @brief clear - Clears all the elements of the window to zero.
+ */
+void matrixWindow::clear(void) {
+  if (mMat != NULL)
+    memset(mMat, 0, sizeof(double) * 2 * mSize);
+  mHead = 0;
+} // matrixWindow::clear(void) ---------------------------------------------------------------------
+
+/**
+ * @brief create - Creates a mxn window with all the elements cleared to zero.
+ * @param row    - Row size of the window.
+ * @param col    - Column size of the window.
+ */
+void matrixWindow::create(unsigned long row, unsigned long col) {
+  this->release();
+  mRow = row;
+  mCol = col;
+  mSize = row * col;
+  mHead = 0;
+  if (mSize > 0)
+    mMat = matrixAllocatorCalloc(sizeof(double) * 2 * mSize);
+} // matrixWindow::create(unsigned long row, unsigned long col) ------------------------------------
+
+/**
+ * @brief getColSize - Returns the column size of the window.
+ * @return           - Column size of the window.
+ */
+unsigned long matrixWindow::getColSize(void) const {
+  return mCol;
+} // matrixWindow::getColSize(void) const ----------------------------------------------------------
+
+/**
+ * @brief getHead - Returns the position of the first element of the window in its ring buffer.
+ * @return        - Head offset of the window, from 0 to the size of the window minus 1.
+ */
+unsigned long matrixWindow::getHead(void) const {
+  return mHead;
+} // matrixWindow::getHead(void) const -------------------------------------------------------------
+
+/**
+ * @brief getLd - Returns the leading dimension (row stride) of the window.
+ * @return      - Leading dimension of the window.
+ */
+unsigned long matrixWindow::getLd(void) const {
+  return mCol;
+} // matrixWindow::getLd(void) const ---------------------------------------------------------------
+
+/**
+ * @brief getRowSize - Returns the row size of the window.
+ * @return           - Row size of the window.
+ */
+unsigned long matrixWindow::getRowSize(void) const {
+  return mRow;
+} // matrixWindow::getRowSize(void) const ----------------------------------------------------------
+
+/**
+ * @brief getSize - Returns the size of the window.
+ * @return        - Size of the window.
+ */
+unsigned long matrixWindow::getSize(void) const {
+  return mSize;
+} // matrixWindow::getSize(void) const -------------------------------------------------------------
+
+/**
+ * @brief push - Pushes values into the last elements of the window, in order. The same number of
+ *               elements is pushed out from the start of the window.
+ * @param X    - Pointer to the values to be pushed.
+ * @param n    - Number of values to be pushed.
+ */
+void matrixWindow::push(const double * X, unsigned long n) {
+  if (mSize == 0)
+    matrixExit("Matrix size not yet defined.");
+
+  // only the latest values that fit in the window are kept
+  if (n > mSize) {
+    X += n - mSize;
+    n = mSize;
+  }
+
+  // both copies of the ring are written, wrapping around the end of the ring once at most
+  unsigned long first = (n < mSize - mHead) ? n : mSize - mHead;
+  memcpy(&mMat[mHead], X, sizeof(double) * first);
+  memcpy(&mMat[mHead + mSize], X, sizeof(double) * first);
+  if (n > first) {
+    memcpy(mMat, &X[first], sizeof(double) * (n - first));
+    memcpy(&mMat[mSize], &X[first], sizeof(double) * (n - first));
+  }
+
+  mHead += n;
+  if (mHead >= mSize)
+    mHead -= mSize;
+} // matrixWindow::push(const double * X, unsigned long n) -----------------------------------------
+
+/**
+ * @brief view - Returns a view of the window. No element is copied. The view is only valid until the
+ *               next push into the window, and must not be written through.
+ * @return     - Returns the view of the window.
+ */
+matrixView matrixWindow::view(void) const {
+  return matrixView(&mMat[mHead], mRow, mCol, mCol);
+} // matrixWindow::view(void) const ----------------------------------------------------------------
+
+/// ================================================================================================
+/// PRIVATE FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief release - Free up the memory allocated for the window.
+ */
+void matrixWindow::release(void) {
+  matrixAllocatorFree(mMat);
+  mMat = NULL;
+  mRow = 0;
+  mCol = 0;
+  mSize = 0;
+  mHead = 0;
+} // matrixWindow::release(void) -------------------------------------------------------------------
@@ -0,0 +1,206 @@
+/*
+ * Copyright:   2021 Johnathon Leong
+ *
+ * License:     License under LGPL-3.0-or-later.
+ *              Please refer to https://www.gnu.org/licenses/lgpl-3.0.txt for more information on the
+ *              terms of LGPL-3.0 or relavent website for a later version of the LGPL.
+ *
+ * Disclaimer:  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY
+ *              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ *              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ *              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ *              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ *              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ *              WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author:      Johnathon Leong
+ *
+ * Note:        Sliding window matrix of matrixlibrary. The window holds the latest row x col values
+ *              pushed into it, in row-major order, with the oldest value as its first element. Every
+ *              value is stored twice in a ring buffer of twice the window size, so that a push only
+ *              writes two elements and moves the head of the window, and the window is always a
+ *              contiguous row-major block that can be viewed without unrolling the ring. A view of
+ *              the window is only valid until the next push into the window.
+ *              To be used together with matrixlibrary and matrixlibraryview.
+ *
+ * Version:     1.0.0
+ * Date:        2026/10/18 (YYYY/MM/DD)
+ * Change Log:  1. Implemented first release version of matrixlibrarywindow.
+ */
+
+#ifndef MATRIXLIBRARYWINDOW_H
+#define MATRIXLIBRARYWINDOW_H
+
+#include "matrixlibrary.h"
+
+class matrixWindow : public matrixExpression<matrixWindow>
+{
+public:
+  /**
+   * @brief matrixWindow - Default constructor. The window is empty until it is created.
+   */
+  matrixWindow();
+
+  /**
+   * @brief matrixWindow - Overloaded constructor to instantiate a mxn window with all the elements
+   *                       cleared to zero.
+   * @param rowSize      - Row size of the window.
+   * @param colSize      - Column size of the window.
+   */
+  explicit matrixWindow(unsigned long rowSize, unsigned long colSize);
+
+  /**
+   * @brief matrixWindow - Overloaded copy constructor.
+   * @param X            - Window to be copied.
+   */
+  matrixWindow(const matrixWindow & X);
+
+  /**
+   * @brief ~matrixWindow - Destructor.
+   */
+  ~matrixWindow();
+
+  /**
+   * @brief operator = - Overloaded operator to copy a window into itself.
+   * @param X          - The window to copy from.
+   * @return           - Returns the window reference of itself.
+   */
+  matrixWindow& operator=(const matrixWindow & X);
+
+  /**
+   * @brief operator << - Pushes a value into the last element of the window. The first element of
+   *                      the window is pushed out.
+   * @param X           - The value to be pushed.
+   * @return            - Returns the window reference of itself.
+   */
+  matrixWindow& operator<<(double X);
+
+  /**
+   * @brief operator << - Pushes the rows of a view into the last rows of the window. The same
+   *                      number of rows is pushed out from the top of the window.
+   * @param X           - The rows to be pushed, with the same column size as the window. The view
+   *                      must not refer to the window itself.
+   * @return            - Returns the window reference of itself.
+   */
+  matrixWindow& operator<<(const matrixView & X);
+
+  /**
+   * @brief operator () - Returns the value of an element of the window, with the first element at
+   *                      row and column index 1.
+   * @param rowIndex    - Row index of the element.
+   * @param colIndex    - Column index of the element.
+   * @return            - The value of the element.
+   */
+  double operator()(unsigned long rowIndex, unsigned long colIndex) const;
+
+  /**
+   * @brief clear - Clears all the elements of the window to zero.
+   */
+  void clear(void);
+
+  /**
+   * @brief create - Creates a mxn window with all the elements cleared to zero.
+   * @param row    - Row size of the window.
+   * @param col    - Column size of the window.
+   */
+  void create(unsigned long row, unsigned long col);
+
+  /**
+   * @brief evaluate - Returns an element of the window for the evaluation of matrix expressions.
+   * @param row      - Zero based row index.
+   * @param col      - Zero based column index.
+   * @return         - Value of the element.
+   */
+  double evaluate(unsigned long row, unsigned long col) const { return mMat[mHead + row * mCol + col]; }
+
+  /**
+   * @brief getColSize - Returns the column size of the window.
+   * @return           - Column size of the window.
+   */
+  unsigned long getColSize(void) const;
+
+  /**
+   * @brief getHead - Returns the position of the first element of the window in its ring buffer.
+   * @return        - Head offset of the window, from 0 to the size of the window minus 1.
+   */
+  unsigned long getHead(void) const;
+
+  /**
+   * @brief getLd - Returns the leading dimension (row stride) of the window.
+   * @return      - Leading dimension of the window.
+   */
+  unsigned long getLd(void) const;
+
+  /**
+   * @brief getRowSize - Returns the row size of the window.
+   * @return           - Row size of the window.
+   */
+  unsigned long getRowSize(void) const;
+
+  /**
+   * @brief getSize - Returns the size of the window.
+   * @return        - Size of the window.
+   */
+  unsigned long getSize(void) const;
+
+  /**
+   * @brief push - Pushes values into the last elements of the window, in order. The same number of
+   *               elements is pushed out from the start of the window.
+   * @param X    - Pointer to the values to be pushed.
+   * @param n    - Number of values to be pushed.
+   */
+  void push(const double * X, unsigned long n);
+
+  /**
+   * @brief view - Returns a view of the window. No element is copied. The view is only valid until
+   *               the next push into the window, and must not be written through.
+   * @return     - Returns the view of the window.
+   */
+  matrixView view(void) const;
+
+private:
+  /**
+   * @brief mMat - "double" type pointer to the ring buffer, holding every value twice.
+   */
+  double * mMat;
+
+  /**
+   * @brief mRow - To store the row size of the window.
+   */
+  unsigned long mRow;
+
+  /**
+   * @brief mCol - To store the column size of the window.
+   */
+  unsigned long mCol;
+
+  /**
+   * @brief mSize - To store the size of the window.
+   */
+  unsigned long mSize;
+
+  /**
+   * @brief mHead - To store the position of the first element of the window in the ring buffer.
+   */
+  unsigned long mHead;
+
+  /**
+   * @brief release - Free up the memory allocated for the window.
+   */
+  void release(void);
+};
+
+/// ================================================================================================
+/// TEMPLATE FUNCTIONS
+/// ================================================================================================
+/**
+ * @brief matrixExpressionStore - Windows are held by reference in the expression tree.
+ */
+template <>
+struct matrixExpressionStore<matrixWindow> {
+  typedef const matrixWindow & type;
+};
+
+#endif // MATRIXLIBRARYWINDOW_H